@@ -0,0 +1,235 @@
+// ============================================================================================
+//
+// benchassocarray.cpp -- DAssocArray vs. std::unordered_map Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures the time per operation of a "DAssocArray" and a "std::unordered_map" with
+integer keys and with string keys, at table sizes from a few thousand elements (which fit in
+the cache) to a few million (which don't).  Four workloads are run on each:
+
+  insert  add every key, one at a time, to an empty table
+  hit     look up every key, in random order
+  miss    look up the same no. of keys that aren't in the table
+  remove  remove every key, in random order
+
+Usage:  benchassocarray [max. no. of elements]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <dstructs/dassocarray.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is what one run reports:  nanoseconds per operation for each workload.
+*/
+
+struct Result
+{
+  double insertNs;
+  double hitNs;
+  double missNs;
+  double removeNs;
+};
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class Key> static const Result runDAssocArray
+(
+  const std::vector<Key>& keys,                         // the keys to add, look up & remove
+  const std::vector<Key>& shuffled,                     // "keys" in a random order
+  const std::vector<Key>& absent                        // keys that are never added
+)
+
+/*
+This function runs the workloads on a "DAssocArray".
+*/
+
+{
+  DAssocArray<unsigned int, Key> table;
+  size_t                         checksum(0U);
+  Result                         result;
+  Stopwatch                      stopwatch;
+
+  for (unsigned int i = 0U; i < keys.size(); ++i)
+    table[keys[i]] = i;
+
+  result.insertNs = stopwatch.elapsedNs() / keys.size();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < shuffled.size(); ++i)
+    checksum += *table.find(shuffled[i]);
+
+  result.hitNs = stopwatch.elapsedNs() / shuffled.size();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < absent.size(); ++i)
+    checksum += table.contains(absent[i]);
+
+  result.missNs = stopwatch.elapsedNs() / absent.size();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < shuffled.size(); ++i)
+    checksum += table.remove(shuffled[i]);
+
+  result.removeNs = stopwatch.elapsedNs() / shuffled.size();
+
+  if (checksum != (size_t)keys.size() * (keys.size() - 1U) / 2U + keys.size() ||
+    !table.isEmpty())
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+template<class Key> static const Result runUnorderedMap
+(
+  const std::vector<Key>& keys,                         // the keys to add, look up & remove
+  const std::vector<Key>& shuffled,                     // "keys" in a random order
+  const std::vector<Key>& absent                        // keys that are never added
+)
+
+/*
+This function runs the workloads on a "std::unordered_map".
+*/
+
+{
+  std::unordered_map<Key, unsigned int> table;
+  size_t                                checksum(0U);
+  Result                                result;
+  Stopwatch                             stopwatch;
+
+  for (unsigned int i = 0U; i < keys.size(); ++i)
+    table[keys[i]] = i;
+
+  result.insertNs = stopwatch.elapsedNs() / keys.size();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < shuffled.size(); ++i)
+    checksum += table.find(shuffled[i])->second;
+
+  result.hitNs = stopwatch.elapsedNs() / shuffled.size();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < absent.size(); ++i)
+    checksum += table.count(absent[i]);
+
+  result.missNs = stopwatch.elapsedNs() / absent.size();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < shuffled.size(); ++i)
+    checksum += table.erase(shuffled[i]);
+
+  result.removeNs = stopwatch.elapsedNs() / shuffled.size();
+
+  if (checksum != (size_t)keys.size() * (keys.size() - 1U) / 2U + keys.size() ||
+    !table.empty())
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+template<class Key> static void report
+(
+  const char *const       name,                         // the key type's name
+  const std::vector<Key>& keys,                         // the keys to add, look up & remove
+  const std::vector<Key>& absent                        // keys that are never added
+)
+
+/*
+This routine runs the workloads on both tables and prints a row of results.
+*/
+
+{
+  std::vector<Key> shuffled(keys);
+
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42U));
+
+  const Result assocArray(runDAssocArray(keys, shuffled, absent));
+  const Result unorderedMap(runUnorderedMap(keys, shuffled, absent));
+
+  std::cout << "  " << std::left << std::setw(7) << name << std::right << std::setw(9)
+    << keys.size()
+    << std::setw(8) << assocArray.insertNs << std::setw(7) << unorderedMap.insertNs
+    << std::setw(8) << assocArray.hitNs << std::setw(7) << unorderedMap.hitNs
+    << std::setw(8) << assocArray.missNs << std::setw(7) << unorderedMap.missNs
+    << std::setw(8) << assocArray.removeNs << std::setw(7) << unorderedMap.removeNs
+    << std::endl;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int maxNumElements(argc > 1 ? (unsigned int)atoi(argv[1]) : 4000000U);
+
+  std::mt19937_64 random(1U);
+
+  std::cout << "Time per operation in ns (DAssocArray vs. std::unordered_map)" << std::endl;
+  std::cout << "  key     elements   insert         hit           miss         remove"
+    << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (unsigned int numElements = 4000U; numElements <= maxNumElements; numElements *= 10U)
+  {
+    std::vector<unsigned long> ints(numElements);
+    std::vector<unsigned long> absentInts(numElements);
+
+    for (unsigned int i = 0U; i < numElements; ++i)
+    {
+      ints[i]       = random() | 1U;
+      absentInts[i] = random() & ~1UL;
+    }
+
+    report("int", ints, absentInts);
+  }
+
+  for (unsigned int numElements = 4000U; numElements <= maxNumElements; numElements *= 10U)
+  {
+    std::vector<std::string> strings(numElements);
+    std::vector<std::string> absentStrings(numElements);
+
+    for (unsigned int i = 0U; i < numElements; ++i)
+    {
+      strings[i]       = "key #" + std::to_string(i) + " of the string workload";
+      absentStrings[i] = "key #" + std::to_string(i) + " not in the table";
+    }
+
+    report("string", strings, absentStrings);
+  }
+
+  return 0;
+}
@@ -0,0 +1,232 @@
+// ============================================================================================
+//
+// benchbtree.cpp -- BTree vs. AVLTree Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures a "BTree" and an "AVLTree" of "unsigned int" elements holding from 1,024
+up to "max. count" elements, quadrupling each time.  Four workloads are run on each:
+
+  build   inserting the elements in random order into an empty tree (and, for the "BTree",
+          bulk-loading them from a sorted "SArray")
+  lookup  "contains()" on random elements, half of which are in the tree
+  scan    "lowerBound()" on a random element followed by visiting the next "SCAN_LENGTH"
+          elements
+  full    visiting every element with the element iterators
+
+Every figure is the average time per element, in nanoseconds.  The lookups and scans are
+checked against each other with a checksum.
+
+Usage:  benchbtree [max. count]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <dstructs/avltree.h>
+#include <dstructs/btree.h>
+#include <dstructs/sarray.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is what one run reports:  nanoseconds per element for each workload, and a checksum of
+what the lookups and scans found.
+*/
+
+struct Result
+{
+  double buildNs;
+  double lookupNs;
+  double scanNs;
+  double fullNs;
+  size_t checksum;
+};
+
+// ============================================================================================
+// CONSTANTS
+// ============================================================================================
+
+static const unsigned int NUM_QUERIES = 1000000U;          // lookups per workload
+static const unsigned int NUM_SCANS   = 100000U;           // scans per workload
+static const unsigned int SCAN_LENGTH = 100U;              // elements visited per scan
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class TreeType> static void runQueries
+(
+  const TreeType&                  tree,            // the tree to query
+  const std::vector<unsigned int>& queries,         // elements to look up and scan from
+  Result&                          result           // gets the times and the checksum
+)
+
+/*
+This function runs the lookup, scan and full-iteration workloads on "tree".
+*/
+
+{
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < NUM_QUERIES; ++i)
+    result.checksum += tree.contains(queries[i]) ? 1U : 0U;
+
+  result.lookupNs = stopwatch.elapsedNs() / NUM_QUERIES;
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < NUM_SCANS; ++i)
+  {
+    typename TreeType::ConstElementIterator element = tree.lowerBound(queries[i]);
+
+    for (unsigned int j = 0U; j < SCAN_LENGTH && element != tree.end(); ++j, ++element)
+      result.checksum += *element;
+  }
+
+  result.scanNs = stopwatch.elapsedNs() / ((double)NUM_SCANS * SCAN_LENGTH);
+  stopwatch.restart();
+
+  size_t sum(0U);
+
+  for (typename TreeType::ConstElementIterator element = tree.begin(); element != tree.end();
+    ++element)
+    sum += *element;
+
+  result.fullNs = stopwatch.elapsedNs() / tree.numElements();
+
+  if (sum == 0U)
+    std::cerr << "  Empty tree!" << std::endl;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class TreeType> static const Result runInserted
+(
+  const std::vector<unsigned int>& elements,        // the elements, in random order
+  const std::vector<unsigned int>& queries          // elements to look up and scan from
+)
+
+/*
+This function builds a tree by inserting "elements" one at a time and runs the workloads on
+it.
+*/
+
+{
+  Result   result;
+  TreeType tree;
+
+  result.checksum = 0U;
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < elements.size(); ++i)
+    tree.insert(elements[i]);
+
+  result.buildNs = stopwatch.elapsedNs() / elements.size();
+
+  runQueries(tree, queries, result);
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runBulkLoaded
+(
+  const std::vector<unsigned int>& elements,        // the elements, in random order
+  const std::vector<unsigned int>& queries          // elements to look up and scan from
+)
+
+/*
+This function bulk-loads a "BTree" from a sorted "SArray" of "elements" and runs the workloads
+on it.  Sorting the "SArray" isn't timed.
+*/
+
+{
+  Result               result;
+  SArray<unsigned int> sorted((unsigned int)elements.size());
+
+  result.checksum = 0U;
+
+  for (unsigned int i = 0U; i < elements.size(); ++i)
+    sorted[i] = elements[i];
+
+  std::sort(sorted.begin(), sorted.end());
+
+  Stopwatch          stopwatch;
+  const BTree<unsigned int> tree(sorted);
+
+  result.buildNs = stopwatch.elapsedNs() / elements.size();
+
+  runQueries(tree, queries, result);
+  return result;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int maxCount = argc > 1 ? (unsigned int)atoi(argv[1]) : 16U * 1024U * 1024U;
+
+  std::cout << "Time per element in ns (BTree bulk-loaded, BTree inserted, AVLTree)"
+    << std::endl;
+  std::cout << "     elements        build                 lookup                "
+    "scan                  full" << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (unsigned int count = 1024U; count <= maxCount && count > 0U; count *= 4U)
+  {
+    std::vector<unsigned int> elements(count);
+    std::vector<unsigned int> queries(NUM_QUERIES);
+    std::mt19937              random(1U);
+
+    for (unsigned int i = 0U; i < count; ++i)
+      elements[i] = 2U * i + 1U;
+
+    std::shuffle(elements.begin(), elements.end(), random);
+
+    for (unsigned int i = 0U; i < NUM_QUERIES; ++i)
+      queries[i] = (unsigned int)(random() % (2U * count));
+
+    const Result bulk(runBulkLoaded(elements, queries));
+    const Result inserted(runInserted<BTree<unsigned int> >(elements, queries));
+    const Result avl(runInserted<AVLTree<unsigned int> >(elements, queries));
+
+    std::cout << std::setw(13) << count
+      << std::setw(8) << bulk.buildNs << std::setw(7) << inserted.buildNs
+      << std::setw(7) << avl.buildNs
+      << std::setw(8) << bulk.lookupNs << std::setw(7) << inserted.lookupNs
+      << std::setw(7) << avl.lookupNs
+      << std::setw(8) << bulk.scanNs << std::setw(7) << inserted.scanNs
+      << std::setw(7) << avl.scanNs
+      << std::setw(8) << bulk.fullNs << std::setw(7) << inserted.fullNs
+      << std::setw(7) << avl.fullNs << std::endl;
+
+    if (bulk.checksum != inserted.checksum || bulk.checksum != avl.checksum)
+      std::cerr << "  Checksum mismatch!" << std::endl;
+  }
+
+  return 0;
+}
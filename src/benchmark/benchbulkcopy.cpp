@@ -0,0 +1,199 @@
+// ============================================================================================
+//
+// benchbulkcopy.cpp -- Contiguous Bulk-Copy vs. Iterated Copy Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures two whole-structure copies with and without the contiguous bulk-copy
+path (refer to "DataStructure<T>::contiguousElements()"):
+
+  "SStack<int> += SArray<int>" -- a reversed block copy ("std::reverse_copy()")
+  "DStack<int> = SStack<int>"  -- a tight node-construction loop over the block
+
+The "iterated" figures use sources that hide their storage (by overriding
+"contiguousElements()" to return NULL) so that every element goes through a virtual
+"Iterator_", which is how every copy was done before.
+
+Usage:  benchbulkcopy [rounds [no. of elements]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <dstructs/dstack.h>
+#include <dstructs/sarray.h>
+#include <dstructs/sstack.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+These are ordinary "SArray" and "SStack" objects except that they don't admit to being
+contiguous.
+*/
+
+class OpaqueSArray:
+  public SArray<int>
+{
+  public:
+                           OpaqueSArray(const unsigned int size):
+                             SDataStructure<int>(size),
+                             SArray<int>(size)
+                             {return;}
+
+  protected:
+    virtual const int *const contiguousElements(bool&) const noexcept
+                               {return NULL;}
+};
+
+class OpaqueSStack:
+  public SStack<int>
+{
+  public:
+                           OpaqueSStack(const unsigned int size):
+                             SDataStructure<int>(size),
+                             SStack<int>(size)
+                             {return;}
+
+  protected:
+    virtual const int *const contiguousElements(bool&) const noexcept
+                               {return NULL;}
+};
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+static const double appendToSStack
+(
+  const SArray<int>& source,                              // the array to copy from
+  const unsigned int rounds                               // no. of times to copy it
+)
+
+/*
+This function returns the average time, in nanoseconds, of one "SStack<int> += source".
+*/
+
+{
+  SStack<int> destination(source.numElements());
+  long        checksum(0L);
+  Stopwatch   stopwatch(false);
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+  {
+    destination.empty();
+
+    stopwatch.resume();
+    destination += source;
+    stopwatch.pause();
+
+    int topElement;
+
+    destination.peek(topElement);
+    checksum += topElement;
+  }
+
+  if (checksum != 0L)
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return stopwatch.elapsedNs() / rounds;
+}
+
+/*********************************************************************************************/
+
+static const double assignToDStack
+(
+  const SStack<int>& source,                              // the stack to copy from
+  const unsigned int rounds                               // no. of times to copy it
+)
+
+/*
+This function returns the average time, in nanoseconds, of one "DStack<int> = source".  The
+destination is emptied outside of the timed region, so node destruction isn't counted (and the
+node pool is warm after the first round).
+*/
+
+{
+  DStack<int> destination;
+  long        checksum(0L);
+  Stopwatch   stopwatch(false);
+
+  destination = source;
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+  {
+    destination.empty();
+
+    stopwatch.resume();
+    destination = source;
+    stopwatch.pause();
+
+    int topElement;
+
+    destination.peek(topElement);
+    checksum += topElement;
+  }
+
+  if (checksum != (long)rounds * (source.numElements() - 1U))
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return stopwatch.elapsedNs() / rounds;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int rounds(argc > 1 ? (unsigned int)atoi(argv[1]) : 20U);
+  const unsigned int numElements(argc > 2 ? (unsigned int)atoi(argv[2]) : 1000000U);
+
+  SArray<int>  array(numElements);
+  OpaqueSArray opaqueArray(numElements);
+  SStack<int>  stack(numElements);
+  OpaqueSStack opaqueStack(numElements);
+
+  for (unsigned int i = 0U; i < numElements; ++i)
+  {
+    array[i]       = (int)i;
+    opaqueArray[i] = (int)i;
+    stack.push((int)i);
+    opaqueStack.push((int)i);
+  }
+
+  const double bulkAppendNs(appendToSStack(array, rounds));
+  const double iteratedAppendNs(appendToSStack(opaqueArray, rounds));
+  const double bulkAssignNs(assignToDStack(stack, rounds));
+  const double iteratedAssignNs(assignToDStack(opaqueStack, rounds));
+
+  std::cout << "SStack<int> += SArray<int> (" << numElements << " elements, " << rounds
+    << " rounds)" << std::endl;
+  std::cout << "  bulk:     " << bulkAppendNs / numElements << " ns per element" << std::endl;
+  std::cout << "  iterated: " << iteratedAppendNs / numElements << " ns per element"
+    << std::endl;
+  std::cout << "  speed-up: " << iteratedAppendNs / bulkAppendNs << "x" << std::endl;
+
+  std::cout << "DStack<int> = SStack<int> (" << numElements << " elements, " << rounds
+    << " rounds)" << std::endl;
+  std::cout << "  bulk:     " << bulkAssignNs / numElements << " ns per element" << std::endl;
+  std::cout << "  iterated: " << iteratedAssignNs / numElements << " ns per element"
+    << std::endl;
+  std::cout << "  speed-up: " << iteratedAssignNs / bulkAssignNs << "x" << std::endl;
+
+  return 0;
+}
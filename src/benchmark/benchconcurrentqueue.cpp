@@ -0,0 +1,274 @@
+// ============================================================================================
+//
+// benchconcurrentqueue.cpp -- Lock-Free MPMC Queue vs. Mutex-Guarded Queue Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures the throughput and latency of an "SConcurrentQueue<long>" shared by
+producer and consumer threads, and of an "SQueue<long>" guarded by a "std::mutex" (with a
+"std::condition_variable" for each side to wait on) shared the same way.  Both queues have the
+same capacity and every thread uses the blocking operations.
+
+Three shapes of pipeline are run for each thread count N from 1 to 32 (by powers of two):
+
+  N:N   N producers feeding N consumers
+  N:1   N producers fanning in to 1 consumer
+  1:N   1 producer fanning out to N consumers
+
+Every element is the time at which it was enqueued, so each consumer measures the latency of
+every element that it dequeues.  Throughput is elements per second from the first enqueue to
+the last dequeue; latency is reported as the median and the 99th percentile.
+
+Usage:  benchconcurrentqueue [elements per run [capacity [max. no. of threads]]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <dstructs/sconcurrentqueue.h>
+#include <dstructs/squeue.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is the baseline:  an "SQueue" with every operation done under one lock.
+*/
+
+class MutexSQueue
+{
+  public:
+         MutexSQueue(const unsigned int capacity):
+           _queue(capacity) {return;}
+
+    void blockingEnqueue(const long element)
+           {
+             std::unique_lock<std::mutex> lock(_mutex);
+
+             _notFull.wait(lock, [this] {return !_queue.isFull();});
+             _queue.enqueue(element);
+             lock.unlock();
+             _notEmpty.notify_one();
+             return;
+           }
+    void blockingDequeue(long& element)
+           {
+             std::unique_lock<std::mutex> lock(_mutex);
+
+             _notEmpty.wait(lock, [this] {return !_queue.isEmpty();});
+             _queue.dequeue(element);
+             lock.unlock();
+             _notFull.notify_one();
+             return;
+           }
+
+  private:
+    std::mutex              _mutex;
+    std::condition_variable _notEmpty;
+    std::condition_variable _notFull;
+    SQueue<long>            _queue;
+};
+
+/*
+This is what one run reports.
+*/
+
+struct Result
+{
+  double elementsPerSecond;
+  double medianLatencyNs;
+  double p99LatencyNs;
+};
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+static inline long now()
+
+/*
+This function returns the current time, in nanoseconds, on the steady clock.
+*/
+
+{
+  return (long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*********************************************************************************************/
+
+template<class SharedQueue> static const Result pipeline
+(
+  SharedQueue&       queue,                            // the queue that the threads share
+  const unsigned int numProducers,                     // no. of producer threads
+  const unsigned int numConsumers,                     // no. of consumer threads
+  const unsigned int numElements                       // no. of elements passed through
+)
+
+/*
+This function passes "numElements" elements from "numProducers" producers to "numConsumers"
+consumers through "queue" and returns the throughput and latency.  The elements are shared out
+as evenly as possible on both sides.
+*/
+
+{
+  std::vector<std::thread>        threads;
+  std::vector<std::vector<long> > latencies(numConsumers);
+  std::atomic<bool>               isStarted(false);
+  Stopwatch                       stopwatch(false);
+
+  for (unsigned int consumer = 0U; consumer < numConsumers; ++consumer)
+  {
+    const unsigned int share = numElements / numConsumers +
+      (consumer < numElements % numConsumers ? 1U : 0U);
+
+    latencies[consumer].reserve(share);
+
+    threads.emplace_back([&queue, &latencies, &isStarted, consumer, share]
+    {
+      while (!isStarted.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+      for (unsigned int i = 0U; i < share; ++i)
+      {
+        long enqueuedAt;
+
+        queue.blockingDequeue(enqueuedAt);
+        latencies[consumer].push_back(now() - enqueuedAt);
+      }
+    });
+  }
+
+  for (unsigned int producer = 0U; producer < numProducers; ++producer)
+  {
+    const unsigned int share = numElements / numProducers +
+      (producer < numElements % numProducers ? 1U : 0U);
+
+    threads.emplace_back([&queue, &isStarted, share]
+    {
+      while (!isStarted.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+      for (unsigned int i = 0U; i < share; ++i)
+        queue.blockingEnqueue(now());
+    });
+  }
+
+  stopwatch.resume();
+  isStarted.store(true, std::memory_order_release);
+
+  for (unsigned int thread = 0U; thread < threads.size(); ++thread)
+    threads[thread].join();
+
+  stopwatch.pause();
+
+  std::vector<long> all;
+
+  all.reserve(numElements);
+
+  for (unsigned int consumer = 0U; consumer < numConsumers; ++consumer)
+    all.insert(all.end(), latencies[consumer].begin(), latencies[consumer].end());
+
+  if (all.size() != numElements)
+    std::cerr << "  Element count mismatch!" << std::endl;
+
+  Result result;
+
+  result.elementsPerSecond = numElements / (stopwatch.elapsedNs() / 1.0e9);
+
+  std::nth_element(all.begin(), all.begin() + all.size() / 2U, all.end());
+  result.medianLatencyNs = (double)all[all.size() / 2U];
+
+  std::nth_element(all.begin(), all.begin() + all.size() * 99U / 100U, all.end());
+  result.p99LatencyNs = (double)all[all.size() * 99U / 100U];
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static void report
+(
+  const unsigned int numProducers,
+  const unsigned int numConsumers,
+  const unsigned int numElements,
+  const unsigned int capacity
+)
+
+/*
+This routine runs one pipeline shape on both queues and prints a row of results.
+*/
+
+{
+  SConcurrentQueue<long> lockFreeQueue(capacity);
+  MutexSQueue            mutexQueue(capacity);
+
+  const Result lockFree(pipeline(lockFreeQueue, numProducers, numConsumers, numElements));
+  const Result mutex(pipeline(mutexQueue, numProducers, numConsumers, numElements));
+
+  std::cout << "  " << std::setw(2) << numProducers << ":" << std::left << std::setw(2)
+    << numConsumers << std::right
+    << std::setw(11) << lockFree.elementsPerSecond / 1.0e6
+    << std::setw(10) << lockFree.medianLatencyNs / 1.0e3
+    << std::setw(10) << lockFree.p99LatencyNs / 1.0e3
+    << std::setw(11) << mutex.elementsPerSecond / 1.0e6
+    << std::setw(10) << mutex.medianLatencyNs / 1.0e3
+    << std::setw(10) << mutex.p99LatencyNs / 1.0e3
+    << std::setw(9) << lockFree.elementsPerSecond / mutex.elementsPerSecond << "x"
+    << std::endl;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int numElements(argc > 1 ? (unsigned int)atoi(argv[1]) : 1000000U);
+  const unsigned int capacity(argc > 2 ? (unsigned int)atoi(argv[2]) : 1024U);
+  const unsigned int maxNumThreads(argc > 3 ? (unsigned int)atoi(argv[3]) : 32U);
+
+  std::cout << "Producer/consumer pipelines (" << numElements << " elements per run, capacity "
+    << capacity << ")" << std::endl;
+  std::cout << "         SConcurrentQueue                  mutex + SQueue" << std::endl;
+  std::cout << "  P:C    Mel/s   p50(us)   p99(us)      Mel/s   p50(us)   p99(us)  speed-up"
+    << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  for (unsigned int numThreads = 1U; numThreads <= maxNumThreads; numThreads *= 2U)
+  {
+    report(numThreads, numThreads, numElements, capacity);
+
+    if (numThreads > 1U)
+    {
+      report(numThreads, 1U, numElements, capacity);
+      report(1U, numThreads, numElements, capacity);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,206 @@
+// ============================================================================================
+//
+// benchdarray.cpp -- DArray Growth vs. std::vector & SArray Regrowth Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures the time per element of appending elements one at a time to an empty
+array that has to keep growing.  Three arrays are compared:
+
+  DArray       "append()" -- "realloc()" for "int", move construction for "std::string"
+  std::vector  "push_back()"
+  SArray       the pattern that "DArray" replaces:  when the array is full, allocate an
+               "SArray" twice the size, copy the elements into it and delete the old one
+
+Usage:  benchdarray [elements [rounds]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <dstructs/darray.h>
+#include <dstructs/sarray.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> static const double appendToDArray
+(
+  const std::vector<T>& elements,                       // the elements to append
+  const unsigned int    rounds                          // no. of times to build the array
+)
+
+/*
+This function returns the average time, in nanoseconds, to append one element to a "DArray".
+*/
+
+{
+  size_t    checksum(0U);
+  Stopwatch stopwatch;
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+  {
+    DArray<T> array;
+
+    for (unsigned int i = 0U; i < elements.size(); ++i)
+      array.append(elements[i]);
+
+    checksum += array.numElements();
+  }
+
+  const double elapsed = stopwatch.elapsedNs();
+
+  if (checksum != (size_t)rounds * elements.size())
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return elapsed / ((double)rounds * elements.size());
+}
+
+/*********************************************************************************************/
+
+template<class T> static const double appendToVector
+(
+  const std::vector<T>& elements,                       // the elements to append
+  const unsigned int    rounds                          // no. of times to build the array
+)
+
+/*
+This function returns the average time, in nanoseconds, to append one element to a
+"std::vector".
+*/
+
+{
+  size_t    checksum(0U);
+  Stopwatch stopwatch;
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+  {
+    std::vector<T> array;
+
+    for (unsigned int i = 0U; i < elements.size(); ++i)
+      array.push_back(elements[i]);
+
+    checksum += array.size();
+  }
+
+  const double elapsed = stopwatch.elapsedNs();
+
+  if (checksum != (size_t)rounds * elements.size())
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return elapsed / ((double)rounds * elements.size());
+}
+
+/*********************************************************************************************/
+
+template<class T> static const double appendToSArray
+(
+  const std::vector<T>& elements,                       // the elements to append
+  const unsigned int    rounds                          // no. of times to build the array
+)
+
+/*
+This function returns the average time, in nanoseconds, to append one element to an "SArray"
+that's replaced by one twice its size (with the elements copied over) whenever it's full.
+*/
+
+{
+  size_t    checksum(0U);
+  Stopwatch stopwatch;
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+  {
+    SArray<T>*   array = new SArray<T>(8U);
+    unsigned int count(0U);
+
+    for (unsigned int i = 0U; i < elements.size(); ++i)
+    {
+      if (count == array->numElements())
+      {
+        SArray<T> *const bigger = new SArray<T>(count * 2U);
+
+        for (unsigned int j = 0U; j < count; ++j)
+          (*bigger)[j] = (*array)[j];
+
+        delete array;
+        array = bigger;
+      }
+
+      (*array)[count++] = elements[i];
+    }
+
+    checksum += count;
+    delete array;
+  }
+
+  const double elapsed = stopwatch.elapsedNs();
+
+  if (checksum != (size_t)rounds * elements.size())
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return elapsed / ((double)rounds * elements.size());
+}
+
+/*********************************************************************************************/
+
+template<class T> static void report
+(
+  const char *const     name,                           // the element type's name
+  const std::vector<T>& elements,                       // the elements to append
+  const unsigned int    rounds                          // no. of times to build each array
+)
+
+{
+  std::cout << "  " << std::left << std::setw(13) << name << std::right
+    << std::setw(10) << appendToDArray(elements, rounds)
+    << std::setw(13) << appendToVector(elements, rounds)
+    << std::setw(10) << appendToSArray(elements, rounds) << std::endl;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int numElements(argc > 1 ? (unsigned int)atoi(argv[1]) : 1000000U);
+  const unsigned int rounds(argc > 2 ? (unsigned int)atoi(argv[2]) : 10U);
+
+  std::vector<int>         ints(numElements);
+  std::vector<std::string> strings(numElements);
+
+  for (unsigned int i = 0U; i < numElements; ++i)
+  {
+    ints[i]    = (int)i;
+    strings[i] = "element #" + std::to_string(i) + " (long enough to be on the heap)";
+  }
+
+  std::cout << "Appending " << numElements << " elements to an empty array (" << rounds
+    << " rounds)" << std::endl;
+  std::cout << "  ns per element:  DArray  std::vector    SArray" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  report("int", ints, rounds);
+  report("std::string", strings, rounds);
+
+  return 0;
+}
@@ -0,0 +1,282 @@
+// ============================================================================================
+//
+// benchddoublylinkedlist.cpp -- DDoublyLinkedList LRU Cache Benchmark
+//
+// ============================================================================================
+
+/*
+This program simulates an LRU cache of "capacity" entries, from 1,024 up to "max. capacity"
+entries (quadrupling each time), with three different lists holding the entries in order of
+use.  Each access is to a random key out of twice as many keys as there are entries, so about
+half of the accesses are hits.  A hit moves its entry to the front of the list and a miss
+evicts the entry at the back and adds the new one at the front.
+
+  DDoublyLinkedList  each key's handle (an element iterator) is kept in a table, so a hit is a
+                     "moveToFront()" and a miss a "popBack()" and a "pushFront()"
+  std::list          the same, with "splice()", "pop_back()" and "push_front()"
+  rescan             a singly-linked "std::forward_list" with no handles -- every access
+                     searches the list for its key, as a singly-linked list has to
+
+"rescan" is only timed for capacities up to "SCAN_LIMIT", since it takes time in proportion to
+the capacity.
+
+Every figure is the average time per access, in nanoseconds.  The three caches' hit counts are
+checked against each other.
+
+Usage:  benchddoublylinkedlist [max. capacity [accesses]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <forward_list>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <dstructs/ddoublylinkedlist.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is what one run reports:  nanoseconds per access and the no. of hits.
+*/
+
+struct Result
+{
+  double       ns;
+  unsigned int numHits;
+};
+
+// ============================================================================================
+// CONSTANTS
+// ============================================================================================
+
+static const unsigned int SCAN_LIMIT = 16U * 1024U;       // largest capacity for rescanning
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+static const Result runDDoublyLinkedList
+(
+  const unsigned int               capacity,        // the no. of entries in the cache
+  const std::vector<unsigned int>& accesses         // the keys to access, in order
+)
+
+/*
+This function runs the accesses on a "DDoublyLinkedList" cache.  A key's handle is "end()" if
+the key isn't cached.
+*/
+
+{
+  typedef DDoublyLinkedList<unsigned int> Cache;
+
+  Cache                               cache;
+  std::vector<Cache::ElementIterator> handles(2U * capacity, cache.end());
+  unsigned int                        evicted;
+  Result                              result;
+
+  for (unsigned int key = 0U; key < capacity; ++key)
+  {
+    cache.pushFront(key);
+    handles[key] = cache.begin();
+  }
+
+  result.numHits = 0U;
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < accesses.size(); ++i)
+  {
+    const unsigned int key = accesses[i];
+
+    if (handles[key] != cache.end())
+    {
+      cache.moveToFront(handles[key]);
+      ++result.numHits;
+    }
+    else
+    {
+      cache.popBack(evicted);
+      handles[evicted] = cache.end();
+      cache.pushFront(key);
+      handles[key] = cache.begin();
+    }
+  }
+
+  result.ns = stopwatch.elapsedNs() / accesses.size();
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runStdList
+(
+  const unsigned int               capacity,        // the no. of entries in the cache
+  const std::vector<unsigned int>& accesses         // the keys to access, in order
+)
+
+/*
+This function runs the accesses on a "std::list" cache.
+*/
+
+{
+  typedef std::list<unsigned int> Cache;
+
+  Cache                        cache;
+  std::vector<Cache::iterator> handles(2U * capacity, cache.end());
+  Result                       result;
+
+  for (unsigned int key = 0U; key < capacity; ++key)
+  {
+    cache.push_front(key);
+    handles[key] = cache.begin();
+  }
+
+  result.numHits = 0U;
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < accesses.size(); ++i)
+  {
+    const unsigned int key = accesses[i];
+
+    if (handles[key] != cache.end())
+    {
+      cache.splice(cache.begin(), cache, handles[key]);
+      ++result.numHits;
+    }
+    else
+    {
+      handles[cache.back()] = cache.end();
+      cache.pop_back();
+      cache.push_front(key);
+      handles[key] = cache.begin();
+    }
+  }
+
+  result.ns = stopwatch.elapsedNs() / accesses.size();
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runRescan
+(
+  const unsigned int               capacity,        // the no. of entries in the cache
+  const std::vector<unsigned int>& accesses         // the keys to access, in order
+)
+
+/*
+This function runs the accesses on a "std::forward_list" cache without handles.  Every access
+walks the list for its key, keeping track of the node before it so that the key's node can be
+unlinked and moved to the front.  A miss walks the whole list and evicts the last node, which
+it has just passed.
+*/
+
+{
+  typedef std::forward_list<unsigned int> Cache;
+
+  Cache  cache;
+  Result result;
+
+  for (unsigned int key = 0U; key < capacity; ++key)
+    cache.push_front(key);
+
+  result.numHits = 0U;
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < accesses.size(); ++i)
+  {
+    const unsigned int key = accesses[i];
+    Cache::iterator    previous(cache.before_begin());
+    Cache::iterator    current(cache.begin());
+    Cache::iterator    beforeLast(cache.before_begin());
+
+    while (current != cache.end() && *current != key)
+    {
+      beforeLast = previous;
+      previous   = current++;
+    }
+
+    if (current != cache.end())
+    {
+      cache.splice_after(cache.before_begin(), cache, previous);
+      ++result.numHits;
+    }
+    else
+    {
+      cache.erase_after(beforeLast);
+      cache.push_front(key);
+    }
+  }
+
+  result.ns = stopwatch.elapsedNs() / accesses.size();
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int maxCapacity = argc > 1 ? (unsigned int)atoi(argv[1]) : 4U * 1024U * 1024U;
+  const unsigned int numAccesses = argc > 2 ? (unsigned int)atoi(argv[2]) : 1024U * 1024U;
+
+  std::cout << "Time per access in ns (DDoublyLinkedList, std::list, rescan)" << std::endl;
+  std::cout << "     capacity  DDoublyLinkedList  std::list     rescan" << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (unsigned int capacity = 1024U; capacity <= maxCapacity && capacity > 0U;
+    capacity *= 4U)
+  {
+    std::vector<unsigned int> accesses(numAccesses);
+    std::mt19937              random(1U);
+
+    for (unsigned int i = 0U; i < numAccesses; ++i)
+      accesses[i] = (unsigned int)(random() % (2U * capacity));
+
+    const Result list    = runDDoublyLinkedList(capacity, accesses);
+    const Result stdList = runStdList(capacity, accesses);
+
+    std::cout << std::setw(13) << capacity << std::setw(19) << list.ns << std::setw(11)
+      << stdList.ns;
+
+    if (capacity <= SCAN_LIMIT)
+    {
+      const Result rescan = runRescan(capacity, accesses);
+
+      std::cout << std::setw(11) << rescan.ns;
+
+      if (rescan.numHits != list.numHits)
+        std::cerr << "  Hit count mismatch!" << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    if (stdList.numHits != list.numHits)
+      std::cerr << "  Hit count mismatch!" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,281 @@
+// ============================================================================================
+//
+// benchdskiplist.cpp -- DSkipList Positional Access Benchmark
+//
+// ============================================================================================
+
+/*
+This program times positional operations on lists of "count" elements, from 1,024 up to
+"max. count" elements (quadrupling each time):
+
+  access  "operator[]()" with a random index
+  update  an insertion at a random index followed by a removal at another random index, so
+          that the list stays the same length
+
+on three kinds of list:
+
+  DSkipList          O(log n) expected time for both
+  std::vector        constant time to access, but an update shifts half the elements (on
+                     average) twice
+  DDoublyLinkedList  walks from the front to the index, as a linked list without an index has
+                     to (its own update is then constant time)
+
+The linked list is only timed for counts up to "WALK_LIMIT", since it takes time in proportion
+to the count.
+
+Every figure is the average time per operation, in nanoseconds.  The lists' sums (of the
+accessed elements, and of all the elements after the updates) are checked against each other.
+
+Usage:  benchdskiplist [max. count [operations]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <dstructs/ddoublylinkedlist.h>
+#include <dstructs/dskiplist.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is what one run reports:  nanoseconds per access and per update, and the checksums.
+*/
+
+struct Result
+{
+  double             accessNs;
+  double             updateNs;
+  unsigned long long accessSum;
+  unsigned long long finalSum;
+};
+
+// ============================================================================================
+// CONSTANTS
+// ============================================================================================
+
+static const unsigned int WALK_LIMIT = 4U * 1024U;           // largest count for walking
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+static const Result runDSkipList
+(
+  const unsigned int               count,         // the no. of elements in the list
+  const std::vector<unsigned int>& indices        // random indices below "count"
+)
+
+/*
+This function runs the operations on a "DSkipList".
+*/
+
+{
+  DSkipList<unsigned int> list;
+  Result                  result;
+
+  for (unsigned int i = 0U; i < count; ++i)
+    list.insert(i, i);
+
+  result.accessSum = 0U;
+
+  Stopwatch accessStopwatch;
+
+  for (unsigned int i = 0U; i < indices.size(); ++i)
+    result.accessSum += list[indices[i]];
+
+  result.accessNs = accessStopwatch.elapsedNs() / indices.size();
+
+  Stopwatch updateStopwatch;
+
+  for (unsigned int i = 0U; i + 1U < indices.size(); i += 2U)
+  {
+    list.insert(indices[i], i);
+    list.remove(indices[i + 1U]);
+  }
+
+  result.updateNs = updateStopwatch.elapsedNs() / (indices.size() / 2U);
+  result.finalSum = 0U;
+
+  for (DSkipList<unsigned int>::ConstElementIterator element = list.begin();
+    element != list.end(); ++element)
+  {
+    result.finalSum += *element;
+  }
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runStdVector
+(
+  const unsigned int               count,         // the no. of elements in the list
+  const std::vector<unsigned int>& indices        // random indices below "count"
+)
+
+/*
+This function runs the operations on a "std::vector".
+*/
+
+{
+  std::vector<unsigned int> list;
+  Result                    result;
+
+  for (unsigned int i = 0U; i < count; ++i)
+    list.push_back(i);
+
+  result.accessSum = 0U;
+
+  Stopwatch accessStopwatch;
+
+  for (unsigned int i = 0U; i < indices.size(); ++i)
+    result.accessSum += list[indices[i]];
+
+  result.accessNs = accessStopwatch.elapsedNs() / indices.size();
+
+  Stopwatch updateStopwatch;
+
+  for (unsigned int i = 0U; i + 1U < indices.size(); i += 2U)
+  {
+    list.insert(list.begin() + indices[i], i);
+    list.erase(list.begin() + indices[i + 1U]);
+  }
+
+  result.updateNs = updateStopwatch.elapsedNs() / (indices.size() / 2U);
+  result.finalSum = 0U;
+
+  for (unsigned int i = 0U; i < list.size(); ++i)
+    result.finalSum += list[i];
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runDDoublyLinkedList
+(
+  const unsigned int               count,         // the no. of elements in the list
+  const std::vector<unsigned int>& indices        // random indices below "count"
+)
+
+/*
+This function runs the operations on a "DDoublyLinkedList", walking from the front to each
+index.
+*/
+
+{
+  typedef DDoublyLinkedList<unsigned int> List;
+
+  List   list;
+  Result result;
+
+  for (unsigned int i = 0U; i < count; ++i)
+    list.pushBack(i);
+
+  result.accessSum = 0U;
+
+  Stopwatch accessStopwatch;
+
+  for (unsigned int i = 0U; i < indices.size(); ++i)
+  {
+    List::ElementIterator element(list.begin());
+
+    for (unsigned int j = indices[i]; j > 0U; --j)
+      ++element;
+
+    result.accessSum += *element;
+  }
+
+  result.accessNs = accessStopwatch.elapsedNs() / indices.size();
+
+  Stopwatch updateStopwatch;
+
+  for (unsigned int i = 0U; i + 1U < indices.size(); i += 2U)
+  {
+    List::ElementIterator element(list.begin());
+
+    for (unsigned int j = indices[i]; j > 0U; --j)
+      ++element;
+
+    list.insert(element, i);
+    element = list.begin();
+
+    for (unsigned int j = indices[i + 1U]; j > 0U; --j)
+      ++element;
+
+    list.remove(element);
+  }
+
+  result.updateNs = updateStopwatch.elapsedNs() / (indices.size() / 2U);
+  result.finalSum = 0U;
+
+  for (List::ConstElementIterator element = list.begin(); element != list.end(); ++element)
+    result.finalSum += *element;
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int maxCount      = argc > 1 ? (unsigned int)atoi(argv[1]) : 1024U * 1024U;
+  const unsigned int numOperations = argc > 2 ? (unsigned int)atoi(argv[2]) : 256U * 1024U;
+
+  std::cout << "Time per operation in ns (access, update)" << std::endl;
+  std::cout << "        count           DSkipList         std::vector   DDoublyLinkedList"
+    << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (unsigned int count = 1024U; count <= maxCount && count > 0U; count *= 4U)
+  {
+    std::vector<unsigned int> indices(numOperations);
+    std::mt19937              random(1U);
+
+    for (unsigned int i = 0U; i < numOperations; ++i)
+      indices[i] = (unsigned int)(random() % count);
+
+    const Result skipList = runDSkipList(count, indices);
+    const Result vector   = runStdVector(count, indices);
+
+    std::cout << std::setw(13) << count << std::setw(10) << skipList.accessNs << std::setw(10)
+      << skipList.updateNs << std::setw(10) << vector.accessNs << std::setw(10)
+      << vector.updateNs;
+
+    if (count <= WALK_LIMIT)
+    {
+      const Result list = runDDoublyLinkedList(count, indices);
+
+      std::cout << std::setw(10) << list.accessNs << std::setw(10) << list.updateNs;
+
+      if (list.accessSum != skipList.accessSum || list.finalSum != skipList.finalSum)
+        std::cerr << "  Checksum mismatch!" << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    if (vector.accessSum != skipList.accessSum || vector.finalSum != skipList.finalSum)
+      std::cerr << "  Checksum mismatch!" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,225 @@
+// ============================================================================================
+//
+// benchgraph.cpp -- Graph (CSR) Breadth-First Search Benchmark
+//
+// ============================================================================================
+
+/*
+This program builds a random undirected graph -- as a "Graph" and as a pointer-based adjacency
+list (a "std::list" of neighbours per vertex) -- and times a breadth-first search of each from
+the same source vertices.  The "Graph" is searched on 1, 2, 4 ... up to the no. of hardware
+threads.
+
+Most of the edges join vertices whose nos. are close together and the rest join random
+vertices, which gives the graph a small diameter (like a dependency graph with some widely
+used vertices) without making it a pure random graph.
+
+The figures are the time to build each representation and the average time per search, in
+milliseconds, and the search rate in millions of edges traversed per second.  Every search is
+checked against the adjacency list's.
+
+Usage:  benchgraph [log2 of the no. of vertices [edges per vertex [no. of searches]]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dstructs/graph.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+The benchmark's vertices and edges don't carry any data.
+*/
+
+struct NoData
+{
+};
+
+typedef Graph<NoData, NoData> PlainGraph;
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+static const unsigned int searchLists
+(
+  const std::vector<std::list<unsigned int> >& lists,     // the adjacency lists
+  const unsigned int                           source,    // the vertex to search from
+  std::vector<unsigned int>&                   depths     // gets each vertex's depth
+)
+
+/*
+This function is a textbook breadth-first search of the adjacency lists with a FIFO queue.  It
+returns the no. of vertices reached.
+*/
+
+{
+  std::vector<unsigned int> queue;
+  unsigned int              head(0U);
+
+  std::fill(depths.begin(), depths.end(), PlainGraph::UNREACHED);
+  depths[source] = 0U;
+  queue.reserve(lists.size());
+  queue.push_back(source);
+
+  while (head < queue.size())
+  {
+    const unsigned int vertex = queue[head++];
+
+    for (std::list<unsigned int>::const_iterator neighbour = lists[vertex].begin();
+      neighbour != lists[vertex].end(); ++neighbour)
+    {
+      if (depths[*neighbour] == PlainGraph::UNREACHED)
+      {
+        depths[*neighbour] = depths[vertex] + 1U;
+        queue.push_back(*neighbour);
+      }
+    }
+  }
+
+  return (unsigned int)queue.size();
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int logVertices = argc > 1 ? (unsigned int)atoi(argv[1]) : 20U;
+  const unsigned int perVertex   = argc > 2 ? (unsigned int)atoi(argv[2]) : 8U;
+  const unsigned int numSearches = argc > 3 ? (unsigned int)atoi(argv[3]) : 8U;
+  const unsigned int numVertices = 1U << logVertices;
+  const unsigned int maxThreads  = std::thread::hardware_concurrency() > 0U ?
+                                   std::thread::hardware_concurrency() : 1U;
+
+  std::mt19937                                        random(1U);
+  std::vector<std::pair<unsigned int, unsigned int> > pairs(numVertices * perVertex / 2U);
+  std::vector<std::list<unsigned int> >               lists(numVertices);
+
+  for (unsigned int i = 0U; i < pairs.size(); ++i)
+  {
+    const unsigned int from = (unsigned int)(random() % numVertices);
+    const unsigned int to   = random() % 8U == 0U ? (unsigned int)(random() % numVertices) :
+                              (from + 1U + (unsigned int)(random() % 1024U)) % numVertices;
+
+    pairs[i] = std::make_pair(from, to);
+  }
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << numVertices << " vertices, " << 2U * pairs.size() << " edges" << std::endl;
+
+  /*
+  Each representation's build time covers adding the edges to it one at a time -- for the
+  "Graph", that's filling the builder and then building the graph from it.
+  */
+
+  Stopwatch           stopwatch;
+  PlainGraph::Builder builder(numVertices);
+
+  builder.reserveEdges(2U * (unsigned int)pairs.size());
+
+  for (unsigned int i = 0U; i < pairs.size(); ++i)
+  {
+    builder.addEdge(pairs[i].first, pairs[i].second);
+    builder.addEdge(pairs[i].second, pairs[i].first);
+  }
+
+  const PlainGraph graph(builder);
+
+  std::cout << "  build (ms):  Graph " << stopwatch.elapsedNs() / 1e6;
+
+  builder.empty();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < pairs.size(); ++i)
+  {
+    lists[pairs[i].first].push_back(pairs[i].second);
+    lists[pairs[i].second].push_back(pairs[i].first);
+  }
+
+  std::cout << ", adjacency lists " << stopwatch.elapsedNs() / 1e6 << std::endl;
+
+  std::vector<unsigned int> sources(numSearches);
+  std::vector<unsigned int> expected(numVertices);
+  std::vector<unsigned int> depths(numVertices);
+  std::vector<unsigned int> numReached(numSearches);
+  std::vector<unsigned int> checksums(numSearches);
+
+  for (unsigned int i = 0U; i < numSearches; ++i)
+    sources[i] = (unsigned int)(random() % numVertices);
+
+  std::cout << "  search (ms per search, millions of edges per second):" << std::endl;
+
+  double totalNs(0.0);
+
+  for (unsigned int i = 0U; i < numSearches; ++i)
+  {
+    stopwatch.restart();
+    numReached[i] = searchLists(lists, sources[i], expected);
+    totalNs      += stopwatch.elapsedNs();
+
+    checksums[i] = 0U;
+
+    for (unsigned int vertex = 0U; vertex < numVertices; ++vertex)
+      checksums[i] += expected[vertex] * (vertex % 7U + 1U);
+  }
+
+  std::cout << "    adjacency lists   " << std::setw(9) << totalNs / numSearches / 1e6
+    << std::setw(10) << graph.numEdges() * (double)numSearches / totalNs * 1e3 << std::endl;
+
+  for (unsigned int numThreads = 1U; ; numThreads = std::min(2U * numThreads, maxThreads))
+  {
+    totalNs = 0.0;
+
+    for (unsigned int i = 0U; i < numSearches; ++i)
+    {
+      stopwatch.restart();
+
+      const unsigned int reached = graph.breadthFirstSearch(sources[i], depths.data(),
+        numThreads);
+
+      totalNs += stopwatch.elapsedNs();
+
+      unsigned int checksum(0U);
+
+      for (unsigned int vertex = 0U; vertex < numVertices; ++vertex)
+        checksum += depths[vertex] * (vertex % 7U + 1U);
+
+      if (reached != numReached[i] || checksum != checksums[i])
+        std::cerr << "  Mismatch!" << std::endl;
+    }
+
+    std::cout << "    Graph, " << std::setw(2) << numThreads << " thread"
+      << (numThreads == 1U ? " " : "s") << "  " << std::setw(9)
+      << totalNs / numSearches / 1e6 << std::setw(10)
+      << graph.numEdges() * (double)numSearches / totalNs * 1e3 << std::endl;
+
+    if (numThreads == maxThreads)
+      break;
+  }
+
+  return 0;
+}
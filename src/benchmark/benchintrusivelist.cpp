@@ -0,0 +1,238 @@
+// ============================================================================================
+//
+// benchintrusivelist.cpp -- IntrusiveList Churn Benchmark
+//
+// ============================================================================================
+
+/*
+This program simulates a connection table:  "count" connection objects (from 1,024 up to
+"max. count", quadrupling each time) that live in an array, each of which is on either an
+"active" list or an "idle" list.  Every step picks a random connection and moves it from the
+list that it's on to the back of the other one, the way connections churn between states.
+Three kinds of list are timed:
+
+  IntrusiveList      the lists are linked through hooks in the connections, so a step is a
+                     "remove()" and a "pushBack()" with no allocation
+  DDoublyLinkedList  the lists hold pointers to the connections (each of which keeps a handle
+                     to its node), so a step deletes a node and allocates one from the pool
+  std::list          the same, with every node coming from the heap
+
+Every figure is the average time per step, in nanoseconds.  The lists' lengths at the end are
+checked against each other.
+
+Usage:  benchintrusivelist [max. count [steps]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <dstructs/ddoublylinkedlist.h>
+#include <dstructs/intrusivelist.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+A "Connection" carries a hook for the intrusive lists and a handle for each of the other two
+kinds of list, so that it can be found in the list that it's on without a search.  "payload"
+stands in for the rest of a connection's state.
+*/
+
+struct Connection:
+  public ListHook<>
+{
+  bool                                            isActive;
+  DDoublyLinkedList<Connection*>::ElementIterator listHandle;
+  std::list<Connection*>::iterator                stdListHandle;
+  unsigned char                                   payload[64];
+};
+
+/*
+This is what one run reports:  nanoseconds per step and the no. of active connections at the
+end.
+*/
+
+struct Result
+{
+  double       ns;
+  unsigned int numActive;
+};
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+static const Result runIntrusiveList
+(
+  std::vector<Connection>&         connections,     // the connection table
+  const std::vector<unsigned int>& steps            // the connection to move at each step
+)
+
+/*
+This function runs the steps with the connections on "IntrusiveList"s.
+*/
+
+{
+  IntrusiveList<Connection> lists[2];                      // the idle & active lists
+  Result                    result;
+
+  for (unsigned int i = 0U; i < connections.size(); ++i)
+  {
+    connections[i].isActive = false;
+    lists[0].pushBack(connections[i]);
+  }
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < steps.size(); ++i)
+  {
+    Connection& connection = connections[steps[i]];
+
+    lists[connection.isActive].remove(connection);
+    connection.isActive = !connection.isActive;
+    lists[connection.isActive].pushBack(connection);
+  }
+
+  result.ns        = stopwatch.elapsedNs() / steps.size();
+  result.numActive = lists[1].numElements();
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runDDoublyLinkedList
+(
+  std::vector<Connection>&         connections,     // the connection table
+  const std::vector<unsigned int>& steps            // the connection to move at each step
+)
+
+/*
+This function runs the steps with pointers to the connections on "DDoublyLinkedList"s.  The
+two lists share a pool, so a node that one list deletes is reused by the other.
+*/
+
+{
+  DDoublyLinkedList<Connection*> lists[2];                 // the idle & active lists
+  Result                         result;
+
+  lists[1].sharePool(lists[0]);
+
+  for (unsigned int i = 0U; i < connections.size(); ++i)
+  {
+    connections[i].isActive = false;
+    lists[0].pushBack(&connections[i]);
+    connections[i].listHandle = --lists[0].end();
+  }
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < steps.size(); ++i)
+  {
+    Connection& connection = connections[steps[i]];
+
+    lists[connection.isActive].remove(connection.listHandle);
+    connection.isActive = !connection.isActive;
+    lists[connection.isActive].pushBack(&connection);
+    connection.listHandle = --lists[connection.isActive].end();
+  }
+
+  result.ns        = stopwatch.elapsedNs() / steps.size();
+  result.numActive = lists[1].numElements();
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runStdList
+(
+  std::vector<Connection>&         connections,     // the connection table
+  const std::vector<unsigned int>& steps            // the connection to move at each step
+)
+
+/*
+This function runs the steps with pointers to the connections on "std::list"s.
+*/
+
+{
+  std::list<Connection*> lists[2];                         // the idle & active lists
+  Result                 result;
+
+  for (unsigned int i = 0U; i < connections.size(); ++i)
+  {
+    connections[i].isActive = false;
+    lists[0].push_back(&connections[i]);
+    connections[i].stdListHandle = --lists[0].end();
+  }
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < steps.size(); ++i)
+  {
+    Connection& connection = connections[steps[i]];
+
+    lists[connection.isActive].erase(connection.stdListHandle);
+    connection.isActive = !connection.isActive;
+    lists[connection.isActive].push_back(&connection);
+    connection.stdListHandle = --lists[connection.isActive].end();
+  }
+
+  result.ns        = stopwatch.elapsedNs() / steps.size();
+  result.numActive = (unsigned int)lists[1].size();
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int maxCount = argc > 1 ? (unsigned int)atoi(argv[1]) : 1024U * 1024U;
+  const unsigned int numSteps = argc > 2 ? (unsigned int)atoi(argv[2]) : 4U * 1024U * 1024U;
+
+  std::cout << "Time per step in ns" << std::endl;
+  std::cout << "        count  IntrusiveList  DDoublyLinkedList  std::list" << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (unsigned int count = 1024U; count <= maxCount && count > 0U; count *= 4U)
+  {
+    std::vector<Connection>   connections(count);
+    std::vector<unsigned int> steps(numSteps);
+    std::mt19937              random(1U);
+
+    for (unsigned int i = 0U; i < numSteps; ++i)
+      steps[i] = (unsigned int)(random() % count);
+
+    const Result intrusive = runIntrusiveList(connections, steps);
+    const Result list      = runDDoublyLinkedList(connections, steps);
+    const Result stdList   = runStdList(connections, steps);
+
+    std::cout << std::setw(13) << count << std::setw(15) << intrusive.ns << std::setw(19)
+      << list.ns << std::setw(11) << stdList.ns << std::endl;
+
+    if (list.numActive != intrusive.numActive || stdList.numActive != intrusive.numActive)
+      std::cerr << "  Count mismatch!" << std::endl;
+  }
+
+  return 0;
+}
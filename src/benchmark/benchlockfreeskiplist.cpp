@@ -0,0 +1,193 @@
+// ============================================================================================
+//
+// benchlockfreeskiplist.cpp -- Lock-Free Skip List vs. Mutex-Guarded AVL Tree Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures the throughput of a "DLockFreeSkipList<unsigned int>" shared by 1 to N
+threads, and of an "AVLTree<unsigned int>" guarded by a "std::mutex" shared the same way.
+Each set starts out holding every other key in the key range, and every thread runs its own
+random sequence of operations on random keys.  There are two mixes:
+
+  read-heavy   90% "contains()", 5% "insert()", 5% "remove()"
+  write-heavy  50% "insert()", 50% "remove()"
+
+Inserts and removes are equally likely, so the sets stay about half full.  Every thread counts
+the operations that return true, so that none of them can be optimized away.
+
+The thread counts are the powers of two up to N, which defaults to 64 (more threads than there
+are hardware threads just shows how each set copes with preemption).  The two sets' counts of
+successful operations are checked against each other when there's only one thread (with more
+threads the interleavings differ).
+
+Usage:  benchlockfreeskiplist [operations per thread [key range [max. no. of threads]]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <dstructs/avltree.h>
+#include <dstructs/dlockfreeskiplist.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is the baseline:  an "AVLTree" with every operation done under one lock.
+*/
+
+class MutexAVLTree
+{
+  public:
+    const bool         insert(const unsigned int key)
+                         {const std::lock_guard<std::mutex> lock(_mutex);
+                           return _tree.insert(key);}
+    const bool         remove(const unsigned int key)
+                         {const std::lock_guard<std::mutex> lock(_mutex);
+                           return _tree.remove(key);}
+    const bool         contains(const unsigned int key)
+                         {const std::lock_guard<std::mutex> lock(_mutex);
+                           return _tree.contains(key);}
+    const unsigned int numElements() const
+                         {return _tree.numElements();}
+
+  private:
+    std::mutex            _mutex;
+    AVLTree<unsigned int> _tree;
+};
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class SharedSet> static const double throughput
+(
+  SharedSet&         set,                                     // the set that the threads share
+  const unsigned int numThreads,                              // no. of threads to run
+  const unsigned int numOperations,                           // no. of operations per thread
+  const unsigned int keyRange,                                // keys are below this
+  const unsigned int readPercentage,                          // % of operations that are reads
+  unsigned long&     numSucceeded                             // gets no. of true results
+)
+
+/*
+This function fills "set" with every other key and then returns the number of operations per
+second that "numThreads" threads complete together on it.  Each thread's keys and operations
+come from a generator seeded with its thread number, so both sets get the same sequences.
+"numSucceeded" gets the total no. of operations that returned true.
+*/
+
+{
+  for (unsigned int key = 0U; key < keyRange; key += 2U)
+    set.insert(key);
+
+  std::vector<std::thread>   threads;
+  std::vector<unsigned long> successes(numThreads, 0UL);
+  Stopwatch                  stopwatch;
+
+  for (unsigned int thread = 0U; thread < numThreads; ++thread)
+  {
+    threads.emplace_back([&set, &successes, thread, numOperations, keyRange, readPercentage]
+    {
+      std::mt19937  random(thread + 1U);
+      unsigned long numSucceeded(0UL);
+
+      for (unsigned int operation = 0U; operation < numOperations; ++operation)
+      {
+        const unsigned int key(random() % keyRange);
+        const unsigned int dice(random() % 100U);
+
+        if (dice < readPercentage)
+          numSucceeded += set.contains(key);
+        else if ((dice - readPercentage) % 2U == 0U)
+          numSucceeded += set.insert(key);
+        else
+          numSucceeded += set.remove(key);
+      }
+
+      successes[thread] = numSucceeded;
+    });
+  }
+
+  for (unsigned int thread = 0U; thread < numThreads; ++thread)
+    threads[thread].join();
+
+  stopwatch.pause();
+
+  numSucceeded = 0UL;
+
+  for (unsigned int thread = 0U; thread < numThreads; ++thread)
+    numSucceeded += successes[thread];
+
+  return (double)numThreads * numOperations / (stopwatch.elapsedNs() / 1.0e9);
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int numOperations(argc > 1 ? (unsigned int)atoi(argv[1]) : 1000000U);
+  const unsigned int keyRange(argc > 2 ? (unsigned int)atoi(argv[2]) : 1024U * 1024U);
+  const unsigned int maxNumThreads(argc > 3 ? (unsigned int)atoi(argv[3]) : 64U);
+  const unsigned int readPercentages[] = {90U, 0U};
+  const char *const  mixNames[]        = {"Read-heavy", "Write-heavy"};
+
+  std::cout << std::fixed << std::setprecision(2);
+
+  for (unsigned int mix = 0U; mix < 2U; ++mix)
+  {
+    std::cout << mixNames[mix] << " (" << numOperations
+      << " operations per thread, keys below " << keyRange << ")" << std::endl;
+    std::cout << "  threads   DLockFreeSkipList (Mops/s)   mutex + AVLTree (Mops/s)   speed-up"
+      << std::endl;
+
+    for (unsigned int numThreads = 1U; numThreads <= maxNumThreads && numThreads > 0U;
+      numThreads *= 2U)
+    {
+      DLockFreeSkipList<unsigned int> skipList;
+      MutexAVLTree                    tree;
+      unsigned long                   skipListSucceeded;
+      unsigned long                   treeSucceeded;
+
+      const double skipListOps(throughput(skipList, numThreads, numOperations, keyRange,
+        readPercentages[mix], skipListSucceeded));
+      const double treeOps(throughput(tree, numThreads, numOperations, keyRange,
+        readPercentages[mix], treeSucceeded));
+
+      std::cout << std::setw(9) << numThreads << std::setw(29) << skipListOps / 1.0e6
+        << std::setw(27) << treeOps / 1.0e6 << std::setw(10) << skipListOps / treeOps << "x"
+        << std::endl;
+
+      if (numThreads == 1U && (skipListSucceeded != treeSucceeded ||
+        skipList.numElements() != tree.numElements()))
+      {
+        std::cerr << "  Result mismatch!" << std::endl;
+      }
+    }
+
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,151 @@
+// ============================================================================================
+//
+// benchlockfreestack.cpp -- Lock-Free Stack vs. Mutex-Guarded Stack Throughput Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures the combined push/pop throughput of a "DLockFreeStack<int>" shared by 1
+to N threads, and of a "DStack<int>" guarded by a "std::mutex" shared the same way.  Every
+thread pushes an element and then pops one, over and over, so the stacks stay small and every
+operation contends for the top.
+
+N defaults to the number of hardware threads.
+
+Usage:  benchlockfreestack [operations per thread [max. no. of threads]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <dstructs/dlockfreestack.h>
+#include <dstructs/dstack.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is the baseline:  a "DStack" with every operation done under one lock.
+*/
+
+class MutexDStack
+{
+  public:
+    void push(const int element)
+           {const std::lock_guard<std::mutex> lock(_mutex); _stack.push(element); return;}
+    void pop(int& element)
+           {const std::lock_guard<std::mutex> lock(_mutex); _stack.pop(element); return;}
+
+  private:
+    std::mutex  _mutex;
+    DStack<int> _stack;
+};
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class SharedStack> static const double pushPopThroughput
+(
+  SharedStack&       stack,                                 // the stack that the threads share
+  const unsigned int numThreads,                            // no. of threads to run
+  const unsigned int numOperations                          // no. of push/pop pairs per thread
+)
+
+/*
+This function returns the number of operations (pushes plus pops) per second that "numThreads"
+threads complete together on "stack".  Since each thread pushes before it pops, "stack" can
+never be empty when a pop is attempted.
+*/
+
+{
+  std::vector<std::thread> threads;
+  std::vector<long>        checksums(numThreads, 0L);
+  Stopwatch                stopwatch;
+
+  for (unsigned int thread = 0U; thread < numThreads; ++thread)
+  {
+    threads.emplace_back([&stack, &checksums, thread, numOperations]
+    {
+      long checksum(0L);
+
+      for (unsigned int operation = 0U; operation < numOperations; ++operation)
+      {
+        int element;
+
+        stack.push((int)operation);
+        stack.pop(element);
+        checksum += element;
+      }
+
+      checksums[thread] = checksum;
+    });
+  }
+
+  for (unsigned int thread = 0U; thread < numThreads; ++thread)
+    threads[thread].join();
+
+  stopwatch.pause();
+
+  long checksum(0L);
+
+  for (unsigned int thread = 0U; thread < numThreads; ++thread)
+    checksum += checksums[thread];
+
+  if (checksum != (long)numThreads * numOperations * (numOperations - 1L) / 2L)
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return 2.0 * numThreads * numOperations / (stopwatch.elapsedNs() / 1.0e9);
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int numOperations(argc > 1 ? (unsigned int)atoi(argv[1]) : 1000000U);
+  const unsigned int maxNumThreads(argc > 2 ? (unsigned int)atoi(argv[2]) :
+    (std::thread::hardware_concurrency() > 0U ? std::thread::hardware_concurrency() : 4U));
+
+  std::cout << "Push/pop pairs on a shared stack (" << numOperations << " pairs per thread)"
+    << std::endl;
+  std::cout << "  threads   DLockFreeStack (Mops/s)   mutex + DStack (Mops/s)   speed-up"
+    << std::endl;
+
+  /*
+  The thread counts are the powers of two below "maxNumThreads", then "maxNumThreads" itself.
+  */
+
+  for (unsigned int numThreads = 1U; numThreads <= maxNumThreads;
+    numThreads = (numThreads < maxNumThreads && numThreads * 2U > maxNumThreads) ?
+    maxNumThreads : numThreads * 2U)
+  {
+    DLockFreeStack<int> lockFreeStack;
+    MutexDStack         mutexStack;
+
+    const double lockFreeOps(pushPopThroughput(lockFreeStack, numThreads, numOperations));
+    const double mutexOps(pushPopThroughput(mutexStack, numThreads, numOperations));
+
+    std::cout << "  " << numThreads << "\t    " << lockFreeOps / 1.0e6 << "\t\t      "
+      << mutexOps / 1.0e6 << "\t\t\t" << lockFreeOps / mutexOps << "x" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+// ============================================================================================
+//
+// benchnodepool.cpp -- Pooled vs. Unpooled Node Allocation Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures push/pop churn on a "DStack<int>" with its node pool turned on (the
+default) and turned off ("setNodesPerChunk(0U)").  Each round pushes a batch of elements and
+then pops them all off again, so after the first round the pooled stack never calls the heap.
+
+Usage:  benchnodepool [rounds [batch size]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <dstructs/dstack.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+static const double churn
+(
+  DStack<int>&       stack,                             // the stack to push onto & pop off of
+  const unsigned int rounds,                            // no. of push/pop rounds
+  const unsigned int batchSize                          // no. of elements pushed per round
+)
+
+/*
+This function returns the average time, in nanoseconds, of one push/pop pair.
+*/
+
+{
+  int       poppedElement;
+  long      checksum(0L);
+  Stopwatch stopwatch;
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+  {
+    for (unsigned int i = 0U; i < batchSize; ++i)
+      stack.push((int)i);
+
+    for (unsigned int i = 0U; i < batchSize; ++i)
+    {
+      stack.pop(poppedElement);
+      checksum += poppedElement;
+    }
+  }
+
+  const double elapsed = stopwatch.elapsedNs();
+
+  if (checksum != (long)rounds * batchSize * (batchSize - 1U) / 2L)
+    std::cerr << "  Checksum mismatch!" << std::endl;
+
+  return elapsed / ((double)rounds * batchSize);
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int rounds(argc > 1 ? (unsigned int)atoi(argv[1]) : 1000U);
+  const unsigned int batchSize(argc > 2 ? (unsigned int)atoi(argv[2]) : 10000U);
+
+  DStack<int> pooled;
+  DStack<int> unpooled;
+
+  unpooled.setNodesPerChunk(0U);
+
+  /*
+  One warm-up round each so that the pooled stack's chunks are already allocated -- the
+  steady state is what's being measured.
+  */
+
+  churn(pooled, 1U, batchSize);
+  churn(unpooled, 1U, batchSize);
+
+  const double pooledNs(churn(pooled, rounds, batchSize));
+  const double unpooledNs(churn(unpooled, rounds, batchSize));
+
+  std::cout << "DStack<int> push/pop churn (" << rounds << " rounds x " << batchSize
+    << " elements)" << std::endl;
+  std::cout << "  pooled (" << pooled.nodesPerChunk() << " nodes/chunk): " << pooledNs
+    << " ns per push/pop" << std::endl;
+  std::cout << "  unpooled:                  " << unpooledNs << " ns per push/pop"
+    << std::endl;
+  std::cout << "  speed-up:                  " << unpooledNs / pooledNs << "x" << std::endl;
+
+  return 0;
+}
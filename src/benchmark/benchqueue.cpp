@@ -0,0 +1,329 @@
+// ============================================================================================
+//
+// benchqueue.cpp -- DQueue & SQueue vs. std::queue & std::deque Benchmark
+//
+// ============================================================================================
+
+/*
+This program compares "DQueue<int>" and "SQueue<int>" with "std::queue<int>" (which is a
+"std::deque<int>" underneath) and with "std::deque<int>" used directly.  Three workloads are
+timed:
+
+  churn    each round enqueues a batch of elements one at a time and then dequeues them all
+  window   the queue is kept at a fixed length while one element is enqueued and one is
+           dequeued per operation, so an "SQueue's" head and tail keep wrapping around
+  bulk     the same as "churn", but each round's batch is enqueued and dequeued in blocks of
+           "block size" elements with the bulk "enqueue()" & "dequeue()" (and with
+           "insert()" and "std::copy()" & "erase()" for "std::deque")
+
+Every workload checks a checksum of the dequeued elements so that the compiler can't drop the
+work.
+
+Usage:  benchqueue [rounds [batch size [block size]]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <vector>
+
+#include <dstructs/dqueue.h>
+#include <dstructs/squeue.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// ADAPTORS
+// ============================================================================================
+
+/*
+Each adaptor gives the workloads the same five operations on one kind of queue.
+*/
+
+struct DQueueAdaptor
+{
+  static const char* name()
+                       {return "DQueue";}
+
+  DQueue<int> queue;
+
+  DQueueAdaptor(const unsigned int)
+    {return;}
+
+  void push(const int element)
+         {queue.enqueue(element); return;}
+  int  pop()
+         {int element; queue.dequeue(element); return element;}
+  void pushBlock(const int *const block, const unsigned int count)
+         {queue.enqueue(block, count); return;}
+  void popBlock(int *const block, const unsigned int count)
+         {queue.dequeue(block, count); return;}
+};
+
+struct SQueueAdaptor
+{
+  static const char* name()
+                       {return "SQueue";}
+
+  SQueue<int> queue;
+
+  SQueueAdaptor(const unsigned int capacity):
+    queue(capacity) {return;}
+
+  void push(const int element)
+         {queue.enqueue(element); return;}
+  int  pop()
+         {int element; queue.dequeue(element); return element;}
+  void pushBlock(const int *const block, const unsigned int count)
+         {queue.enqueue(block, count); return;}
+  void popBlock(int *const block, const unsigned int count)
+         {queue.dequeue(block, count); return;}
+};
+
+struct StdQueueAdaptor
+{
+  static const char* name()
+                       {return "std::queue";}
+
+  std::queue<int> queue;
+
+  StdQueueAdaptor(const unsigned int)
+    {return;}
+
+  void push(const int element)
+         {queue.push(element); return;}
+  int  pop()
+         {const int element = queue.front(); queue.pop(); return element;}
+  void pushBlock(const int *const block, const unsigned int count)
+         {for (unsigned int i = 0U; i < count; ++i) queue.push(block[i]); return;}
+  void popBlock(int *const block, const unsigned int count)
+         {for (unsigned int i = 0U; i < count; ++i) block[i] = pop(); return;}
+};
+
+struct StdDequeAdaptor
+{
+  static const char* name()
+                       {return "std::deque";}
+
+  std::deque<int> queue;
+
+  StdDequeAdaptor(const unsigned int)
+    {return;}
+
+  void push(const int element)
+         {queue.push_back(element); return;}
+  int  pop()
+         {const int element = queue.front(); queue.pop_front(); return element;}
+  void pushBlock(const int *const block, const unsigned int count)
+         {queue.insert(queue.end(), block, block + count); return;}
+  void popBlock(int *const block, const unsigned int count)
+         {
+           std::copy(queue.begin(), queue.begin() + count, block);
+           queue.erase(queue.begin(), queue.begin() + count);
+           return;
+         }
+};
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class Adaptor> static const double churn
+(
+  const unsigned int rounds,                            // no. of enqueue/dequeue rounds
+  const unsigned int batchSize                          // no. of elements enqueued per round
+)
+
+/*
+This function returns the average time, in nanoseconds, of one enqueue/dequeue pair when
+elements are enqueued and dequeued one at a time.
+*/
+
+{
+  Adaptor queue(batchSize);
+  long    checksum(0L);
+
+  /*
+  One warm-up round so that any memory the queue keeps (a "DQueue's" node pool, a
+  "std::deque's" blocks) is already allocated -- the steady state is what's being measured.
+  */
+
+  for (unsigned int i = 0U; i < batchSize; ++i)
+    queue.push((int)i);
+
+  for (unsigned int i = 0U; i < batchSize; ++i)
+    queue.pop();
+
+  Stopwatch stopwatch;
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+  {
+    for (unsigned int i = 0U; i < batchSize; ++i)
+      queue.push((int)i);
+
+    for (unsigned int i = 0U; i < batchSize; ++i)
+      checksum += queue.pop();
+  }
+
+  const double elapsed = stopwatch.elapsedNs();
+
+  if (checksum != (long)rounds * batchSize * (batchSize - 1U) / 2L)
+    std::cerr << "  " << Adaptor::name() << ":  checksum mismatch!" << std::endl;
+
+  return elapsed / ((double)rounds * batchSize);
+}
+
+/*********************************************************************************************/
+
+template<class Adaptor> static const double window
+(
+  const unsigned int operations,                        // no. of enqueue/dequeue pairs
+  const unsigned int length                             // the queue's length while timed
+)
+
+/*
+This function returns the average time, in nanoseconds, of one enqueue/dequeue pair on a queue
+that's kept at "length" elements.
+*/
+
+{
+  Adaptor queue(length + 1U);
+  long    checksum(0L);
+  long    expected(0L);
+
+  for (unsigned int i = 0U; i < length; ++i)
+    queue.push((int)i);
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < operations; ++i)
+  {
+    queue.push((int)(length + i));
+    checksum += queue.pop();
+  }
+
+  const double elapsed = stopwatch.elapsedNs();
+
+  for (unsigned int i = 0U; i < operations; ++i)
+    expected += (long)i;
+
+  if (checksum != expected)
+    std::cerr << "  " << Adaptor::name() << ":  checksum mismatch!" << std::endl;
+
+  return elapsed / operations;
+}
+
+/*********************************************************************************************/
+
+template<class Adaptor> static const double bulk
+(
+  const unsigned int rounds,                            // no. of enqueue/dequeue rounds
+  const unsigned int batchSize,                         // no. of elements enqueued per round
+  const unsigned int blockSize                          // no. of elements per bulk call
+)
+
+/*
+This function returns the average time, in nanoseconds, per element when a round's batch is
+enqueued and dequeued in blocks of "blockSize" elements.  The queue is offset by half a block
+before timing so that an "SQueue's" blocks straddle the end of its array.
+*/
+
+{
+  Adaptor          queue(batchSize + blockSize);
+  std::vector<int> in(blockSize);
+  std::vector<int> out(blockSize);
+  long             checksum(0L);
+  long             expected(0L);
+
+  for (unsigned int i = 0U; i < blockSize; ++i)
+    in[i] = (int)i;
+
+  queue.pushBlock(in.data(), blockSize / 2U);
+  queue.popBlock(out.data(), blockSize / 2U);
+
+  Stopwatch stopwatch;
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+  {
+    for (unsigned int done = 0U; done + blockSize <= batchSize; done += blockSize)
+      queue.pushBlock(in.data(), blockSize);
+
+    for (unsigned int done = 0U; done + blockSize <= batchSize; done += blockSize)
+    {
+      queue.popBlock(out.data(), blockSize);
+      checksum += out[blockSize - 1U];
+    }
+  }
+
+  const double       elapsed = stopwatch.elapsedNs();
+  const unsigned int blocks  = batchSize / blockSize;
+
+  expected = (long)rounds * blocks * (blockSize - 1U);
+
+  if (checksum != expected)
+    std::cerr << "  " << Adaptor::name() << ":  checksum mismatch!" << std::endl;
+
+  return elapsed / ((double)rounds * blocks * blockSize);
+}
+
+/*********************************************************************************************/
+
+template<class Adaptor> static void report
+(
+  const unsigned int rounds,
+  const unsigned int batchSize,
+  const unsigned int blockSize
+)
+
+/*
+This routine runs the three workloads on one kind of queue and prints a row of results.
+*/
+
+{
+  const double churnNs  = churn<Adaptor>(rounds, batchSize);
+  const double windowNs = window<Adaptor>(rounds * batchSize, batchSize);
+  const double bulkNs   = bulk<Adaptor>(rounds, batchSize, blockSize);
+
+  std::cout << "  " << std::left << std::setw(12) << Adaptor::name() << std::right
+    << std::setw(10) << churnNs << std::setw(10) << windowNs << std::setw(10) << bulkNs
+    << std::endl;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int rounds(argc > 1 ? (unsigned int)atoi(argv[1]) : 1000U);
+  const unsigned int batchSize(argc > 2 ? (unsigned int)atoi(argv[2]) : 10000U);
+  const unsigned int blockSize(std::max(1U, std::min(batchSize,
+    argc > 3 ? (unsigned int)atoi(argv[3]) : 64U)));
+
+  std::cout << "Queue<int> benchmark (" << rounds << " rounds x " << batchSize
+    << " elements, blocks of " << blockSize << ")" << std::endl;
+  std::cout << "  ns per element:    churn    window      bulk" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  report<DQueueAdaptor>(rounds, batchSize, blockSize);
+  report<SQueueAdaptor>(rounds, batchSize, blockSize);
+  report<StdQueueAdaptor>(rounds, batchSize, blockSize);
+  report<StdDequeAdaptor>(rounds, batchSize, blockSize);
+
+  return 0;
+}
@@ -0,0 +1,247 @@
+// ============================================================================================
+//
+// benchsassocarray.cpp -- SAssocArray vs. Sorted SArray Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures the time per lookup of an "SAssocArray" (Eytzinger-ordered keys with a
+branchless, prefetching search) and of a plain sorted "SArray" of keys searched with
+"std::lower_bound()" (with the elements in a second "SArray"), with "unsigned int" keys and
+elements.  The tables' keys take up from the size of the L1 data cache to 8 times the size of
+the L3 cache, doubling each time.  Two workloads are run on each:
+
+  lookup       look up keys that are in the table, in random order, and add up their elements
+  lower bound  find the first key that isn't less than a random value (most of which aren't
+               in the table) and add up the elements found
+
+The cache sizes are asked of the system where possible.  They can also be given (in KiB) on
+the command line -- a small L3 size keeps the run short.
+
+Usage:  benchsassocarray [L1 size in KiB [L3 size in KiB]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <dstructs/sarray.h>
+#include <dstructs/sassocarray.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is what one run reports:  nanoseconds per operation for each workload, and a checksum of
+the elements found so that the two tables can be checked against each other.
+*/
+
+struct Result
+{
+  double lookupNs;
+  double lowerBoundNs;
+  size_t checksum;
+};
+
+// ============================================================================================
+// CONSTANTS
+// ============================================================================================
+
+static const unsigned int NUM_QUERIES = 4000000U;          // lookups per workload
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+static const size_t cacheSize
+(
+  const int    name,                                  // the "sysconf()" name of the cache size
+  const size_t defaultSize                            // the size to use if it isn't known
+)
+
+/*
+This function returns the size of a cache in bytes, as reported by the system, or
+"defaultSize" if the system doesn't say.
+*/
+
+{
+  const long size = sysconf(name);
+
+  return size > 0L ? (size_t)size : defaultSize;
+}
+
+/*********************************************************************************************/
+
+static const Result runSAssocArray
+(
+  const unsigned int               numElements,     // the no. of keys (key "i" is "2i + 1")
+  const std::vector<unsigned int>& present,         // keys to look up
+  const std::vector<unsigned int>& values           // values to find the lower bounds of
+)
+
+/*
+This function builds an "SAssocArray" (from pairs in random order) and runs the workloads on
+it.  The element for key "2i + 1" is "i".
+*/
+
+{
+  Result result;
+
+  result.checksum = 0U;
+
+  SAssocArray<unsigned int, unsigned int>* table;
+
+  {
+    SArray<std::pair<unsigned int, unsigned int> > pairs(numElements);
+    std::vector<unsigned int>                      order(numElements);
+
+    for (unsigned int i = 0U; i < numElements; ++i)
+      order[i] = i;
+
+    std::shuffle(order.begin(), order.end(), std::mt19937(7U));
+
+    for (unsigned int i = 0U; i < numElements; ++i)
+      pairs[i] = std::make_pair(2U * order[i] + 1U, order[i]);
+
+    table = new SAssocArray<unsigned int, unsigned int>(pairs);
+  }
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < present.size(); ++i)
+    result.checksum += (*table)[present[i]];
+
+  result.lookupNs = stopwatch.elapsedNs() / present.size();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < values.size(); ++i)
+  {
+    const SAssocArray<unsigned int, unsigned int>::ElementIterator bound =
+      table->lowerBound(values[i]);
+
+    if (bound != table->end())
+      result.checksum += *bound;
+  }
+
+  result.lowerBoundNs = stopwatch.elapsedNs() / values.size();
+
+  delete table;
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runSortedSArray
+(
+  const unsigned int               numElements,     // the no. of keys (key "i" is "2i + 1")
+  const std::vector<unsigned int>& present,         // keys to look up
+  const std::vector<unsigned int>& values           // values to find the lower bounds of
+)
+
+/*
+This function builds a sorted "SArray" of keys and a parallel "SArray" of elements and runs the
+workloads on them with "std::lower_bound()".
+*/
+
+{
+  Result                   result;
+  SArray<unsigned int>     keys(numElements);
+  SArray<unsigned int>     elements(numElements);
+  const unsigned int *const first = static_cast<const SArray<unsigned int>&>(keys).begin();
+  const unsigned int *const last  = static_cast<const SArray<unsigned int>&>(keys).end();
+
+  result.checksum = 0U;
+
+  for (unsigned int i = 0U; i < numElements; ++i)
+  {
+    keys[i]     = 2U * i + 1U;
+    elements[i] = i;
+  }
+
+  Stopwatch stopwatch;
+
+  for (unsigned int i = 0U; i < present.size(); ++i)
+    result.checksum += elements.begin()[std::lower_bound(first, last, present[i]) - first];
+
+  result.lookupNs = stopwatch.elapsedNs() / present.size();
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < values.size(); ++i)
+  {
+    const unsigned int *const bound = std::lower_bound(first, last, values[i]);
+
+    if (bound != last)
+      result.checksum += elements.begin()[bound - first];
+  }
+
+  result.lowerBoundNs = stopwatch.elapsedNs() / values.size();
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  #if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    const size_t l1Size = argc > 1 ? (size_t)atoi(argv[1]) * 1024U :
+      cacheSize(_SC_LEVEL1_DCACHE_SIZE, 32U * 1024U);
+    const size_t l3Size = argc > 2 ? (size_t)atoi(argv[2]) * 1024U :
+      cacheSize(_SC_LEVEL3_CACHE_SIZE, 8U * 1024U * 1024U);
+  #else
+    const size_t l1Size = (argc > 1 ? (size_t)atoi(argv[1]) : 32U) * 1024U;
+    const size_t l3Size = (argc > 2 ? (size_t)atoi(argv[2]) : 8U * 1024U) * 1024U;
+  #endif
+
+  std::cout << "Time per operation in ns (SAssocArray vs. sorted SArray), L1 = "
+    << l1Size / 1024U << " KiB, L3 = " << l3Size / 1024U << " KiB" << std::endl;
+  std::cout << "    keys (KiB)    elements     lookup       lower bound" << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (size_t keysSize = l1Size; keysSize <= 8U * l3Size; keysSize *= 2U)
+  {
+    const unsigned int        numElements = (unsigned int)(keysSize / sizeof(unsigned int));
+    std::vector<unsigned int> present(NUM_QUERIES);
+    std::vector<unsigned int> values(NUM_QUERIES);
+    std::mt19937              random(1U);
+
+    for (unsigned int i = 0U; i < NUM_QUERIES; ++i)
+    {
+      present[i] = 2U * (unsigned int)(random() % numElements) + 1U;
+      values[i]  = (unsigned int)(random() % (2U * numElements + 2U));
+    }
+
+    const Result assocArray(runSAssocArray(numElements, present, values));
+    const Result sortedArray(runSortedSArray(numElements, present, values));
+
+    std::cout << std::setw(14) << keysSize / 1024U << std::setw(12) << numElements
+      << std::setw(8) << assocArray.lookupNs << std::setw(7) << sortedArray.lookupNs
+      << std::setw(10) << assocArray.lowerBoundNs << std::setw(7) << sortedArray.lowerBoundNs
+      << std::endl;
+
+    if (assocArray.checksum != sortedArray.checksum)
+      std::cerr << "  Checksum mismatch!" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,297 @@
+// ============================================================================================
+//
+// benchsbinarytree.cpp -- SBinaryTree Priority Queue Benchmark
+//
+// ============================================================================================
+
+/*
+This program measures "SBinaryTree" priority queues of "unsigned int" elements with arities of
+2, 4 and 8 -- and "std::priority_queue" as a baseline -- holding from 1,024 up to "max. count"
+elements, quadrupling each time.  Four workloads are run on each:
+
+  build     constructing a full heap from an "SArray" of elements in random order
+  push      pushing the elements one at a time onto an empty heap
+  pop       popping every element off of a full heap
+  pushPop   "pushPop()" of "count" random elements on a full heap
+
+An unsorted "SArray" that's scanned for its largest element on every pop -- the simplest
+priority queue there is -- is also timed on "pop" for counts up to "SCAN_LIMIT", to show where
+it stops keeping up.
+
+Every figure is the average time per element, in nanoseconds.  The popped elements are checked
+against each other with a checksum.
+
+Usage:  benchsbinarytree [max. count]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <dstructs/sarray.h>
+#include <dstructs/sbinarytree.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+This is what one run reports:  nanoseconds per element for each workload, and a checksum of
+the popped elements.
+*/
+
+struct Result
+{
+  double buildNs;
+  double pushNs;
+  double popNs;
+  double pushPopNs;
+  size_t checksum;
+};
+
+// ============================================================================================
+// CONSTANTS
+// ============================================================================================
+
+static const unsigned int SCAN_LIMIT = 16U * 1024U;        // largest count for linear scans
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<unsigned int ARITY> static const Result runSBinaryTree
+(
+  const SArray<unsigned int>&      elements,        // the elements, in random order
+  const std::vector<unsigned int>& stream           // elements for "pushPop()"
+)
+
+/*
+This function runs the workloads on an "SBinaryTree" with "ARITY" children per node.
+*/
+
+{
+  const unsigned int count = elements.numElements();
+  Result             result;
+
+  result.checksum = 0U;
+
+  Stopwatch stopwatch;
+
+  {
+    const SBinaryTree<unsigned int, std::less<unsigned int>, ARITY> built(count, elements);
+
+    result.buildNs = stopwatch.elapsedNs() / count;
+  }
+
+  SBinaryTree<unsigned int, std::less<unsigned int>, ARITY> heap(count);
+  unsigned int                                              popped;
+
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < count; ++i)
+    heap.push(elements.begin()[i]);
+
+  result.pushNs = stopwatch.elapsedNs() / count;
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < count; ++i)
+  {
+    heap.pop(popped);
+    result.checksum += popped * (size_t)i;
+  }
+
+  result.popNs = stopwatch.elapsedNs() / count;
+
+  heap += elements;
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < count; ++i)
+  {
+    heap.pushPop(stream[i], popped);
+    result.checksum += popped;
+  }
+
+  result.pushPopNs = stopwatch.elapsedNs() / count;
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const Result runPriorityQueue
+(
+  const SArray<unsigned int>&      elements,        // the elements, in random order
+  const std::vector<unsigned int>& stream           // elements for "push()" & "pop()"
+)
+
+/*
+This function runs the workloads on a "std::priority_queue".  "pushPop" is a "push()" followed
+by a "pop()".
+*/
+
+{
+  const unsigned int        count = elements.numElements();
+  const unsigned int *const first = elements.begin();
+  Result                    result;
+
+  result.checksum = 0U;
+
+  Stopwatch stopwatch;
+
+  {
+    const std::priority_queue<unsigned int> built(first, first + count);
+
+    result.buildNs = stopwatch.elapsedNs() / count;
+  }
+
+  std::priority_queue<unsigned int> heap;
+
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < count; ++i)
+    heap.push(first[i]);
+
+  result.pushNs = stopwatch.elapsedNs() / count;
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < count; ++i)
+  {
+    result.checksum += heap.top() * (size_t)i;
+    heap.pop();
+  }
+
+  result.popNs = stopwatch.elapsedNs() / count;
+
+  for (unsigned int i = 0U; i < count; ++i)
+    heap.push(first[i]);
+
+  stopwatch.restart();
+
+  for (unsigned int i = 0U; i < count; ++i)
+  {
+    heap.push(stream[i]);
+    result.checksum += heap.top();
+    heap.pop();
+  }
+
+  result.pushPopNs = stopwatch.elapsedNs() / count;
+
+  return result;
+}
+
+/*********************************************************************************************/
+
+static const double runLinearScan
+(
+  const SArray<unsigned int>& elements              // the elements, in random order
+)
+
+/*
+This function pops every element off of an unsorted array by scanning for the largest one and
+moving the last element into its place, and returns the time per pop.
+*/
+
+{
+  const unsigned int        count = elements.numElements();
+  std::vector<unsigned int> array(elements.begin(), elements.begin() + count);
+  size_t                    checksum(0U);
+  Stopwatch                 stopwatch;
+
+  for (unsigned int i = 0U; i < count; ++i)
+  {
+    const std::vector<unsigned int>::iterator largest = std::max_element(array.begin(),
+      array.end());
+
+    checksum += *largest * (size_t)i;
+    *largest  = array.back();
+    array.pop_back();
+  }
+
+  const double ns = stopwatch.elapsedNs() / count;
+
+  if (checksum == 0U)
+    std::cerr << "  Empty array!" << std::endl;
+
+  return ns;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const unsigned int maxCount = argc > 1 ? (unsigned int)atoi(argv[1]) : 4U * 1024U * 1024U;
+
+  std::cout << "Time per element in ns (SBinaryTree arity 2, 4, 8, std::priority_queue)"
+    << std::endl;
+  std::cout << "     elements           build                       push"
+    "                        pop                        pushPop        scan" << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (unsigned int count = 1024U; count <= maxCount && count > 0U; count *= 4U)
+  {
+    SArray<unsigned int>      elements(count);
+    std::vector<unsigned int> stream(count);
+    std::mt19937              random(1U);
+
+    for (unsigned int i = 0U; i < count; ++i)
+    {
+      elements[i] = (unsigned int)random();
+      stream[i]   = (unsigned int)random();
+    }
+
+    const Result results[4] =
+    {
+      runSBinaryTree<2U>(elements, stream),
+      runSBinaryTree<4U>(elements, stream),
+      runSBinaryTree<8U>(elements, stream),
+      runPriorityQueue(elements, stream)
+    };
+
+    std::cout << std::setw(13) << count;
+
+    for (unsigned int workload = 0U; workload < 4U; ++workload)
+    {
+      std::cout << ' ';
+
+      for (unsigned int i = 0U; i < 4U; ++i)
+      {
+        const Result& result = results[i];
+
+        std::cout << std::setw(7) << (workload == 0U ? result.buildNs : workload == 1U ?
+          result.pushNs : workload == 2U ? result.popNs : result.pushPopNs);
+      }
+    }
+
+    if (count <= SCAN_LIMIT)
+      std::cout << std::setw(12) << runLinearScan(elements);
+
+    std::cout << std::endl;
+
+    for (unsigned int i = 1U; i < 4U; ++i)
+    {
+      if (results[i].checksum != results[0].checksum)
+        std::cerr << "  Checksum mismatch!" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,707 @@
+// ============================================================================================
+//
+// benchsuite.cpp -- Whole-Library Benchmark Suite with JSON Output
+//
+// ============================================================================================
+
+/*
+This program times the common operations of "SStack", "DStack", "SStackPair", "SArray" and
+"DLinkedList" -- and of "std::stack", "std::vector" and "std::list" as baselines -- for
+elements of 4, 16, 64 and 256 bytes and for 10, 100, 1000 ... up to 10,000,000 elements.  The
+operations are:
+
+  push        pushing "count" elements onto an empty stack ("append" for lists, "index" for
+              arrays -- assigning to every element with "operator[]()")
+  pop         popping "count" elements off of a full stack
+  peek        peeking at the top of a full stack "count" times
+  iterate     visiting every element with a range-based "for" loop
+  concatenate appending a structure of "count" elements to an empty one with "+="
+  equality    comparing two equal structures of "count" elements with "=="
+  construct   copy-constructing a structure of "count" elements
+
+Every figure is the average time per element, in nanoseconds.  Each measurement is repeated
+until at least "min. operations" elements have been timed, so small counts aren't swamped by
+timer overhead.  Combinations that would need more than "max. megabytes" of elements (three
+structures' worth, for "concatenate") are skipped.
+
+The results are written as a single JSON object, one result per line, so that runs from
+different versions of the library can be compared by a script:
+
+  {
+    "benchmark": "benchsuite",
+    "unit": "ns/element",
+    "results": [
+      {"structure": "SStack", "operation": "push", "elementSize": 4, "count": 10, "ns": 1.8},
+      ...
+    ]
+  }
+
+Progress goes to "stderr".  The JSON goes to "output file" or, if it's "-" (the default), to
+"stdout".
+
+Usage:  benchsuite [output file [max. count [max. megabytes [min. operations]]]]
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <stack>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dstructs/dlinkedlist.h>
+#include <dstructs/dstack.h>
+#include <dstructs/sarray.h>
+#include <dstructs/sstack.h>
+#include <dstructs/sstackpair.h>
+
+#include "stopwatch.h"
+
+// ============================================================================================
+// ELEMENT TYPES
+// ============================================================================================
+
+/*
+A "Payload<SIZE>" is a trivially-copyable element of "SIZE" bytes.  Only "key" is ever looked
+at; "filler" is there so that copying a "Payload" costs what copying "SIZE" bytes costs.
+*/
+
+template<size_t SIZE> struct Payload
+{
+  int           key;
+  unsigned char filler[SIZE - sizeof(int)];
+
+                Payload() {return;}
+                Payload(const int newKey): key(newKey)
+                  {memset(filler, 0, sizeof(filler)); return;}
+
+  const bool    operator==(const Payload<SIZE>& rhs) const
+                  {return key == rhs.key && memcmp(filler, rhs.filler, sizeof(filler)) == 0;}
+};
+
+template<> struct Payload<sizeof(int)>
+{
+  int           key;
+
+                Payload() {return;}
+                Payload(const int newKey): key(newKey) {return;}
+
+  const bool    operator==(const Payload<sizeof(int)>& rhs) const
+                  {return key == rhs.key;}
+};
+
+// ============================================================================================
+// BASELINE CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+These wrap the standard containers in the same "push()"/"pop()"/"peek()"/"+=" interface as the
+library's structures so that the same timing functions can be used on both.  The top of a
+stack is the back of a "std::vector" and the front of a "std::list", which is where each is
+cheapest.
+*/
+
+template<class Element> class StdStackBaseline:
+  public std::stack<Element>
+{
+  public:
+    void push(const Element& element)
+           {std::stack<Element>::push(element); return;}
+    void pop(Element& element)
+           {element = std::move(this->top()); std::stack<Element>::pop(); return;}
+    void peek(Element& element) const
+           {element = this->top(); return;}
+};
+
+template<class Element> class StdVectorBaseline:
+  public std::vector<Element>
+{
+  public:
+    void                        push(const Element& element)
+                                  {this->push_back(element); return;}
+    void                        pop(Element& element)
+                                  {element = std::move(this->back()); this->pop_back();
+                                    return;}
+    void                        peek(Element& element) const
+                                  {element = this->back(); return;}
+
+    StdVectorBaseline<Element>& operator+=(const StdVectorBaseline<Element>& source)
+                                  {this->insert(this->end(), source.begin(), source.end());
+                                    return *this;}
+};
+
+template<class Element> class StdListBaseline:
+  public std::list<Element>
+{
+  public:
+    void                      push(const Element& element)
+                                {this->push_front(element); return;}
+    void                      pop(Element& element)
+                                {element = std::move(this->front()); this->pop_front();
+                                  return;}
+    void                      peek(Element& element) const
+                                {element = this->front(); return;}
+
+    StdListBaseline<Element>& operator+=(const StdListBaseline<Element>& source)
+                                {this->insert(this->end(), source.begin(), source.end());
+                                  return *this;}
+};
+
+// ============================================================================================
+// MAKER CLASS DECLARATIONS
+// ============================================================================================
+
+/*
+A "maker" tells the timing functions how to create, copy and fill one kind of structure:
+
+  name()               the structure's name in the results
+  addName()            the name of the operation that "add()" does
+  newEmpty(capacity)   a new structure with room for "capacity" elements
+  newCopy(source)      a new copy of "source"
+  add(s, index, e)     put "e" into "s" as its "index"th element
+*/
+
+template<class Element> struct SStackMaker
+{
+  typedef SStack<Element> Structure;
+
+  static const char *const name()    {return "SStack";}
+  static const char *const addName() {return "push";}
+
+  static Structure *const newEmpty(const unsigned int capacity)
+                            {return new SStack<Element>(capacity);}
+  static Structure *const newCopy(const Structure& source)
+                            {return new SStack<Element>(source.numElements(), source);}
+  static void             add(Structure& s, const unsigned int, const Element& e)
+                            {s.push(e); return;}
+};
+
+template<class Element> struct DStackMaker
+{
+  typedef DStack<Element> Structure;
+
+  static const char *const name()    {return "DStack";}
+  static const char *const addName() {return "push";}
+
+  static Structure *const newEmpty(const unsigned int)
+                            {return new DStack<Element>;}
+  static Structure *const newCopy(const Structure& source)
+                            {return new DStack<Element>(source);}
+  static void             add(Structure& s, const unsigned int, const Element& e)
+                            {s.push(e); return;}
+};
+
+template<class Element> struct SStackPairMaker
+{
+  typedef SStackPair<Element> Structure;
+
+  static const char *const name()    {return "SStackPair";}
+  static const char *const addName() {return "push";}
+
+  static Structure *const newEmpty(const unsigned int capacity)
+                            {return new SStackPair<Element>(capacity);}
+  static Structure *const newCopy(const Structure& source)
+                            {
+                              Structure *const copy = newEmpty(source.numElements());
+
+                              *copy += source;
+                              return copy;
+                            }
+  static void             add(Structure& s, const unsigned int, const Element& e)
+                            {s.push(e); return;}
+};
+
+template<class Element> struct SArrayMaker
+{
+  typedef SArray<Element> Structure;
+
+  static const char *const name()    {return "SArray";}
+  static const char *const addName() {return "index";}
+
+  static Structure *const newEmpty(const unsigned int capacity)
+                            {return new SArray<Element>(capacity);}
+  static Structure *const newCopy(const Structure& source)
+                            {return new SArray<Element>(source.numElements(), source);}
+  static void             add(Structure& s, const unsigned int index, const Element& e)
+                            {s[index] = e; return;}
+};
+
+template<class Element> struct DLinkedListMaker
+{
+  typedef DLinkedList<Element> Structure;
+
+  static const char *const name()    {return "DLinkedList";}
+  static const char *const addName() {return "append";}
+
+  static Structure *const newEmpty(const unsigned int)
+                            {return new DLinkedList<Element>;}
+  static Structure *const newCopy(const Structure& source)
+                            {
+                              Structure *const copy = newEmpty(source.numElements());
+
+                              *copy = source;
+                              return copy;
+                            }
+  static void             add(Structure& s, const unsigned int, const Element& e)
+                            {s.append(e); return;}
+};
+
+template<class Element> struct StdStackMaker
+{
+  typedef StdStackBaseline<Element> Structure;
+
+  static const char *const name()    {return "std::stack";}
+  static const char *const addName() {return "push";}
+
+  static Structure *const newEmpty(const unsigned int)
+                            {return new Structure;}
+  static Structure *const newCopy(const Structure& source)
+                            {return new Structure(source);}
+  static void             add(Structure& s, const unsigned int, const Element& e)
+                            {s.push(e); return;}
+};
+
+template<class Element> struct StdVectorMaker
+{
+  typedef StdVectorBaseline<Element> Structure;
+
+  static const char *const name()    {return "std::vector";}
+  static const char *const addName() {return "push";}
+
+  static Structure *const newEmpty(const unsigned int capacity)
+                            {Structure *const s = new Structure; s->reserve(capacity);
+                              return s;}
+  static Structure *const newCopy(const Structure& source)
+                            {return new Structure(source);}
+  static void             add(Structure& s, const unsigned int, const Element& e)
+                            {s.push(e); return;}
+};
+
+template<class Element> struct StdListMaker
+{
+  typedef StdListBaseline<Element> Structure;
+
+  static const char *const name()    {return "std::list";}
+  static const char *const addName() {return "push";}
+
+  static Structure *const newEmpty(const unsigned int)
+                            {return new Structure;}
+  static Structure *const newCopy(const Structure& source)
+                            {return new Structure(source);}
+  static void             add(Structure& s, const unsigned int, const Element& e)
+                            {s.push(e); return;}
+};
+
+// ============================================================================================
+// RESULTLOG CLASS DECLARATION
+// ============================================================================================
+
+/*
+A "ResultLog" collects results and writes them out as JSON.
+*/
+
+class ResultLog
+{
+  public:
+    void add(const char *const structure, const char *const operation,
+           const size_t elementSize, const unsigned int count, const double ns);
+    void write(std::ostream&) const;
+
+  private:
+    struct Result
+    {
+      std::string  structure;
+      std::string  operation;
+      size_t       elementSize;
+      unsigned int count;
+      double       ns;
+    };
+
+    std::vector<Result> _results;
+};
+
+/*********************************************************************************************/
+
+void ResultLog::add
+(
+  const char *const  structure,                        // the structure's name
+  const char *const  operation,                        // the operation's name
+  const size_t       elementSize,                      // sizeof() each element
+  const unsigned int count,                            // no. of elements in the structure
+  const double       ns                                // nanoseconds per element
+)
+
+{
+  const Result result = {structure, operation, elementSize, count, ns};
+
+  _results.push_back(result);
+  std::cerr << "  " << structure << " " << operation << " (" << elementSize << " bytes x "
+    << count << "): " << ns << " ns/element" << std::endl;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+void ResultLog::write
+(
+  std::ostream& output                                   // where to write the JSON
+)
+const
+
+{
+  output << "{" << std::endl;
+  output << "  \"benchmark\": \"benchsuite\"," << std::endl;
+  output << "  \"unit\": \"ns/element\"," << std::endl;
+  output << "  \"results\": [" << std::endl;
+
+  for (size_t i = 0U; i < _results.size(); ++i)
+  {
+    const Result& result = _results[i];
+
+    output << "    {\"structure\": \"" << result.structure << "\", \"operation\": \""
+      << result.operation << "\", \"elementSize\": " << result.elementSize << ", \"count\": "
+      << result.count << ", \"ns\": " << result.ns << "}"
+      << (i + 1U < _results.size() ? "," : "") << std::endl;
+  }
+
+  output << "  ]" << std::endl;
+  output << "}" << std::endl;
+
+  return;
+}
+
+// ============================================================================================
+// ROUTINE & FUNCTION DEFINITIONS
+// ============================================================================================
+
+static volatile long sink;                // where checksums go so the timed loops aren't
+                                          //   optimized away
+
+/*********************************************************************************************/
+
+template<class Timed> static const double measure
+(
+  const unsigned int count,                      // no. of elements that each round times
+  const unsigned int rounds,                     // no. of rounds
+  Timed              timed                       // does one round (and starts/stops the clock)
+)
+
+/*
+This function calls "timed(stopwatch)" "rounds" times with a paused "Stopwatch" and returns
+the average time per element.  "timed" resumes the stopwatch around the part that's being
+measured, so its set-up and clean-up aren't counted.
+*/
+
+{
+  Stopwatch stopwatch(false);
+
+  for (unsigned int round = 0U; round < rounds; ++round)
+    timed(stopwatch);
+
+  return stopwatch.elapsedNs() / ((double)rounds * count);
+}
+
+/*********************************************************************************************/
+
+template<class Maker, class Element> static typename Maker::Structure *const newFilled
+(
+  const unsigned int count                                // no. of elements to fill it with
+)
+
+/*
+This function returns a new structure holding elements with keys 0 to "count" - 1.
+*/
+
+{
+  typedef typename Maker::Structure Structure;
+
+  Structure *const structure = Maker::newEmpty(count);
+
+  for (unsigned int i = 0U; i < count; ++i)
+    Maker::add(*structure, i, Element((int)i));
+
+  return structure;
+}
+
+/*********************************************************************************************/
+
+template<class Maker, class Element> static void benchFill
+(
+  ResultLog&         log,                                    // where to put the results
+  const unsigned int count,                                  // no. of elements
+  const unsigned int rounds                                  // no. of times to repeat
+)
+
+/*
+This function times filling an empty structure (refer to "Maker::add()").
+*/
+
+{
+  typedef typename Maker::Structure Structure;
+
+  log.add(Maker::name(), Maker::addName(), sizeof(Element), count, measure(count, rounds,
+    [count](Stopwatch& stopwatch)
+  {
+    const std::unique_ptr<Structure> structure(Maker::newEmpty(count));
+
+    stopwatch.resume();
+
+    for (unsigned int i = 0U; i < count; ++i)
+      Maker::add(*structure, i, Element((int)i));
+
+    stopwatch.pause();
+  }));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class Maker, class Element> static void benchPopAndPeek
+(
+  ResultLog&         log,                                    // where to put the results
+  const unsigned int count,                                  // no. of elements
+  const unsigned int rounds                                  // no. of times to repeat
+)
+
+/*
+This function times "pop()" and "peek()" on a stack of "count" elements.
+*/
+
+{
+  typedef typename Maker::Structure Structure;
+
+  log.add(Maker::name(), "pop", sizeof(Element), count, measure(count, rounds,
+    [count](Stopwatch& stopwatch)
+  {
+    const std::unique_ptr<Structure> structure(newFilled<Maker, Element>(count));
+    Element                          element;
+    long                             checksum(0L);
+
+    stopwatch.resume();
+
+    for (unsigned int i = 0U; i < count; ++i)
+    {
+      structure->pop(element);
+      checksum += element.key;
+    }
+
+    stopwatch.pause();
+    sink = sink + checksum;
+  }));
+
+  const std::unique_ptr<Structure> structure(newFilled<Maker, Element>(count));
+
+  log.add(Maker::name(), "peek", sizeof(Element), count, measure(count, rounds,
+    [count, &structure](Stopwatch& stopwatch)
+  {
+    Element element;
+    long    checksum(0L);
+
+    stopwatch.resume();
+
+    for (unsigned int i = 0U; i < count; ++i)
+    {
+      structure->peek(element);
+      checksum += element.key;
+    }
+
+    stopwatch.pause();
+    sink = sink + checksum;
+  }));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class Maker, class Element> static void benchWhole
+(
+  ResultLog&         log,                                    // where to put the results
+  const unsigned int count,                                  // no. of elements
+  const unsigned int rounds,                                 // no. of times to repeat
+  const bool         canConcatenate                          // time "+=" as well?
+)
+
+/*
+This function times the operations that work on a whole structure:  iterating, concatenating
+(if "canConcatenate" is true), comparing and copy-constructing.
+*/
+
+{
+  typedef typename Maker::Structure Structure;
+
+  const std::unique_ptr<Structure> source(newFilled<Maker, Element>(count));
+  const std::unique_ptr<Structure> twin(newFilled<Maker, Element>(count));
+
+  log.add(Maker::name(), "iterate", sizeof(Element), count, measure(count, rounds,
+    [&source](Stopwatch& stopwatch)
+  {
+    long checksum(0L);
+
+    stopwatch.resume();
+
+    for (const Element& element : *source)
+      checksum += element.key;
+
+    stopwatch.pause();
+    sink = sink + checksum;
+  }));
+
+  if (canConcatenate)
+  {
+    log.add(Maker::name(), "concatenate", sizeof(Element), count, measure(count, rounds,
+      [count, &source](Stopwatch& stopwatch)
+    {
+      const std::unique_ptr<Structure> destination(Maker::newEmpty(count));
+
+      stopwatch.resume();
+      *destination += *source;
+      stopwatch.pause();
+    }));
+  }
+
+  log.add(Maker::name(), "equality", sizeof(Element), count, measure(count, rounds,
+    [&source, &twin](Stopwatch& stopwatch)
+  {
+    stopwatch.resume();
+
+    const bool areEqual = *source == *twin;
+
+    stopwatch.pause();
+
+    if (!areEqual)
+      std::cerr << "  Equality mismatch!" << std::endl;
+  }));
+
+  log.add(Maker::name(), "construct", sizeof(Element), count, measure(count, rounds,
+    [&source](Stopwatch& stopwatch)
+  {
+    stopwatch.resume();
+
+    const std::unique_ptr<Structure> copy(Maker::newCopy(*source));
+
+    stopwatch.pause();
+  }));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class Maker, class Element> static void benchStack
+(
+  ResultLog&         log,                                    // where to put the results
+  const unsigned int count,                                  // no. of elements
+  const unsigned int rounds                                  // no. of times to repeat
+)
+
+{
+  benchFill<Maker, Element>(log, count, rounds);
+  benchPopAndPeek<Maker, Element>(log, count, rounds);
+  benchWhole<Maker, Element>(log, count, rounds, true);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<size_t SIZE> static void benchElementSize
+(
+  ResultLog&         log,                                    // where to put the results
+  const unsigned int maxCount,                               // largest no. of elements
+  const double       maxBytes,                               // most memory to use
+  const unsigned int minOperations                           // fewest elements to time
+)
+
+/*
+This function runs every benchmark for "Payload<SIZE>" elements at every count from 10 up to
+"maxCount" (by powers of ten).
+*/
+
+{
+  typedef Payload<SIZE> Element;
+
+  for (unsigned int count = 10U; count <= maxCount; count *= 10U)
+  {
+    if (3.0 * count * sizeof(Element) > maxBytes)
+    {
+      std::cerr << "Skipping " << count << " x " << sizeof(Element)
+        << "-byte elements (too much memory)" << std::endl;
+      break;
+    }
+
+    const unsigned int rounds(count >= minOperations ? 1U : minOperations / count);
+
+    std::cerr << count << " x " << sizeof(Element) << "-byte elements, " << rounds
+      << " rounds" << std::endl;
+
+    benchStack<SStackMaker<Element>, Element>(log, count, rounds);
+    benchStack<DStackMaker<Element>, Element>(log, count, rounds);
+    benchStack<SStackPairMaker<Element>, Element>(log, count, rounds);
+    benchStack<StdVectorMaker<Element>, Element>(log, count, rounds);
+    benchStack<StdListMaker<Element>, Element>(log, count, rounds);
+
+    benchFill<StdStackMaker<Element>, Element>(log, count, rounds);
+    benchPopAndPeek<StdStackMaker<Element>, Element>(log, count, rounds);
+
+    benchFill<SArrayMaker<Element>, Element>(log, count, rounds);
+    benchWhole<SArrayMaker<Element>, Element>(log, count, rounds, false);
+
+    benchFill<DLinkedListMaker<Element>, Element>(log, count, rounds);
+    benchWhole<DLinkedListMaker<Element>, Element>(log, count, rounds, true);
+
+    if (count > maxCount / 10U)
+      break;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+int main
+(
+  int               argc,
+  const char *const argv[]
+)
+
+{
+  const char *const  outputName(argc > 1 ? argv[1] : "-");
+  const unsigned int maxCount(argc > 2 ? (unsigned int)atoi(argv[2]) : 10000000U);
+  const double       maxBytes((argc > 3 ? atof(argv[3]) : 1024.0) * 1024.0 * 1024.0);
+  const unsigned int minOperations(argc > 4 ? (unsigned int)atoi(argv[4]) : 1000000U);
+
+  ResultLog log;
+
+  benchElementSize<4U>(log, maxCount, maxBytes, minOperations);
+  benchElementSize<16U>(log, maxCount, maxBytes, minOperations);
+  benchElementSize<64U>(log, maxCount, maxBytes, minOperations);
+  benchElementSize<256U>(log, maxCount, maxBytes, minOperations);
+
+  if (strcmp(outputName, "-") == 0)
+    log.write(std::cout);
+  else
+  {
+    std::ofstream output(outputName);
+
+    if (!output)
+    {
+      std::cerr << "Can't write to \"" << outputName << "\"." << std::endl;
+      return 1;
+    }
+
+    log.write(output);
+  }
+
+  return 0;
+}
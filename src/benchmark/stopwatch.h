@@ -0,0 +1,54 @@
+#ifndef BENCHMARK_STOPWATCH_H
+#define BENCHMARK_STOPWATCH_H
+
+// ============================================================================================
+//
+// stopwatch.h -- Wall-Clock Timer for Benchmarks
+//
+// ============================================================================================
+
+/*
+A "Stopwatch" starts timing when it's created (or restarted) and reports the elapsed wall-clock
+time in nanoseconds.  It's shared by the benchmark programs in this directory.
+
+It can also be paused and resumed so that set-up work between timed regions isn't counted.  A
+"Stopwatch" created with "false" starts out paused.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <chrono>
+
+// ============================================================================================
+// STOPWATCH CLASS DECLARATION
+// ============================================================================================
+
+class Stopwatch
+{
+  public:
+                 Stopwatch(const bool isRunning = true)
+                   {restart(); if (!isRunning) pause(); return;}
+
+    void         restart()
+                   {_totalNs = 0.0; _isRunning = true; _start = now(); return;}
+    void         pause()
+                   {if (_isRunning) {_totalNs += sinceStart(); _isRunning = false;} return;}
+    void         resume()
+                   {if (!_isRunning) {_isRunning = true; _start = now();} return;}
+    const double elapsedNs() const
+                   {return _isRunning ? _totalNs + sinceStart() : _totalNs;}
+
+  private:
+    std::chrono::steady_clock::time_point _start;          // when timing (last) resumed
+    double                                _totalNs;        // time banked by "pause()"
+    bool                                  _isRunning;      // is time being counted?
+
+    static std::chrono::steady_clock::time_point now()
+                   {return std::chrono::steady_clock::now();}
+    const double sinceStart() const
+                   {return std::chrono::duration<double, std::nano>(now() - _start).count();}
+};
+
+#endif
@@ -8,7 +8,7 @@
 // ============================================================================================
 
 /*
-This class is an array.  An "Array" is a "LinearStruct".
+This class is an array.  An "Array" is a "LinearStructure".
 
 The structure of an "Array" object looks like this:
 
@@ -33,7 +33,7 @@ to implement a methods that conform with standard C/C++ array subscripting behav
 #ifdef FAT_FILENAMES
   #include <dstructs/linearst.h>
 #else
-  #include <dstructs/linearstruct.h>
+  #include <dstructs/linearstructure.h>
 #endif
 
 // ============================================================================================
@@ -41,7 +41,8 @@ to implement a methods that conform with standard C/C++ array subscripting behav
 // ============================================================================================
 
 template <class T, class Key> class Array:
-  virtual public LinearStruct<T>
+  virtual public DataStructureExceptions,
+  virtual public LinearStructure<T>
 {
   public:
 
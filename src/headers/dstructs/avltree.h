@@ -0,0 +1,950 @@
+#ifndef DSTRUCTS_AVLTREE_H
+#define DSTRUCTS_AVLTREE_H
+
+// ============================================================================================
+//
+// avltree.h -- AVL Tree Template Class
+//
+// ============================================================================================
+
+/*
+This class is an AVL tree -- a binary search tree that keeps itself balanced, so that adding,
+removing and looking up an element each take O(log n) time no matter what order the elements
+arrive in.  An "AVLTree" is a "Tree".
+
+The elements are kept in the order that "Compare" defines, and each element appears at most
+once:  "insert()" returns false (and leaves the tree alone) if an equal element is already in
+it.  Two elements are equal if neither one is less than the other.
+
+  AVLTree<unsigned int> ids;
+
+  ids.insert(42U);
+
+  if (ids.contains(17U))
+    ...
+
+  for (AVLTree<unsigned int>::ConstElementIterator i = ids.lowerBound(100U); i != ids.end();
+    ++i)
+    ...
+
+The elements are iterated in sorted order, so comparing an "AVLTree" with "==" to any other
+data structure compares its sorted contents.  Elements can't be changed in place (that could
+put them out of order), so both kinds of element iterator are constant.  Adding an element
+doesn't invalidate iterators, and removing one only invalidates iterators to that element.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+Each node has pointers to its parent and its two children and the height of the subtree that
+it's the root of.  Nothing is done recursively:
+
+  - Adding an element walks down from the root to where it belongs and links in a new leaf.
+    Removing one unlinks its node -- if it has two children then its successor (the leftmost
+    node of its right subtree) is moved into its place, so no element is ever copied or moved.
+
+  - After either, "retrace()" walks back up the parent pointers, updating heights and rotating
+    any node whose subtrees' heights differ by 2.  It stops as soon as a subtree's height comes
+    out the same as it was, since nothing above it can have changed.
+
+  - The element iterators hold a node pointer.  The next node in order is the leftmost node of
+    the right subtree, if there is one, or else the nearest ancestor that's reached from a left
+    child -- so a whole in-order walk follows each parent pointer at most twice and needs no
+    stack.
+
+  - "empty()" deletes the nodes bottom-up by climbing the parent pointers.
+
+Nodes aren't allocated with "new" and "delete".  Each "AVLTree" owns a "NodePool" (as each
+"DLinearStructure" does), so a tree that churns stops calling the heap once it reaches its
+working size, and its nodes sit in a few large chunks rather than all over the heap.  The no.
+of nodes allocated at a time can be changed with "setNodesPerChunk()".
+
+A node's height fits in a byte:  an AVL tree with n nodes is never more than about
+1.44 log2(n) levels high.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include <sdp.h>
+#include <dstructs/nodepool.h>
+#include <dstructs/tree.h>
+
+// ============================================================================================
+// AVLTREE<T, COMPARE> CLASS DECLARATION
+// ============================================================================================
+
+template<class T, class Compare = std::less<T> > class AVLTree:
+  virtual public DataStructureExceptions,
+  virtual public Tree<T>
+{
+  public:
+                           AVLTree() noexcept;
+                           AVLTree(const AVLTree<T, Compare>&);
+                           AVLTree(const DataStructure<T>&);
+    virtual                ~AVLTree()
+                             {empty(); return;}
+
+    AVLTree<T, Compare>&   operator=(const AVLTree<T, Compare>&);
+    AVLTree<T, Compare>&   operator=(const DataStructure<T>&);
+    AVLTree<T, Compare>&   operator+=(const DataStructure<T>&);
+
+    const bool             insert(const T& element)
+                             {return add(element);}
+    const bool             insert(T&& element)
+                             {return add(std::move(element));}
+    const bool             remove(const T&) noexcept;
+
+    const T *const         find(const T&) const noexcept;
+    const bool             contains(const T& element) const noexcept
+                             {return find(element) != NULL;}
+
+    const unsigned int     height() const noexcept
+                             {return _root != NULL ? _root->height : 0U;}
+
+    const unsigned int     nodesPerChunk() const noexcept
+                             {return _pool.slotsPerChunk();}
+    void                   setNodesPerChunk(const unsigned int);
+
+  protected:
+    class Node
+    {
+      public:
+        Node*         parent;
+        Node*         left;
+        Node*         right;
+        unsigned char height;                     // of the subtree rooted here (a leaf is 1)
+        T             element;
+
+                      template<class... Args>
+                      Node(Node *const newParent, Args&&... arguments):
+                        parent(newParent), left(NULL), right(NULL), height(1U),
+                        element(std::forward<Args>(arguments)...) {return;}
+    };
+
+  public:
+
+    // Element iterators
+
+    /*
+    The element iterators visit the elements in sorted order.  The end iterator holds NULL.
+    */
+
+    class NodeIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef const T*                  pointer;
+        typedef const T&                  reference;
+
+                      NodeIterator(const Node *const node = NULL) noexcept:
+                        _node(node) {return;}
+
+        const T&      operator*() const noexcept
+                        {return _node->element;}
+        const T*      operator->() const noexcept
+                        {return &_node->element;}
+        NodeIterator& operator++() noexcept
+                        {_node = successor(_node); return *this;}
+        NodeIterator  operator++(int) noexcept
+                        {const NodeIterator old(*this); ++*this; return old;}
+
+        const bool    operator==(const NodeIterator& rhs) const noexcept
+                        {return _node == rhs._node;}
+        const bool    operator!=(const NodeIterator& rhs) const noexcept
+                        {return _node != rhs._node;}
+
+      private:
+        const Node* _node;                    // the current node, or NULL past the last one
+    };
+
+    typedef NodeIterator ElementIterator;
+    typedef NodeIterator ConstElementIterator;
+
+    ConstElementIterator   begin() const noexcept
+                             {return ConstElementIterator(leftmost(_root));}
+    ConstElementIterator   end() const noexcept
+                             {return ConstElementIterator();}
+
+    ConstElementIterator   lowerBound(const T&) const noexcept;
+
+    // DataStructure<T> methods
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    // Tree<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+    Node*                  _root;                        // the root node, or NULL if empty
+    NodePool               _pool;                        // the pool that the nodes come from
+
+    template<class Arg>
+    const bool             add(Arg&&);
+    const Node *const      lowerBoundNode(const T&) const noexcept;
+    void                   replaceChild(Node *const, Node *const, Node *const) noexcept;
+    Node *const            rotateLeft(Node *const) noexcept;
+    Node *const            rotateRight(Node *const) noexcept;
+    Node *const            rebalance(Node *const) noexcept;
+    void                   retrace(Node*) noexcept;
+
+    template<class... Args>
+    Node *const            newNode(Node *const, Args&&...);
+    void                   deleteNode(Node *const) noexcept;
+
+    static const unsigned int heightOf(const Node *const node) noexcept
+                             {return node != NULL ? node->height : 0U;}
+    static void            updateHeight(Node *const) noexcept;
+    static const int       balanceOf(const Node *const node) noexcept
+                             {return (int)heightOf(node->left) - (int)heightOf(node->right);}
+    static const Node *const leftmost(const Node*) noexcept;
+    static const Node *const successor(const Node*) noexcept;
+};
+
+// ============================================================================================
+// AVLTREE<T, COMPARE> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Compare> AVLTree<T, Compare>::AVLTree() noexcept:
+
+/*
+This constructor instanciates an empty tree.
+*/
+
+  _root(NULL),
+  _pool(sizeof(Node), alignof(Node))
+
+{
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> AVLTree<T, Compare>::AVLTree
+(
+  const AVLTree<T, Compare>& source                   // the tree to copy
+):
+
+/*
+This constructor makes a deep copy of "source".  The copy gets its own (empty) pool with the
+same no. of nodes per chunk as "source's" pool.
+*/
+
+  _root(NULL),
+  _pool(source._pool)
+
+{
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> AVLTree<T, Compare>::AVLTree
+(
+  const DataStructure<T>& source                      // the data structure to copy from
+):
+
+/*
+This constructor instanciates a tree that holds copies of "source's" elements (without any
+duplicates).
+*/
+
+  _root(NULL),
+  _pool(sizeof(Node), alignof(Node))
+
+{
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> AVLTree<T, Compare>& AVLTree<T, Compare>::operator=
+(
+  const AVLTree<T, Compare>& source                   // the tree to copy
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> AVLTree<T, Compare>& AVLTree<T, Compare>::operator=
+(
+  const DataStructure<T>& source                      // the data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> AVLTree<T, Compare>& AVLTree<T, Compare>::operator+=
+(
+  const DataStructure<T>& source                      // the data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void AVLTree<T, Compare>::setNodesPerChunk
+(
+  const unsigned int nodesPerChunk      // no. of nodes to allocate from the heap at a time
+)
+
+/*
+This method changes how many nodes this tree's pool allocates from the heap at a time.  0 turns
+pooling off, so that every node is allocated from and returned to the heap individually.
+
+Any memory that the pool is holding onto is returned to the heap.
+
+PRECONDITIONS:
+The tree must be empty.
+
+POSTCONDITIONS:
+Nodes will be allocated "nodesPerChunk" at a time.
+*/
+
+{
+  if (_root != NULL)
+  {
+    throw OperationFailed("The node pool of a non-empty AVLTree can't be changed.", __FILE__,
+      __LINE__);
+  }
+
+  _pool.reset(nodesPerChunk);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const bool AVLTree<T, Compare>::remove
+(
+  const T& element                                    // the element to remove
+)
+noexcept
+
+/*
+This method removes the element that's equal to "element" and returns true, or returns false
+if there isn't one.
+*/
+
+{
+  Node *const node = const_cast<Node*>(lowerBoundNode(element));
+
+  if (node == NULL || Compare()(element, node->element))
+    return false;
+
+  Node* retraceFrom;                        // the lowest node whose subtree has changed
+
+  if (node->left == NULL || node->right == NULL)
+  {
+    Node *const child = node->left != NULL ? node->left : node->right;
+
+    if (child != NULL)
+      child->parent = node->parent;
+
+    replaceChild(node->parent, node, child);
+    retraceFrom = node->parent;
+  }
+  else
+  {
+    /*
+    The successor has no left child.  It's unlinked from where it is (its right child, if any,
+    takes its place) and then it takes over "node's" place, children and height.
+    */
+
+    Node *const next = const_cast<Node*>(leftmost(node->right));
+
+    if (next == node->right)
+      retraceFrom = next;
+    else
+    {
+      retraceFrom       = next->parent;
+      retraceFrom->left = next->right;
+
+      if (next->right != NULL)
+        next->right->parent = retraceFrom;
+
+      next->right         = node->right;
+      node->right->parent = next;
+    }
+
+    next->left         = node->left;
+    node->left->parent = next;
+    next->parent       = node->parent;
+    next->height       = node->height;
+    replaceChild(node->parent, node, next);
+  }
+
+  deleteNode(node);
+  --this->_numElements;
+
+  retrace(retraceFrom);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const T *const AVLTree<T, Compare>::find
+(
+  const T& element                                    // the element to look for
+)
+const noexcept
+
+/*
+This method returns a pointer to the element in the tree that's equal to "element", or NULL if
+there isn't one.
+*/
+
+{
+  const Node *const node = lowerBoundNode(element);
+
+  return node != NULL && !Compare()(element, node->element) ? &node->element : NULL;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename AVLTree<T, Compare>::ConstElementIterator AVLTree<T, Compare>::lowerBound
+(
+  const T& element                                    // the element to look for
+)
+const noexcept
+
+/*
+This method returns an iterator at the smallest element that isn't less than "element", or
+"end()" if there isn't one.
+*/
+
+{
+  return ConstElementIterator(lowerBoundNode(element));
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void AVLTree<T, Compare>::empty() noexcept
+
+/*
+This method removes every element.  The nodes are deleted from the bottom up:  a node is only
+deleted once both of its subtrees have been, and then the walk climbs back to its parent.
+*/
+
+{
+  Node* node(_root);
+
+  while (node != NULL)
+  {
+    if (node->left != NULL)
+      node = node->left;
+    else if (node->right != NULL)
+      node = node->right;
+    else
+    {
+      Node *const parent = node->parent;
+
+      if (parent != NULL)
+      {
+        if (parent->left == node)
+          parent->left = NULL;
+        else
+          parent->right = NULL;
+      }
+
+      deleteNode(node);
+      node = parent;
+    }
+  }
+
+  _root              = NULL;
+  this->_numElements = 0U;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void AVLTree<T, Compare>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method adds copies of the elements of "source" that aren't already in the tree.  If an
+exception is thrown then the elements that were added before it stay in the tree.
+*/
+
+{
+  if (&source == this)
+    return;
+
+  bool           isReversed;
+  const T *const block = source.contiguousElements(isReversed);
+
+  if (block != NULL)
+  {
+    const unsigned int count(source.numElements());
+
+    for (unsigned int i = 0U; i < count; ++i)
+      add(block[isReversed ? count - 1U - i : i]);
+  }
+  else
+  {
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+    for (; i->more(); i->next())
+      add(*i->current());
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T, class Compare> void AVLTree<T, Compare>::assertInvariants() const noexcept
+
+  {
+    assert((_root == NULL) == (this->_numElements == 0U));
+    assert(_root == NULL || _root->parent == NULL);
+    assert(_root == NULL || (balanceOf(_root) >= -1 && balanceOf(_root) <= 1));
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T, class Compare> template<class Arg> const bool AVLTree<T, Compare>::add
+(
+  Arg&& element                                       // the element to add
+)
+
+/*
+This method adds "element" (copied or moved, as "Arg" says) and returns true, or returns false
+if an equal element is already in the tree.
+*/
+
+{
+  Node* parent(NULL);
+  Node* current(_root);
+  bool  isLeft(false);
+
+  while (current != NULL)
+  {
+    parent = current;
+
+    if (Compare()(element, current->element))
+    {
+      current = current->left;
+      isLeft  = true;
+    }
+    else if (Compare()(current->element, element))
+    {
+      current = current->right;
+      isLeft  = false;
+    }
+    else
+      return false;
+  }
+
+  Node *const node = newNode(parent, std::forward<Arg>(element));
+
+  if (parent == NULL)
+    _root = node;
+  else if (isLeft)
+    parent->left = node;
+  else
+    parent->right = node;
+
+  ++this->_numElements;
+  retrace(parent);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+const typename AVLTree<T, Compare>::Node *const AVLTree<T, Compare>::lowerBoundNode
+(
+  const T& element                                    // the element to look for
+)
+const noexcept
+
+/*
+This method returns the node with the smallest element that isn't less than "element", or NULL
+if there isn't one.
+*/
+
+{
+  const Node* bound(NULL);
+  const Node* current(_root);
+
+  while (current != NULL)
+  {
+    if (Compare()(current->element, element))
+      current = current->right;
+    else
+    {
+      bound   = current;
+      current = current->left;
+    }
+  }
+
+  return bound;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> inline void AVLTree<T, Compare>::replaceChild
+(
+  Node *const parent,                       // "oldChild's" parent, or NULL if it's the root
+  Node *const oldChild,                     // the child to replace
+  Node *const newChild                      // what to replace it with (may be NULL)
+)
+noexcept
+
+/*
+This method makes "newChild" take "oldChild's" place under "parent".  The caller sets
+"newChild's" parent pointer.
+*/
+
+{
+  if (parent == NULL)
+    _root = newChild;
+  else if (parent->left == oldChild)
+    parent->left = newChild;
+  else
+    parent->right = newChild;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename AVLTree<T, Compare>::Node *const AVLTree<T, Compare>::rotateLeft
+(
+  Node *const node                          // the root of the subtree to rotate
+)
+noexcept
+
+/*
+This method rotates the subtree rooted at "node" to the left -- "node's" right child takes its
+place and "node" becomes that child's left child -- and returns the subtree's new root.
+
+          node                 right
+          /  \                 /   \
+         a   right    -->   node    c
+             /   \          /  \
+            b     c        a    b
+*/
+
+{
+  Node *const right = node->right;
+
+  node->right = right->left;
+
+  if (right->left != NULL)
+    right->left->parent = node;
+
+  right->parent = node->parent;
+  replaceChild(node->parent, node, right);
+
+  right->left  = node;
+  node->parent = right;
+
+  updateHeight(node);
+  updateHeight(right);
+
+  return right;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename AVLTree<T, Compare>::Node *const AVLTree<T, Compare>::rotateRight
+(
+  Node *const node                          // the root of the subtree to rotate
+)
+noexcept
+
+/*
+This method is the mirror image of "rotateLeft()".
+*/
+
+{
+  Node *const left = node->left;
+
+  node->left = left->right;
+
+  if (left->right != NULL)
+    left->right->parent = node;
+
+  left->parent = node->parent;
+  replaceChild(node->parent, node, left);
+
+  left->right  = node;
+  node->parent = left;
+
+  updateHeight(node);
+  updateHeight(left);
+
+  return left;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename AVLTree<T, Compare>::Node *const AVLTree<T, Compare>::rebalance
+(
+  Node *const node                          // a node whose children are balanced
+)
+noexcept
+
+/*
+This method updates "node's" height and, if its subtrees' heights differ by 2, rotates it (or
+double-rotates it) so that they don't.  It returns the root of the subtree.
+*/
+
+{
+  updateHeight(node);
+
+  const int balance = balanceOf(node);
+
+  if (balance > 1)
+  {
+    if (balanceOf(node->left) < 0)
+      rotateLeft(node->left);
+
+    return rotateRight(node);
+  }
+
+  if (balance < -1)
+  {
+    if (balanceOf(node->right) > 0)
+      rotateRight(node->right);
+
+    return rotateLeft(node);
+  }
+
+  return node;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void AVLTree<T, Compare>::retrace
+(
+  Node* node                                // the lowest node whose subtree has changed
+)
+noexcept
+
+/*
+This method rebalances "node" and its ancestors after a node has been added below it or
+removed from below it.  It stops at the first subtree whose height hasn't changed.
+*/
+
+{
+  while (node != NULL)
+  {
+    const unsigned int oldHeight = node->height;
+
+    node = rebalance(node);
+
+    if (node->height == oldHeight)
+      break;
+
+    node = node->parent;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> template<class... Args>
+typename AVLTree<T, Compare>::Node *const AVLTree<T, Compare>::newNode
+(
+  Node *const parent,                            // the node that will be the new one's parent
+  Args&&...   arguments                          // the arguments to construct the element from
+)
+
+/*
+This method constructs a new leaf in a slot from the pool and returns it.  "Full" is thrown if
+no memory could be allocated for the node.  "OperationFailed" is thrown if the element couldn't
+be constructed -- the slot is returned to the pool in that case.
+*/
+
+{
+  void *const slot = _pool.allocate();
+
+  if (slot == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  try
+  {
+    return new(slot) Node(parent, std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    _pool.release(slot);
+    throw OperationFailed("Unable to copy an element into a new node.", __FILE__, __LINE__);
+  }
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void AVLTree<T, Compare>::deleteNode
+(
+  Node *const node                              // a node that was created by "newNode()"
+)
+noexcept
+
+{
+  assert(node != NULL);
+
+  node->~Node();
+  _pool.release(node);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> inline void AVLTree<T, Compare>::updateHeight
+(
+  Node *const node                          // the node whose height is to be recalculated
+)
+noexcept
+
+{
+  const unsigned int left  = heightOf(node->left);
+  const unsigned int right = heightOf(node->right);
+
+  node->height = (unsigned char)((left > right ? left : right) + 1U);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+inline const typename AVLTree<T, Compare>::Node *const AVLTree<T, Compare>::leftmost
+(
+  const Node* node                          // the root of a subtree, or NULL
+)
+noexcept
+
+/*
+This function returns the node with the smallest element in the subtree rooted at "node", or
+NULL if "node" is NULL.
+*/
+
+{
+  if (node != NULL)
+  {
+    while (node->left != NULL)
+      node = node->left;
+  }
+
+  return node;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+inline const typename AVLTree<T, Compare>::Node *const AVLTree<T, Compare>::successor
+(
+  const Node* node                          // a node in the tree
+)
+noexcept
+
+/*
+This function returns the node that follows "node" in sorted order, or NULL if it's the last.
+*/
+
+{
+  if (node->right != NULL)
+    return leftmost(node->right);
+
+  const Node* parent(node->parent);
+
+  while (parent != NULL && node == parent->right)
+  {
+    node   = parent;
+    parent = parent->parent;
+  }
+
+  return parent;
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef DSTRUCTS_BINARYTREE_H
+#define DSTRUCTS_BINARYTREE_H
+
+// ============================================================================================
+//
+// binarytree.h -- Binary Tree (Heap) Base Class
+//
+// ============================================================================================
+
+/*
+This class is a base class for trees that are kept in heap order and used as priority queues.
+A "BinaryTree" is a "Tree".
+
+Every element in a heap is ordered no higher than its parent, so the element at the root --
+the "top" -- is always the highest-priority one.  Which element that is is up to the
+descendent (usually a comparison function object).  Elements are pushed in any order and
+popped off highest first; ties come off in no particular order.
+
+A heap has the same exception contract as a stack:  "push()" throws "Full" if there's no room
+for another element, "pop()" and "peek()" throw "Empty" if there are no elements and all three
+throw "OperationFailed" if an element couldn't be copied or moved.
+
+"pushPop()" pushes an element and then pops the top in one operation.  It never needs room for
+another element, and if the new element would be the top anyway then the heap isn't touched at
+all -- so a heap of "k" elements can select the "k" smallest of a stream of elements with one
+"pushPop()" per element.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <utility>
+
+#include <dstructs/tree.h>
+
+// ============================================================================================
+// CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class BinaryTree:
+  virtual public DataStructureExceptions,
+  virtual public Tree<T>
+{
+  public:
+
+    /*
+    "push()" must add an element and restore heap order.  "pop()" must move the top element
+    into the caller's variable and remove it.  "peek()" must copy the top element without
+    removing it.  "pushPop()" must behave exactly like a "push()" of its first argument
+    followed by a "pop()" into its second, except that it must work on a full heap.
+    */
+
+    virtual void          push(const T&)  = 0;
+    virtual void          push(T&&)  = 0;
+    virtual void          pop(T&) = 0;
+    virtual void          peek(T&) const = 0;
+    virtual void          pushPop(const T&, T&)     = 0;
+    virtual void          pushPop(T&&, T&)        = 0;
+
+    inline BinaryTree<T>& operator<<(const T&);
+    inline BinaryTree<T>& operator<<(T&&);
+    inline BinaryTree<T>& operator>>(T&);
+};
+
+// ============================================================================================
+// CONVENIENCE OPERATORS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> inline BinaryTree<T>& BinaryTree<T>::operator<<
+(
+  const T& elementToPush
+)
+
+/*
+This function makes the shift-in operator work like a "BinaryTree<T>'s" "push()" method (refer
+to "Stack<T>::operator<<()").
+*/
+
+{
+  push(elementToPush);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline BinaryTree<T>& BinaryTree<T>::operator<<
+(
+  T&& elementToPush
+)
+
+{
+  push(std::move(elementToPush));
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline BinaryTree<T>& BinaryTree<T>::operator>>
+(
+  T& poppedElement
+)
+
+/*
+This function makes the shift-out operator work like a "BinaryTree<T>'s" "pop()" method.
+*/
+
+{
+  pop(poppedElement);
+  return *this;
+}
+
+#endif
@@ -0,0 +1,1478 @@
+#ifndef DSTRUCTS_BTREE_H
+#define DSTRUCTS_BTREE_H
+
+// ============================================================================================
+//
+// btree.h -- B+Tree Template Class
+//
+// ============================================================================================
+
+/*
+This class is a B+tree -- a balanced search tree whose nodes each hold many elements, so that
+a lookup visits only a few nodes and a scan reads the elements in long runs.  A "BTree" is a
+"Tree".
+
+Its interface is the same as "AVLTree's":  the elements are kept in the order that "Compare"
+defines, each element appears at most once, "insert()" returns false if an equal element is
+already in the tree, and the (constant) element iterators visit the elements in sorted order.
+"lowerBound()" returns an iterator at the first element that isn't less than a given one, so a
+range scan is a "lowerBound()" followed by a loop:
+
+  for (BTree<Trade>::ConstElementIterator i = trades.lowerBound(from);
+    i != trades.end() && *i < to; ++i)
+    ...
+
+Constructing a "BTree" from a data structure whose elements are already sorted (with no
+duplicates) -- an "SArray" that has been sorted, or another "BTree" -- builds the whole tree
+bottom-up in O(n) time, with every node nearly full.  Any other source is inserted one element
+at a time.
+
+Adding or removing an element invalidates every iterator.
+
+Elements are moved from node to node as the tree changes shape, so "T's" move constructor must
+not throw.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+There are two kinds of node, and each is "NODE_SIZE" bytes (four cache lines) long, aligned to
+a cache line:
+
+  - A leaf holds up to "LEAF_CAPACITY" elements, in order.  Each leaf points to the next one,
+    so iterating is a walk along an array with a pointer chase every "LEAF_CAPACITY" elements.
+
+  - An inner node holds up to "INNER_CAPACITY" keys and one more child than it has keys.
+    Every element in the subtree under child "i" is less than key "i", which is less than or
+    equal to every element under child "i + 1".  The keys are copies of elements.
+
+Every node except the root is at least half full, and all of the leaves are at the same depth,
+so the tree is O(log n) levels high with a large base -- about 20 for "int" inner nodes.  A
+search binary-searches each node on its path and prefetches every line of the child that it
+goes down to, so that the lines of a node arrive together rather than one probe at a time.
+
+Adding an element to a full leaf splits it in two and adds a key for the new leaf to its
+parent, which may split in turn, up to the root.  Every node that the split will need is
+allocated, and the new element and the new key are copied, before anything is changed, so if
+any of that fails then the tree is left as it was.  From then on elements and keys are only
+moved, which can't fail.
+
+Removing an element from a leaf that's then less than half full either borrows an element from
+a neighbouring leaf under the same parent or, if that leaf is no more than half full, merges
+with it -- which removes a key from the parent, which may then borrow from or merge with a
+neighbour of its own, up to the root.  A key left over from an element that has since been
+removed doesn't need to be replaced:  it still separates the subtrees on either side of it.
+
+Each node also points to the next node on its level, which lets "empty()" free the tree a
+level at a time without recursion, and lets the bulk-loading constructor build it a level at a
+time:  the leaves are filled with the sorted elements (spread evenly, so that the last leaf
+isn't left nearly empty), then each level of inner nodes is built over the one below it until
+a level has only one node.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <sdp.h>
+#include <dstructs/tree.h>
+
+// ============================================================================================
+// BTREE<T, COMPARE> CLASS DECLARATION
+// ============================================================================================
+
+template<class T, class Compare = std::less<T> > class BTree:
+  virtual public DataStructureExceptions,
+  virtual public Tree<T>
+{
+  static_assert(std::is_nothrow_move_constructible<T>::value,
+    "A BTree's elements must be movable without exceptions.");
+
+  public:
+    static const size_t       CACHE_LINE_SIZE = 64U;
+    static const size_t       NODE_SIZE       = 4U * CACHE_LINE_SIZE;
+
+                           BTree() noexcept;
+                           BTree(const BTree<T, Compare>&);
+                           BTree(const DataStructure<T>&);
+    virtual                ~BTree()
+                             {empty(); return;}
+
+    BTree<T, Compare>&     operator=(const BTree<T, Compare>&);
+    BTree<T, Compare>&     operator=(const DataStructure<T>&);
+    BTree<T, Compare>&     operator+=(const DataStructure<T>&);
+
+    const bool             insert(const T& element)
+                             {return add(element);}
+    const bool             insert(T&& element)
+                             {return add(std::move(element));}
+    const bool             remove(const T&);
+
+    const T *const         find(const T&) const noexcept;
+    const bool             contains(const T& element) const noexcept
+                             {return find(element) != NULL;}
+
+    const unsigned int     height() const noexcept
+                             {return _height;}
+
+  private:
+    static const size_t       HEADER_SIZE    = 2U * sizeof(void*);
+    static const unsigned int LEAF_CAPACITY  =
+                                (NODE_SIZE - HEADER_SIZE) / sizeof(T) >= 4U ?
+                                (unsigned int)((NODE_SIZE - HEADER_SIZE) / sizeof(T)) : 4U;
+    static const unsigned int INNER_CAPACITY =
+                                (NODE_SIZE - HEADER_SIZE - sizeof(void*)) /
+                                (sizeof(T) + sizeof(void*)) >= 4U ?
+                                (unsigned int)((NODE_SIZE - HEADER_SIZE - sizeof(void*)) /
+                                (sizeof(T) + sizeof(void*))) : 4U;
+    static const unsigned int MIN_LEAF       = LEAF_CAPACITY / 2U;
+    static const unsigned int MIN_INNER      = INNER_CAPACITY / 2U;
+    static const unsigned int MAX_HEIGHT     = 32U;
+
+    /*
+    "count" is the no. of elements in a leaf or the no. of keys in an inner node.
+    */
+
+    class Node
+    {
+      public:
+        unsigned int count;
+        Node*        next;                           // the next node on this level, or NULL
+    };
+
+    class alignas(CACHE_LINE_SIZE) Leaf:
+      public Node
+    {
+      public:
+        alignas(T) unsigned char storage[sizeof(T) * LEAF_CAPACITY];
+
+        T *const       elements() noexcept
+                         {return reinterpret_cast<T*>(storage);}
+        const T *const elements() const noexcept
+                         {return reinterpret_cast<const T*>(storage);}
+    };
+
+    class alignas(CACHE_LINE_SIZE) Inner:
+      public Node
+    {
+      public:
+        Node*                      children[INNER_CAPACITY + 1U];
+        alignas(T) unsigned char   storage[sizeof(T) * INNER_CAPACITY];
+
+        T *const       keys() noexcept
+                         {return reinterpret_cast<T*>(storage);}
+        const T *const keys() const noexcept
+                         {return reinterpret_cast<const T*>(storage);}
+    };
+
+  public:
+
+    // Element iterators
+
+    /*
+    The element iterators visit the elements in sorted order, a leaf at a time.  The end
+    iterator holds a NULL leaf.
+    */
+
+    class LeafIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef const T*                  pointer;
+        typedef const T&                  reference;
+
+                      LeafIterator(const Leaf *const leaf = NULL,
+                        const unsigned int index = 0U) noexcept:
+                        _leaf(leaf), _index(index) {return;}
+
+        const T&      operator*() const noexcept
+                        {return _leaf->elements()[_index];}
+        const T*      operator->() const noexcept
+                        {return _leaf->elements() + _index;}
+        LeafIterator& operator++() noexcept
+                        {
+                          if (++_index == _leaf->count)
+                          {
+                            _leaf  = static_cast<const Leaf*>(_leaf->next);
+                            _index = 0U;
+                          }
+
+                          return *this;
+                        }
+        LeafIterator  operator++(int) noexcept
+                        {const LeafIterator old(*this); ++*this; return old;}
+
+        const bool    operator==(const LeafIterator& rhs) const noexcept
+                        {return _leaf == rhs._leaf && _index == rhs._index;}
+        const bool    operator!=(const LeafIterator& rhs) const noexcept
+                        {return !(*this == rhs);}
+
+      private:
+        const Leaf*  _leaf;                   // the current leaf, or NULL past the last one
+        unsigned int _index;                  // the current element in "_leaf"
+    };
+
+    typedef LeafIterator ElementIterator;
+    typedef LeafIterator ConstElementIterator;
+
+    ConstElementIterator   begin() const noexcept
+                             {return ConstElementIterator(firstLeaf());}
+    ConstElementIterator   end() const noexcept
+                             {return ConstElementIterator();}
+
+    ConstElementIterator   lowerBound(const T&) const noexcept;
+
+    // DataStructure<T> methods
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    // Tree<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+
+    /*
+    A "SourceReader" reads a data structure's elements in iterative order, straight out of
+    its block of elements if it has one (refer to "DataStructure<T>::contiguousElements()") and
+    through an "Iterator_" otherwise.
+    */
+
+    class SourceReader
+    {
+      public:
+                       SourceReader(const DataStructure<T>&);
+
+        const bool     more() const noexcept
+                         {return _index < _count;}
+        const T&       current() const
+                         {return _block != NULL ? _block[_isReversed ? _count - 1U - _index :
+                            _index] : *_iterator->current();}
+        void           next()
+                         {if (_block == NULL) _iterator->next(); ++_index; return;}
+
+      private:
+        bool                                        _isReversed;
+        const T *const                              _block;      // the elements, or NULL
+        const unsigned int                          _count;      // the no. of elements
+        unsigned int                                _index;      // the current element
+        const SDP<typename DataStructure<T>::Iterator_> _iterator;   // if "_block" is NULL
+
+        SourceReader(const SourceReader&);                          // not implemented
+        SourceReader& operator=(const SourceReader&);               // not implemented
+    };
+
+    Node*                  _root;                        // the root node, or NULL if empty
+    unsigned int           _height;                      // no. of levels (leaves are level 1)
+
+    template<class Arg>
+    const bool             add(Arg&&);
+    template<class Arg>
+    void                   splitLeaf(Leaf *const, const unsigned int, Arg&&, Inner *const[],
+                             const unsigned int[]);
+    void                   bulkLoad(const DataStructure<T>&);
+    Leaf *const            findLeaf(const T&, Inner *[], unsigned int[]) const noexcept;
+    const Leaf *const      firstLeaf() const noexcept;
+    void                   rebalanceInner(Inner *const[], const unsigned int[]) noexcept;
+    void                   mergeLeaves(Inner *const, const unsigned int) noexcept;
+    void                   mergeInners(Inner *const, const unsigned int) noexcept;
+
+    static const bool      isSorted(const DataStructure<T>&);
+    static const T&        firstElement(const Node*, unsigned int) noexcept;
+    static void            removeSeparator(Inner *const, const unsigned int) noexcept;
+    static void            moveElements(T *const, T *const, const unsigned int) noexcept;
+    static void            destroyElements(T *const, const unsigned int) noexcept;
+    static void            freeLevel(Node*, const bool) noexcept;
+    static void            prefetch(const void *const, const size_t) noexcept;
+
+    template<class NodeType>
+    static NodeType *const newNode();
+    template<class NodeType>
+    static void            deleteNode(NodeType *const) noexcept;
+};
+
+// ============================================================================================
+// BTREE<T, COMPARE> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Compare> BTree<T, Compare>::BTree() noexcept:
+
+/*
+This constructor instanciates an empty tree.  Nothing is allocated until the first element is
+added.
+*/
+
+  _root(NULL),
+  _height(0U)
+
+{
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> BTree<T, Compare>::BTree
+(
+  const BTree<T, Compare>& source                     // the tree to copy
+):
+
+/*
+This constructor makes a deep copy of "source".  "source's" elements are sorted, so the copy
+is bulk-loaded.
+*/
+
+  _root(NULL),
+  _height(0U)
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> BTree<T, Compare>::BTree
+(
+  const DataStructure<T>& source                      // the data structure to copy from
+):
+
+/*
+This constructor instanciates a tree that holds copies of "source's" elements (without any
+duplicates).  If "source's" elements are in strictly increasing order then the tree is built
+bottom-up in O(n) time; otherwise, they're inserted one at a time.
+
+PRECONDITIONS:
+There must be enough memory for the tree -- otherwise, "Full" will be thrown.
+
+POSTCONDITIONS:
+The tree holds copies of "source's" elements.
+*/
+
+  _root(NULL),
+  _height(0U)
+
+{
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> BTree<T, Compare>& BTree<T, Compare>::operator=
+(
+  const BTree<T, Compare>& source                     // the tree to copy
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> BTree<T, Compare>& BTree<T, Compare>::operator=
+(
+  const DataStructure<T>& source                      // the data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> BTree<T, Compare>& BTree<T, Compare>::operator+=
+(
+  const DataStructure<T>& source                      // the data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const bool BTree<T, Compare>::remove
+(
+  const T& element                                    // the element to remove
+)
+
+/*
+This method removes the element that's equal to "element" and returns true, or returns false
+if there isn't one.
+
+If the leaf that it's removed from has to borrow an element from a neighbour then a copy of
+the element that will separate them has to be made.  "OperationFailed" is thrown, and the tree
+is left alone, if that copy fails.
+*/
+
+{
+  if (_root == NULL)
+    return false;
+
+  Inner*             path[MAX_HEIGHT];
+  unsigned int       slots[MAX_HEIGHT];
+  Leaf *const        leaf     = findLeaf(element, path, slots);
+  T *const           elements = leaf->elements();
+  const unsigned int position = (unsigned int)(std::lower_bound(elements, elements +
+    leaf->count, element, Compare()) - elements);
+
+  if (position == leaf->count || Compare()(element, elements[position]))
+    return false;
+
+  /*
+  What happens to the leaf is worked out (and the new key copied, if one is needed) before
+  anything is changed.
+  */
+
+  Inner *const parent  = _height > 1U ? path[1] : NULL;
+  const unsigned int slot = _height > 1U ? slots[1] : 0U;
+  Leaf *const  left    = parent != NULL && slot > 0U ?
+    static_cast<Leaf*>(parent->children[slot - 1U]) : NULL;
+  Leaf *const  right   = parent != NULL && slot < parent->count ?
+    static_cast<Leaf*>(parent->children[slot + 1U]) : NULL;
+  const bool   isShort = parent != NULL && leaf->count - 1U < MIN_LEAF;
+  const bool   fromLeft  = isShort && left != NULL && left->count > MIN_LEAF;
+  const bool   fromRight = isShort && !fromLeft && right != NULL && right->count > MIN_LEAF;
+
+  alignas(T) unsigned char separatorStorage[sizeof(T)] = {};    // built iff borrowing
+  T *const                 separator = reinterpret_cast<T*>(separatorStorage);
+
+  if (fromLeft || fromRight)
+  {
+    try
+    {
+      new(separator) T(fromLeft ? left->elements()[left->count - 1U] : right->elements()[1]);
+    }
+    catch (...)
+    {
+      throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+    }
+  }
+
+  elements[position].~T();
+  moveElements(elements + position, elements + position + 1U, leaf->count - position - 1U);
+  --leaf->count;
+  --this->_numElements;
+
+  if (fromLeft)
+  {
+    moveElements(elements + 1U, elements, leaf->count);
+    moveElements(elements, left->elements() + left->count - 1U, 1U);
+    --left->count;
+    ++leaf->count;
+
+    parent->keys()[slot - 1U].~T();
+    moveElements(parent->keys() + slot - 1U, separator, 1U);
+  }
+  else if (fromRight)
+  {
+    moveElements(elements + leaf->count, right->elements(), 1U);
+    ++leaf->count;
+    moveElements(right->elements(), right->elements() + 1U, right->count - 1U);
+    --right->count;
+
+    parent->keys()[slot].~T();
+    moveElements(parent->keys() + slot, separator, 1U);
+  }
+  else if (isShort)
+  {
+    mergeLeaves(parent, left != NULL ? slot - 1U : slot);
+    rebalanceInner(path, slots);
+  }
+  else if (leaf->count == 0U)
+  {
+    deleteNode(leaf);
+    _root   = NULL;
+    _height = 0U;
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const T *const BTree<T, Compare>::find
+(
+  const T& element                                    // the element to look for
+)
+const noexcept
+
+/*
+This method returns a pointer to the element in the tree that's equal to "element", or NULL if
+there isn't one.
+*/
+
+{
+  if (_root == NULL)
+    return NULL;
+
+  const Leaf *const leaf     = findLeaf(element, NULL, NULL);
+  const T *const    elements = leaf->elements();
+  const T *const    found    = std::lower_bound(elements, elements + leaf->count, element,
+    Compare());
+
+  return found != elements + leaf->count && !Compare()(element, *found) ? found : NULL;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename BTree<T, Compare>::ConstElementIterator BTree<T, Compare>::lowerBound
+(
+  const T& element                                    // the element to look for
+)
+const noexcept
+
+/*
+This method returns an iterator at the smallest element that isn't less than "element", or
+"end()" if there isn't one.  If every element in the leaf that the search ends in is less than
+"element" then the answer is the first element of the next leaf.
+*/
+
+{
+  if (_root == NULL)
+    return end();
+
+  const Leaf *const  leaf     = findLeaf(element, NULL, NULL);
+  const T *const     elements = leaf->elements();
+  const unsigned int position = (unsigned int)(std::lower_bound(elements, elements +
+    leaf->count, element, Compare()) - elements);
+
+  if (position == leaf->count)
+    return ConstElementIterator(static_cast<const Leaf*>(leaf->next));
+
+  return ConstElementIterator(leaf, position);
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void BTree<T, Compare>::empty() noexcept
+
+/*
+This method removes every element, a level at a time from the root down.
+*/
+
+{
+  Node* first(_root);
+
+  for (unsigned int level = _height; level > 0U; --level)
+  {
+    Node *const below = level > 1U ? static_cast<Inner*>(first)->children[0] : NULL;
+
+    freeLevel(first, level == 1U);
+    first = below;
+  }
+
+  _root              = NULL;
+  _height            = 0U;
+  this->_numElements = 0U;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void BTree<T, Compare>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method adds copies of the elements of "source" that aren't already in the tree.  If the
+tree is empty and "source's" elements are in strictly increasing order then the tree is
+bulk-loaded from them.
+*/
+
+{
+  if (&source == this || source.numElements() == 0U)
+    return;
+
+  if (_root == NULL && isSorted(source))
+    bulkLoad(source);
+  else
+  {
+    for (SourceReader reader(source); reader.more(); reader.next())
+      add(reader.current());
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T, class Compare> void BTree<T, Compare>::assertInvariants() const noexcept
+
+  {
+    assert((_root == NULL) == (this->_numElements == 0U));
+    assert((_root == NULL) == (_height == 0U));
+    assert(_height <= MAX_HEIGHT);
+    assert(_root == NULL || _root->next == NULL);
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T, class Compare> template<class Arg> const bool BTree<T, Compare>::add
+(
+  Arg&& element                                       // the element to add
+)
+
+/*
+This method adds "element" (copied or moved, as "Arg" says) and returns true, or returns false
+if an equal element is already in the tree.
+*/
+
+{
+  if (_root == NULL)
+  {
+    Leaf *const leaf = newNode<Leaf>();
+
+    try
+    {
+      new(leaf->elements()) T(std::forward<Arg>(element));
+    }
+    catch (...)
+    {
+      deleteNode(leaf);
+      throw OperationFailed("Unable to copy an element into a new node.", __FILE__, __LINE__);
+    }
+
+    leaf->count        = 1U;
+    _root              = leaf;
+    _height            = 1U;
+    this->_numElements = 1U;
+
+    return true;
+  }
+
+  Inner*             path[MAX_HEIGHT];
+  unsigned int       slots[MAX_HEIGHT];
+  Leaf *const        leaf     = findLeaf(element, path, slots);
+  T *const           elements = leaf->elements();
+  const unsigned int position = (unsigned int)(std::lower_bound(elements, elements +
+    leaf->count, element, Compare()) - elements);
+
+  if (position < leaf->count && !Compare()(element, elements[position]))
+    return false;
+
+  if (leaf->count < LEAF_CAPACITY)
+  {
+    moveElements(elements + position + 1U, elements + position, leaf->count - position);
+
+    try
+    {
+      new(elements + position) T(std::forward<Arg>(element));
+    }
+    catch (...)
+    {
+      moveElements(elements + position, elements + position + 1U, leaf->count - position);
+      throw OperationFailed("Unable to copy an element into a node.", __FILE__, __LINE__);
+    }
+
+    ++leaf->count;
+  }
+  else
+    splitLeaf(leaf, position, std::forward<Arg>(element), path, slots);
+
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> template<class Arg> void BTree<T, Compare>::splitLeaf
+(
+  Leaf *const        leaf,                            // the full leaf that "element" goes in
+  const unsigned int position,                        // where in "leaf" it goes
+  Arg&&              element,                         // the element to add
+  Inner *const       path[],                          // the inner nodes above "leaf"
+  const unsigned int slots[]                          // which child of each "leaf" is under
+)
+
+/*
+This method adds "element" to a full leaf by splitting it in two.  The new leaf's key goes
+into the parent, splitting that if it's full too, and so on up -- if the root splits then the
+tree gets a new root and grows a level.
+*/
+
+{
+  /*
+  The full inner nodes directly above the leaf are the ones that will split.  The new nodes,
+  the new element and the new leaf's key are all made before anything is changed.
+  */
+
+  unsigned int numSplits(0U);                // no. of inner nodes that will split
+
+  while (numSplits + 1U < _height && path[numSplits + 1U]->count == INNER_CAPACITY)
+    ++numSplits;
+
+  const unsigned int numSpares = numSplits + (numSplits + 1U == _height ? 1U : 0U);
+  Inner*             spares[MAX_HEIGHT];
+  unsigned int       numAllocated(0U);
+  Leaf*              right(NULL);
+
+  alignas(T) unsigned char elementStorage[sizeof(T)];
+  alignas(T) unsigned char separatorStorage[sizeof(T)];
+  T *const                 newElement = reinterpret_cast<T*>(elementStorage);
+  T *const                 separator  = reinterpret_cast<T*>(separatorStorage);
+  T *const                 elements   = leaf->elements();
+  const unsigned int       leftCount  = (LEAF_CAPACITY + 1U) / 2U;
+  bool                     isElementMade(false);
+
+  try
+  {
+    right = newNode<Leaf>();
+
+    for (; numAllocated < numSpares; ++numAllocated)
+      spares[numAllocated] = newNode<Inner>();
+
+    new(newElement) T(std::forward<Arg>(element));
+    isElementMade = true;
+
+    new(separator) T(position == leftCount ? *newElement :
+      elements[position < leftCount ? leftCount - 1U : leftCount]);
+  }
+  catch (...)
+  {
+    if (isElementMade)
+      newElement->~T();
+
+    while (numAllocated > 0U)
+      deleteNode(spares[--numAllocated]);
+
+    if (right != NULL)
+      deleteNode(right);
+
+    throw OperationFailed("Unable to split a node.", __FILE__, __LINE__);
+  }
+
+  /*
+  The leaf keeps the lowest "leftCount" of its elements and the new one, and the new leaf to
+  its right gets the rest.
+  */
+
+  if (position < leftCount)
+  {
+    moveElements(right->elements(), elements + leftCount - 1U,
+      LEAF_CAPACITY - leftCount + 1U);
+    moveElements(elements + position + 1U, elements + position, leftCount - 1U - position);
+    moveElements(elements + position, newElement, 1U);
+  }
+  else
+  {
+    T *const rightElements = right->elements();
+
+    moveElements(rightElements, elements + leftCount, position - leftCount);
+    moveElements(rightElements + position - leftCount, newElement, 1U);
+    moveElements(rightElements + position - leftCount + 1U, elements + position,
+      LEAF_CAPACITY - position);
+  }
+
+  leaf->count  = leftCount;
+  right->count = LEAF_CAPACITY + 1U - leftCount;
+  right->next  = leaf->next;
+  leaf->next   = right;
+
+  /*
+  Now "separator" and "newChild" go into the parent at "slots[level]", and so on up.
+  */
+
+  Node*        newChild(right);
+  unsigned int numUsed(0U);
+
+  for (unsigned int level = 1U; ; ++level)
+  {
+    if (level == _height)
+    {
+      Inner *const root = spares[numUsed++];
+
+      root->children[0] = _root;
+      root->children[1] = newChild;
+      moveElements(root->keys(), separator, 1U);
+      root->count = 1U;
+
+      _root = root;
+      ++_height;
+      break;
+    }
+
+    Inner *const       parent = path[level];
+    const unsigned int slot   = slots[level];
+    T *const           keys   = parent->keys();
+
+    if (parent->count < INNER_CAPACITY)
+    {
+      moveElements(keys + slot + 1U, keys + slot, parent->count - slot);
+      moveElements(keys + slot, separator, 1U);
+      memmove(parent->children + slot + 2U, parent->children + slot + 1U,
+        sizeof(Node*) * (parent->count - slot));
+      parent->children[slot + 1U] = newChild;
+      ++parent->count;
+      break;
+    }
+
+    /*
+    The parent is full, so its keys and children, with the new ones, are lined up in
+    temporary arrays and dealt out to it and a new sibling.  The middle key goes up a level.
+    */
+
+    alignas(T) unsigned char allKeysStorage[sizeof(T) * (INNER_CAPACITY + 1U)];
+    T *const                 allKeys = reinterpret_cast<T*>(allKeysStorage);
+    Node*                    allChildren[INNER_CAPACITY + 2U];
+    Inner *const             sibling = spares[numUsed++];
+    const unsigned int       middle  = (INNER_CAPACITY + 1U) / 2U;
+
+    moveElements(allKeys, keys, slot);
+    moveElements(allKeys + slot, separator, 1U);
+    moveElements(allKeys + slot + 1U, keys + slot, INNER_CAPACITY - slot);
+
+    memcpy(allChildren, parent->children, sizeof(Node*) * (slot + 1U));
+    allChildren[slot + 1U] = newChild;
+    memcpy(allChildren + slot + 2U, parent->children + slot + 1U,
+      sizeof(Node*) * (INNER_CAPACITY - slot));
+
+    moveElements(keys, allKeys, middle);
+    memcpy(parent->children, allChildren, sizeof(Node*) * (middle + 1U));
+    parent->count = middle;
+
+    moveElements(separator, allKeys + middle, 1U);
+
+    moveElements(sibling->keys(), allKeys + middle + 1U, INNER_CAPACITY - middle);
+    memcpy(sibling->children, allChildren + middle + 1U,
+      sizeof(Node*) * (INNER_CAPACITY - middle + 1U));
+    sibling->count = INNER_CAPACITY - middle;
+    sibling->next  = parent->next;
+    parent->next   = sibling;
+
+    newChild = sibling;
+  }
+
+  assert(numUsed == numSpares);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void BTree<T, Compare>::bulkLoad
+(
+  const DataStructure<T>& source                      // elements in strictly increasing order
+)
+
+/*
+This method builds the tree bottom-up from "source", which must hold at least one element.
+The tree must be empty.
+
+The elements are spread over the fewest leaves that hold them, as evenly as possible, so every
+leaf is at least half full.  Then each level of inner nodes is built the same way over the
+level below -- the keys are copies of the first element under each child but the first --
+until a level has only one node, which is the root.  If anything fails then every node built
+so far is freed.
+*/
+
+{
+  assert(_root == NULL && source.numElements() > 0U);
+
+  Node*        levels[MAX_HEIGHT];                 // the first node on each level so far
+  unsigned int numLevels(0U);
+
+  try
+  {
+    SourceReader       reader(source);
+    const unsigned int numElements = source.numElements();
+    unsigned int       numNodes    = (numElements + LEAF_CAPACITY - 1U) / LEAF_CAPACITY;
+    Node**             link        = &levels[numLevels++];
+
+    *link = NULL;
+
+    for (unsigned int i = 0U; i < numNodes; ++i)
+    {
+      Leaf *const        leaf = newNode<Leaf>();
+      const unsigned int size = numElements / numNodes +
+                                (i < numElements % numNodes ? 1U : 0U);
+
+      *link = leaf;
+      link  = &leaf->next;
+
+      for (; leaf->count < size; ++leaf->count, reader.next())
+        new(leaf->elements() + leaf->count) T(reader.current());
+    }
+
+    for (unsigned int numBelow = numNodes; numBelow > 1U; numBelow = numNodes)
+    {
+      Node* child(levels[numLevels - 1U]);
+
+      numNodes = (numBelow + INNER_CAPACITY) / (INNER_CAPACITY + 1U);
+      link     = &levels[numLevels++];
+      *link    = NULL;
+
+      for (unsigned int i = 0U; i < numNodes; ++i)
+      {
+        Inner *const       inner       = newNode<Inner>();
+        const unsigned int numChildren = numBelow / numNodes +
+          (i < numBelow % numNodes ? 1U : 0U);
+
+        *link = inner;
+        link  = &inner->next;
+
+        inner->children[0] = child;
+        child              = child->next;
+
+        for (unsigned int j = 1U; j < numChildren; ++j)
+        {
+          new(inner->keys() + inner->count) T(firstElement(child, numLevels - 2U));
+          ++inner->count;
+
+          inner->children[j] = child;
+          child              = child->next;
+        }
+      }
+    }
+  }
+  catch (const Full&)
+  {
+    while (numLevels > 0U)
+    {
+      --numLevels;
+      freeLevel(levels[numLevels], numLevels == 0U);
+    }
+
+    throw;
+  }
+  catch (...)
+  {
+    while (numLevels > 0U)
+    {
+      --numLevels;
+      freeLevel(levels[numLevels], numLevels == 0U);
+    }
+
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  _root              = levels[numLevels - 1U];
+  _height            = numLevels;
+  this->_numElements = source.numElements();
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename BTree<T, Compare>::Leaf *const BTree<T, Compare>::findLeaf
+(
+  const T&     element,                               // the element to look for
+  Inner*       path[],                                // gets the inner nodes passed, or NULL
+  unsigned int slots[]                                // gets the children taken, or NULL
+)
+const noexcept
+
+/*
+This method returns the leaf that "element" is in, or would go in.  If "path" and "slots"
+aren't NULL then "path[level]" is set to the inner node that the search passed through on each
+level (counting the leaves as level 0) and "slots[level]" to which of its children it took.
+The tree mustn't be empty.
+*/
+
+{
+  assert(_root != NULL);
+
+  Node* node(_root);
+
+  for (unsigned int level = _height - 1U; level > 0U; --level)
+  {
+    Inner *const       inner = static_cast<Inner*>(node);
+    const unsigned int slot  = (unsigned int)(std::upper_bound(inner->keys(), inner->keys() +
+      inner->count, element, Compare()) - inner->keys());
+
+    if (path != NULL)
+    {
+      path[level]  = inner;
+      slots[level] = slot;
+    }
+
+    node = inner->children[slot];
+    prefetch(node, level > 1U ? sizeof(Inner) : sizeof(Leaf));
+  }
+
+  return static_cast<Leaf*>(node);
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+const typename BTree<T, Compare>::Leaf *const BTree<T, Compare>::firstLeaf() const noexcept
+
+/*
+This method returns the leftmost leaf, or NULL if the tree is empty.
+*/
+
+{
+  const Node* node(_root);
+
+  for (unsigned int level = _height; level > 1U; --level)
+    node = static_cast<const Inner*>(node)->children[0];
+
+  return static_cast<const Leaf*>(node);
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void BTree<T, Compare>::rebalanceInner
+(
+  Inner *const       path[],                          // the inner nodes above a merged leaf
+  const unsigned int slots[]                          // which child of each the path took
+)
+noexcept
+
+/*
+This method fixes up the inner nodes above two leaves that have just been merged, starting
+with their parent ("path[1]").  A node that has fallen below half full borrows a key and a
+child from a neighbour if that neighbour can spare one, and merges with it otherwise, which
+takes a key from the level above -- and so on up.  A root that's left with no keys is replaced
+by its only child.
+*/
+
+{
+  for (unsigned int level = 1U; level < _height; ++level)
+  {
+    Inner *const node = path[level];
+
+    if (level == _height - 1U)
+    {
+      if (node->count == 0U)
+      {
+        _root = node->children[0];
+        deleteNode(node);
+        --_height;
+      }
+
+      break;
+    }
+
+    if (node->count >= MIN_INNER)
+      break;
+
+    Inner *const       parent = path[level + 1U];
+    const unsigned int slot   = slots[level + 1U];
+    Inner *const       left   = slot > 0U ?
+      static_cast<Inner*>(parent->children[slot - 1U]) : NULL;
+    Inner *const       right  = slot < parent->count ?
+      static_cast<Inner*>(parent->children[slot + 1U]) : NULL;
+
+    if (left != NULL && left->count > MIN_INNER)
+    {
+      /*
+      The key between the two nodes comes down to the front of this one, along with the left
+      neighbour's last child, and the left neighbour's last key goes up to replace it.
+      */
+
+      moveElements(node->keys() + 1U, node->keys(), node->count);
+      memmove(node->children + 1U, node->children, sizeof(Node*) * (node->count + 1U));
+      moveElements(node->keys(), parent->keys() + slot - 1U, 1U);
+      node->children[0] = left->children[left->count];
+      moveElements(parent->keys() + slot - 1U, left->keys() + left->count - 1U, 1U);
+
+      --left->count;
+      ++node->count;
+      break;
+    }
+
+    if (right != NULL && right->count > MIN_INNER)
+    {
+      moveElements(node->keys() + node->count, parent->keys() + slot, 1U);
+      node->children[node->count + 1U] = right->children[0];
+      ++node->count;
+
+      moveElements(parent->keys() + slot, right->keys(), 1U);
+      moveElements(right->keys(), right->keys() + 1U, right->count - 1U);
+      memmove(right->children, right->children + 1U, sizeof(Node*) * right->count);
+      --right->count;
+      break;
+    }
+
+    mergeInners(parent, left != NULL ? slot - 1U : slot);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void BTree<T, Compare>::mergeLeaves
+(
+  Inner *const       parent,                          // the parent of the two leaves
+  const unsigned int slot                             // the left leaf's slot in "parent"
+)
+noexcept
+
+/*
+This method moves the elements of child "slot + 1" of "parent" into child "slot", frees the
+emptied leaf and removes it and the key before it from "parent".
+*/
+
+{
+  Leaf *const left  = static_cast<Leaf*>(parent->children[slot]);
+  Leaf *const right = static_cast<Leaf*>(parent->children[slot + 1U]);
+
+  assert(left->count + right->count <= LEAF_CAPACITY);
+
+  moveElements(left->elements() + left->count, right->elements(), right->count);
+  left->count += right->count;
+  left->next   = right->next;
+  deleteNode(right);
+
+  parent->keys()[slot].~T();
+  removeSeparator(parent, slot);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void BTree<T, Compare>::mergeInners
+(
+  Inner *const       parent,                          // the parent of the two inner nodes
+  const unsigned int slot                             // the left node's slot in "parent"
+)
+noexcept
+
+/*
+This method merges child "slot + 1" of "parent" into child "slot".  The key between them comes
+down from "parent" to sit between their keys.
+*/
+
+{
+  Inner *const left  = static_cast<Inner*>(parent->children[slot]);
+  Inner *const right = static_cast<Inner*>(parent->children[slot + 1U]);
+
+  assert(left->count + 1U + right->count <= INNER_CAPACITY);
+
+  moveElements(left->keys() + left->count, parent->keys() + slot, 1U);
+  moveElements(left->keys() + left->count + 1U, right->keys(), right->count);
+  memcpy(left->children + left->count + 1U, right->children,
+    sizeof(Node*) * (right->count + 1U));
+
+  left->count += 1U + right->count;
+  left->next   = right->next;
+  deleteNode(right);
+
+  removeSeparator(parent, slot);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const bool BTree<T, Compare>::isSorted
+(
+  const DataStructure<T>& source                      // the data structure to check
+)
+
+/*
+This function returns true iff every element of "source" is less than the next one.
+*/
+
+{
+  const T* previous(NULL);
+
+  for (SourceReader reader(source); reader.more(); reader.next())
+  {
+    if (previous != NULL && !Compare()(*previous, reader.current()))
+      return false;
+
+    previous = &reader.current();
+  }
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> inline const T& BTree<T, Compare>::firstElement
+(
+  const Node*  node,                                  // the root of a subtree
+  unsigned int level                                  // "node's" level (the leaves are 0)
+)
+noexcept
+
+/*
+This function returns the smallest element in the subtree rooted at "node".
+*/
+
+{
+  for (; level > 0U; --level)
+    node = static_cast<const Inner*>(node)->children[0];
+
+  return static_cast<const Leaf*>(node)->elements()[0];
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> inline void BTree<T, Compare>::removeSeparator
+(
+  Inner *const       node,                            // the inner node to remove from
+  const unsigned int slot                             // the key to remove
+)
+noexcept
+
+/*
+This function closes up the gap left by key "slot" of "node" (which has already been destroyed
+or moved out) and removes child "slot + 1".
+*/
+
+{
+  moveElements(node->keys() + slot, node->keys() + slot + 1U, node->count - slot - 1U);
+  memmove(node->children + slot + 1U, node->children + slot + 2U,
+    sizeof(Node*) * (node->count - slot - 1U));
+  --node->count;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> inline void BTree<T, Compare>::moveElements
+(
+  T *const           destination,                     // where the elements go
+  T *const           source,                          // where the elements are
+  const unsigned int count                            // the no. of elements to move
+)
+noexcept
+
+/*
+This function moves "count" elements from "source" into the unconstructed cells at
+"destination" and leaves "source's" cells unconstructed.  The two runs may overlap.  A
+trivially copyable "T" is moved with one "memmove()".
+*/
+
+{
+  if (std::is_trivially_copyable<T>::value)
+  {
+    if (count > 0U)
+      memmove(static_cast<void*>(destination), source, sizeof(T) * count);
+  }
+  else if (destination < source)
+  {
+    for (unsigned int i = 0U; i < count; ++i)
+    {
+      new(destination + i) T(std::move(source[i]));
+      source[i].~T();
+    }
+  }
+  else if (destination > source)
+  {
+    for (unsigned int i = count; i > 0U; --i)
+    {
+      new(destination + i - 1U) T(std::move(source[i - 1U]));
+      source[i - 1U].~T();
+    }
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> inline void BTree<T, Compare>::destroyElements
+(
+  T *const           first,                           // the first element to destroy
+  const unsigned int count                            // the no. of elements to destroy
+)
+noexcept
+
+{
+  if (!std::is_trivially_destructible<T>::value)
+  {
+    for (unsigned int i = 0U; i < count; ++i)
+      first[i].~T();
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void BTree<T, Compare>::freeLevel
+(
+  Node*      node,                                    // the first node on the level
+  const bool isLeafLevel                              // is it the leaves?
+)
+noexcept
+
+/*
+This function destroys the elements (or keys) in "node" and every node after it on its level,
+and frees the nodes.
+*/
+
+{
+  while (node != NULL)
+  {
+    Node *const next = node->next;
+
+    if (isLeafLevel)
+    {
+      Leaf *const leaf = static_cast<Leaf*>(node);
+
+      destroyElements(leaf->elements(), leaf->count);
+      deleteNode(leaf);
+    }
+    else
+    {
+      Inner *const inner = static_cast<Inner*>(node);
+
+      destroyElements(inner->keys(), inner->count);
+      deleteNode(inner);
+    }
+
+    node = next;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> inline void BTree<T, Compare>::prefetch
+(
+  const void *const node,                             // the node to prefetch
+  const size_t      size                              // its size, in bytes
+)
+noexcept
+
+/*
+This function asks for every cache line of "node" to be loaded.
+*/
+
+{
+  #if defined(__GNUC__)
+    for (size_t offset = 0U; offset < size; offset += CACHE_LINE_SIZE)
+      __builtin_prefetch(static_cast<const char*>(node) + offset);
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> template<class NodeType>
+NodeType *const BTree<T, Compare>::newNode()
+
+/*
+This function returns a new, empty, cache-line-aligned node.  "Full" is thrown if there isn't
+enough memory.
+*/
+
+{
+  void *const memory = ::operator new(sizeof(NodeType), std::align_val_t(alignof(NodeType)),
+    std::nothrow);
+
+  if (memory == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  NodeType *const node = new(memory) NodeType;
+
+  node->count = 0U;
+  node->next  = NULL;
+
+  return node;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> template<class NodeType>
+inline void BTree<T, Compare>::deleteNode
+(
+  NodeType *const node                                // a node made by "newNode()"
+)
+noexcept
+
+{
+  ::operator delete(node, std::align_val_t(alignof(NodeType)));
+  return;
+}
+
+// ============================================================================================
+// BTREE<T, COMPARE>::SOURCEREADER METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Compare> BTree<T, Compare>::SourceReader::SourceReader
+(
+  const DataStructure<T>& source                      // the data structure to read
+):
+
+  _block(source.contiguousElements(_isReversed)),
+  _count(source.numElements()),
+  _index(0U),
+  _iterator(_block == NULL ? source.iterator() : NULL)
+
+{
+  return;
+}
+
+#endif
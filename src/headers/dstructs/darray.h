@@ -0,0 +1,1121 @@
+#ifndef DSTRUCTS_DARRAY_H
+#define DSTRUCTS_DARRAY_H
+
+// ============================================================================================
+//
+// darray.h -- Dynamic Array Template Class
+//
+// ============================================================================================
+
+/*
+This class is a dynamic array -- that is, an array that stores its elements in free store and
+grows as elements are added to it.  A "DArray" is an "Array".
+
+Unlike an "SArray", a "DArray" only holds the elements that have been put into it:  it starts
+out empty, "append()" and "emplace()" add an element at the end, "insert()" adds one element
+or a block of them anywhere, and "remove()" takes them out again.  "numElements()" is the no.
+of elements in the array and "capacity()" is the no. that it has room for before it has to
+grow.
+
+Appending takes amortized constant time:  when the array runs out of room, its capacity is
+doubled (or raised to what's needed, if that's more), so the cost of moving the elements to
+the bigger block is spread over at least as many appends.  "reserve()" grows the capacity
+ahead of time and "shrinkToFit()" releases whatever capacity isn't being used.
+
+Pointers and references to elements -- and "ElementIterator" objects, which are plain
+pointers -- are invalidated by anything that changes the capacity, and by inserting or
+removing elements before them.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+The elements are kept contiguously in a block of raw storage, "_elements", with room for
+"_capacity" of them.  Only the first "_numElements" cells hold constructed elements.
+
+How the elements are moved to a new block depends on "T":
+
+  - If "T" is trivially copyable (and isn't over-aligned) then an element is just its bytes,
+    so moving one is the same as copying it.  The block is allocated with "malloc()" and grown
+    and shrunk with "realloc()", which can often extend the block in place -- and when it
+    can't, it moves the elements with one "memcpy()".  Making room for an insertion is one
+    "memmove()".
+
+  - Otherwise, the elements are move-constructed into the new block (and the old ones are
+    destroyed) if "T's" move constructor can't throw, or copy-constructed if it can.  Copies
+    are all made before anything in the old block is destroyed, so if one of them fails then
+    the new block is thrown away and the array is left as it was.
+
+(C++ has no way to ask whether a type is "trivially relocatable" -- movable by copying its
+bytes -- so trivially copyable is the conservative stand-in.)
+
+Every operation that changes the array either succeeds or leaves it unchanged, except that a
+"remove()" can't be undone if a "T" move assignment operator throws partway through.
+
+"Full" is thrown when memory can't be allocated and "OperationFailed" when an element can't be
+constructed.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <sdp.h>
+#include <dstructs/array.h>
+
+// ============================================================================================
+// DARRAY<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class DArray:
+  virtual public DataStructureExceptions,
+  virtual public Array<T, unsigned int>
+{
+  public:
+                           DArray() noexcept;
+                           DArray(const DArray<T>&);
+                           DArray(const DataStructure<T>&);
+                           DArray(const T *const, const unsigned int);
+                           DArray(const unsigned int, ...);
+    virtual                ~DArray();
+
+    DArray<T>&             operator=(const DArray<T>&);
+    DArray<T>&             operator=(const DataStructure<T>&);
+    DArray<T>&             operator+=(const DataStructure<T>&);
+
+    const unsigned int     capacity() const noexcept
+                             {return _capacity;}
+    void                   reserve(const unsigned int);
+    void                   shrinkToFit();
+
+    void                   append(const T& element)
+                             {emplace(element); return;}
+    void                   append(T&& element)
+                             {emplace(std::move(element)); return;}
+
+    template<class... Args>
+    void                   emplace(Args&&...);
+
+    void                   insert(const unsigned int, const T&);
+    void                   insert(const unsigned int, const T *const, const unsigned int);
+    void                   remove(const unsigned int, const unsigned int = 1U);
+
+    // Element iterators
+
+    typedef T*             ElementIterator;
+    typedef const T*       ConstElementIterator;
+
+    ElementIterator        begin() noexcept
+                             {return _elements;}
+    ElementIterator        end() noexcept
+                             {return _elements + this->_numElements;}
+    ConstElementIterator   begin() const noexcept
+                             {return _elements;}
+    ConstElementIterator   end() const noexcept
+                             {return _elements + this->_numElements;}
+
+    // DataStructure<T> methods
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    virtual const T *const contiguousElements(bool& isReversed) const noexcept
+                             {
+                               isReversed = false;
+                               return this->_numElements > 0U ? _elements : NULL;
+                             }
+
+    // LinearStructure<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&);
+
+    // Array<T, unsigned int> methods
+
+    virtual T&             operator[](const unsigned int&);
+    const T&               operator[](const unsigned int&) const;
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+    static const unsigned int MIN_CAPACITY = 8U;      // the least capacity that growing picks
+
+    /*
+    "IS_REALLOCATABLE" is true iff the elements can be moved by copying their bytes and
+    "malloc()" aligns them well enough -- in which case the block belongs to "malloc()" and
+    "realloc()".
+    */
+
+    static constexpr bool  IS_REALLOCATABLE = std::is_trivially_copyable<T>::value &&
+                             alignof(T) <= alignof(max_align_t);
+
+    T*                     _elements;                // the block, or NULL if "_capacity" is 0
+    unsigned int           _capacity;                // no. of elements the block has room for
+
+    const unsigned int     grownCapacity(const unsigned int) const;
+    void                   setCapacity(const unsigned int);
+    void                   shiftUp(const unsigned int, const unsigned int) noexcept;
+    void                   shiftDown(const unsigned int, const unsigned int) noexcept;
+
+    static T *const        allocate(const unsigned int);
+    static void            deallocate(T *const) noexcept;
+    static void            copy(T *const, const T *const, const unsigned int);
+    static void            transfer(T *const, T *const, const unsigned int);
+    static void            destroy(T *const, const unsigned int) noexcept;
+};
+
+// ============================================================================================
+// DARRAY<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>::DArray() noexcept:
+
+/*
+This constructor instanciates an empty array.  Nothing is allocated until the first element is
+added (or "reserve()" is called).
+*/
+
+  _elements(NULL),
+  _capacity(0U)
+
+{
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>::DArray
+(
+  const DArray<T>& source                             // the array to copy
+):
+
+/*
+This constructor instanciates an array that holds copies of "source's" elements.  Its capacity
+is exactly "source.numElements()".
+*/
+
+  _elements(NULL),
+  _capacity(0U)
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>::DArray
+(
+  const DataStructure<T>& source                      // the data structure to copy
+):
+
+/*
+This constructor instanciates an array that holds copies of "source's" elements in "source's"
+iteration order (refer to "concatenate()").
+*/
+
+  _elements(NULL),
+  _capacity(0U)
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>::DArray
+(
+  const T *const     source,                          // the block of elements to copy
+  const unsigned int count                            // the no. of elements in "source"
+):
+
+/*
+This constructor instanciates an array that holds copies of the "count" elements in "source".
+*/
+
+  _elements(NULL),
+  _capacity(0U)
+
+{
+  insert(0U, source, count);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>::DArray
+(
+  const unsigned int numElements,         // the # of elements in the parameter list
+  ...                                     // the elements to be put in the array (in order)
+)
+
+/*
+This constructor creates a new array that contains copies of the elements passed in the
+parameter list, in the order in which they appear.
+
+Note:  due to type promotion issues, "T" cannot be "char", "unsigned char" or "float".
+*/
+
+:
+  _elements(NULL),
+  _capacity(0U)
+
+{
+  va_list argList;                            // for managing the argument list
+
+  reserve(numElements);
+  va_start(argList, numElements);
+
+  try
+  {
+    for (unsigned int i = 0U; i < numElements; ++i)
+      append(va_arg(argList, T));
+  }
+  catch (...)
+  {
+    va_end(argList);
+    empty();
+    deallocate(_elements);
+    throw;
+  }
+
+  va_end(argList);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>::~DArray()
+
+{
+  empty();
+  deallocate(_elements);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>& DArray<T>::operator=
+(
+  const DArray<T>& source                             // the array to copy
+)
+
+{
+  return operator=(static_cast<const DataStructure<T>&>(source));
+}
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>& DArray<T>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method replaces the array's elements with copies of "source's".  The capacity is kept if
+it's big enough.
+*/
+
+{
+  if (&source != static_cast<const DataStructure<T>*>(this))
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> DArray<T>& DArray<T>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::reserve
+(
+  const unsigned int minCapacity              // the no. of elements that must fit
+)
+
+/*
+This method makes sure that the array has room for at least "minCapacity" elements, so that
+adding elements up to that many won't move them.
+
+POSTCONDITIONS:
+"capacity()" is at least "minCapacity".
+*/
+
+{
+  if (minCapacity > _capacity)
+    setCapacity(minCapacity);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::shrinkToFit()
+
+/*
+This method releases the capacity that isn't being used.  An empty array releases its block
+altogether.
+
+POSTCONDITIONS:
+"capacity()" equals "numElements()".
+*/
+
+{
+  if (_capacity > this->_numElements)
+    setCapacity(this->_numElements);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void DArray<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" at the end of the array.  If the array
+is full then it grows first (refer to "grownCapacity()").
+
+"arguments" may refer to elements of this array:  when the array has to grow, the new element
+is constructed before the old block is released (or, for a "T" that "realloc()" can move,
+into a temporary that's copied in afterward).
+
+POSTCONDITIONS:
+The new element is the last one in the array.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int count = this->_numElements;
+
+  if (count < _capacity)
+  {
+    try
+    {
+      new(_elements + count) T(std::forward<Args>(arguments)...);
+    }
+    catch (...)
+    {
+      throw OperationFailed("Unable to add an element to a DArray.", __FILE__, __LINE__);
+    }
+  }
+  else if constexpr (IS_REALLOCATABLE)
+  {
+    T* element(NULL);
+    alignas(T) unsigned char temporary[sizeof(T)] = {};  // "T" may not set every byte
+
+    try
+    {
+      element = new(temporary) T(std::forward<Args>(arguments)...);
+    }
+    catch (...)
+    {
+      throw OperationFailed("Unable to add an element to a DArray.", __FILE__, __LINE__);
+    }
+
+    setCapacity(grownCapacity(count + 1U));
+    memcpy((void*)(_elements + count), element, sizeof(T));
+  }
+  else
+  {
+    const unsigned int newCapacity = grownCapacity(count + 1U);
+    T *const           newElements = allocate(newCapacity);
+
+    try
+    {
+      new(newElements + count) T(std::forward<Args>(arguments)...);
+    }
+    catch (...)
+    {
+      deallocate(newElements);
+      throw OperationFailed("Unable to add an element to a DArray.", __FILE__, __LINE__);
+    }
+
+    try
+    {
+      transfer(newElements, _elements, count);
+    }
+    catch (...)
+    {
+      newElements[count].~T();
+      deallocate(newElements);
+      throw;
+    }
+
+    destroy(_elements, count);
+    deallocate(_elements);
+    _elements = newElements;
+    _capacity = newCapacity;
+  }
+
+  ++this->_numElements;
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::insert
+(
+  const unsigned int index,                  // where the new element goes
+  const T&           element                 // the element to insert
+)
+
+/*
+This method inserts a copy of "element" before element "index" (or at the end, if "index" is
+"numElements()").  Refer to the other "insert()".
+*/
+
+{
+  if (index == this->_numElements)
+    emplace(element);
+  else
+    insert(index, &element, 1U);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::insert
+(
+  const unsigned int index,                  // where the new elements go
+  const T *const     block,                  // the block of elements to insert
+  const unsigned int count                   // the no. of elements in "block"
+)
+
+/*
+This method inserts copies of the "count" elements in "block" before element "index" (or at
+the end, if "index" is "numElements()").  The elements after them are moved up once, by
+"count" places, and the array grows (at most) once.
+
+"block" may be part of this array.
+
+PRECONDITIONS:
+"index" can't be more than "numElements()".
+
+POSTCONDITIONS:
+"block[0]" through "block[count - 1]" are copied to elements "index" through
+"index + count - 1".
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (index > this->_numElements)
+    throw OperationFailed("The index is out of range.", __FILE__, __LINE__);
+
+  if (count == 0U)
+    return;
+
+  assert(block != NULL);
+
+  /*
+  If "block" is part of this array then it's copied out first, since opening the gap will move
+  it (and may free it).
+  */
+
+  if (block >= _elements && block < _elements + this->_numElements)
+  {
+    DArray<T> copies(block, count);
+
+    insert(index, copies._elements, count);
+    return;
+  }
+
+  const unsigned int numElements = this->_numElements;
+  const unsigned int numAfter    = numElements - index;
+
+  if (count > ~0U - numElements)
+    throw Full(__FILE__, __LINE__);
+
+  if constexpr (IS_REALLOCATABLE)
+  {
+    if (numElements + count > _capacity)
+      setCapacity(grownCapacity(numElements + count));
+
+    shiftUp(index, count);
+    memcpy((void*)(_elements + index), block, sizeof(T) * count);
+  }
+  else if (numElements + count <= _capacity && std::is_nothrow_move_constructible<T>::value)
+  {
+    shiftUp(index, count);
+
+    try
+    {
+      copy(_elements + index, block, count);
+    }
+    catch (...)
+    {
+      shiftDown(index, count);
+      throw;
+    }
+  }
+  else
+  {
+    /*
+    The array has to grow (or its elements can't be moved without exceptions), so the new
+    elements and the old ones are constructed straight into their places in a new block, and
+    the old block is only released once all of them are there.
+    */
+
+    const unsigned int newCapacity = numElements + count > _capacity ?
+      grownCapacity(numElements + count) : _capacity;
+    T *const           newElements = allocate(newCapacity);
+
+    try
+    {
+      copy(newElements + index, block, count);
+    }
+    catch (...)
+    {
+      deallocate(newElements);
+      throw;
+    }
+
+    try
+    {
+      transfer(newElements, _elements, index);
+
+      try
+      {
+        transfer(newElements + index + count, _elements + index, numAfter);
+      }
+      catch (...)
+      {
+        destroy(newElements, index);
+        throw;
+      }
+    }
+    catch (...)
+    {
+      destroy(newElements + index, count);
+      deallocate(newElements);
+      throw;
+    }
+
+    destroy(_elements, numElements);
+    deallocate(_elements);
+    _elements = newElements;
+    _capacity = newCapacity;
+  }
+
+  this->_numElements += count;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::remove
+(
+  const unsigned int index,                  // the first element to remove
+  const unsigned int count                   // the no. of elements to remove
+)
+
+/*
+This method removes elements "index" through "index + count - 1".  The elements after them are
+moved down by "count" places.  The capacity doesn't change.
+
+PRECONDITIONS:
+The elements to remove must all be in the array.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (index > this->_numElements || count > this->_numElements - index)
+    throw OperationFailed("The index is out of range.", __FILE__, __LINE__);
+
+  if (count == 0U)
+    return;
+
+  T *const first = _elements + index;
+  T *const last  = _elements + this->_numElements;
+
+  if constexpr (std::is_trivially_copyable<T>::value)
+    memmove((void*)first, first + count, sizeof(T) * (last - first - count));
+  else
+  {
+    try
+    {
+      std::move(first + count, last, first);
+    }
+    catch (...)
+    {
+      throw OperationFailed("Element move operation failed.", __FILE__, __LINE__);
+    }
+
+    destroy(last - count, count);
+  }
+
+  this->_numElements -= count;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::empty() noexcept
+
+/*
+This method destroys every element in the array.  The capacity doesn't change.
+*/
+
+{
+  destroy(_elements, this->_numElements);
+  this->_numElements = 0U;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method appends copies of "source's" elements in "source's" iteration order.  The array
+grows (at most) once, to exactly the size that's needed if it has to.
+
+If "source's" elements are contiguous and in iterative order (refer to
+"DataStructure<T>::contiguousElements()") then they're inserted as a block (refer to
+"insert()"); otherwise they're appended through an "Iterator_" and, if one of the copies fails,
+the ones already appended are removed again.
+*/
+
+{
+  const unsigned int count = source.numElements();
+  bool               isReversed;
+  const T *const     block   = source.contiguousElements(isReversed);
+
+  if (count == 0U)
+    return;
+
+  if (count > ~0U - this->_numElements)
+    throw Full(__FILE__, __LINE__);
+
+  reserve(this->_numElements + count);
+
+  if (block != NULL && !isReversed)
+  {
+    insert(this->_numElements, block, count);
+    return;
+  }
+
+  const unsigned int oldNumElements = this->_numElements;
+
+  try
+  {
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+    for (; i->more(); i->next())
+    {
+      assert(i->current() != NULL);
+      emplace(*i->current());
+    }
+  }
+  catch (...)
+  {
+    destroy(_elements + oldNumElements, this->_numElements - oldNumElements);
+    this->_numElements = oldNumElements;
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> T& DArray<T>::operator[]
+(
+  const unsigned int& index                                     // the element to get
+)
+
+/*
+This method returns element "index".  "OperationFailed" is thrown if there's no such element.
+*/
+
+{
+  if (index >= this->_numElements)
+    throw OperationFailed("The index is out of range.", __FILE__, __LINE__);
+
+  return _elements[index];
+}
+
+/*********************************************************************************************/
+
+template<class T> const T& DArray<T>::operator[]
+(
+  const unsigned int& index                                     // the element to get
+)
+const
+
+{
+  if (index >= this->_numElements)
+    throw OperationFailed("The index is out of range.", __FILE__, __LINE__);
+
+  return _elements[index];
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void DArray<T>::assertInvariants() const noexcept
+
+  {
+    assert(this->_numElements <= _capacity);
+    assert((_capacity == 0U) == (_elements == NULL));
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> const unsigned int DArray<T>::grownCapacity
+(
+  const unsigned int minCapacity                      // the no. of elements that must fit
+)
+const
+
+/*
+This method returns the capacity to grow to when the array needs room for "minCapacity"
+elements:  double the current capacity (but at least "MIN_CAPACITY"), or "minCapacity" if
+that's more.  Doubling is what makes appending take amortized constant time.
+*/
+
+{
+  const unsigned int largest = ~0U / sizeof(T);       // the most elements that can be sized
+
+  if (minCapacity > largest)
+    throw Full(__FILE__, __LINE__);
+
+  const unsigned int doubled = _capacity > largest / 2U ? largest : _capacity * 2U;
+
+  return std::max(minCapacity, std::max(doubled, (unsigned int)MIN_CAPACITY));
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::setCapacity
+(
+  const unsigned int newCapacity                      // the new no. of elements to hold
+)
+
+/*
+This method moves the elements to a block with room for exactly "newCapacity" elements (or
+releases the block, if "newCapacity" is 0).  If it fails then the array is left as it was.
+
+PRECONDITIONS:
+"newCapacity" can't be less than "numElements()".
+*/
+
+{
+  assert(newCapacity >= this->_numElements);
+
+  if (newCapacity == _capacity)
+    return;
+
+  if constexpr (IS_REALLOCATABLE)
+  {
+    T* newElements(NULL);
+
+    if (newCapacity > 0U)
+    {
+      if ((size_t)newCapacity > (size_t)-1 / sizeof(T))
+        throw Full(__FILE__, __LINE__);
+
+      newElements = static_cast<T*>(realloc(_elements, sizeof(T) * newCapacity));
+
+      if (newElements == NULL)
+        throw Full(__FILE__, __LINE__);
+    }
+    else
+      free(_elements);
+
+    _elements = newElements;
+  }
+  else
+  {
+    T *const newElements = newCapacity > 0U ? allocate(newCapacity) : NULL;
+
+    try
+    {
+      transfer(newElements, _elements, this->_numElements);
+    }
+    catch (...)
+    {
+      deallocate(newElements);
+      throw;
+    }
+
+    destroy(_elements, this->_numElements);
+    deallocate(_elements);
+    _elements = newElements;
+  }
+
+  _capacity = newCapacity;
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::shiftUp
+(
+  const unsigned int index,                  // the first element to move
+  const unsigned int count                   // the no. of places to move the elements
+)
+noexcept
+
+/*
+This method moves elements "index" onward up by "count" places, leaving cells "index" through
+"index + count - 1" unconstructed.  "_numElements" isn't changed.
+
+PRECONDITIONS:
+There must be room for the moved elements, and "T" must be trivially copyable or have a move
+constructor that can't throw.
+*/
+
+{
+  T *const           first    = _elements + index;
+  const unsigned int numAfter = this->_numElements - index;
+
+  if constexpr (std::is_trivially_copyable<T>::value)
+    memmove((void*)(first + count), first, sizeof(T) * numAfter);
+  else
+  {
+    for (unsigned int i = numAfter; i > 0U; --i)
+    {
+      new(first + count + i - 1U) T(std::move(first[i - 1U]));
+      first[i - 1U].~T();
+    }
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::shiftDown
+(
+  const unsigned int index,                  // where the unconstructed cells start
+  const unsigned int count                   // the no. of unconstructed cells
+)
+noexcept
+
+/*
+This method undoes "shiftUp()":  it moves the elements after the "count" unconstructed cells
+at "index" back down by "count" places.  The same preconditions apply.
+*/
+
+{
+  T *const           first    = _elements + index;
+  const unsigned int numAfter = this->_numElements - index;
+
+  if constexpr (std::is_trivially_copyable<T>::value)
+    memmove((void*)first, first + count, sizeof(T) * numAfter);
+  else
+  {
+    for (unsigned int i = 0U; i < numAfter; ++i)
+    {
+      new(first + i) T(std::move(first[count + i]));
+      first[count + i].~T();
+    }
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> T *const DArray<T>::allocate
+(
+  const unsigned int capacity                        // the no. of elements to make room for
+)
+
+/*
+This function returns a new block with room for "capacity" elements.  "Full" is thrown if
+there isn't enough memory.
+*/
+
+{
+  void* block(NULL);
+
+  if ((size_t)capacity <= (size_t)-1 / sizeof(T))
+  {
+    block = IS_REALLOCATABLE ? malloc(sizeof(T) * capacity) :
+      ::operator new(sizeof(T) * capacity, std::align_val_t(alignof(T)), std::nothrow);
+  }
+
+  if (block == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  return static_cast<T*>(block);
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::deallocate
+(
+  T *const block                                     // a block from "allocate()", or NULL
+)
+noexcept
+
+{
+  if constexpr (IS_REALLOCATABLE)
+    free(block);
+  else
+    ::operator delete(block, std::align_val_t(alignof(T)));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::copy
+(
+  T *const           destination,                    // unconstructed cells
+  const T *const     source,                         // the elements to copy
+  const unsigned int count                           // the no. of elements to copy
+)
+
+/*
+This function copy-constructs "count" cells at "destination" from "source".  If a copy fails
+then the copies already made are destroyed and "OperationFailed" is thrown.
+*/
+
+{
+  unsigned int i(0U);
+
+  try
+  {
+    for (; i < count; ++i)
+      new(destination + i) T(source[i]);
+  }
+  catch (...)
+  {
+    destroy(destination, i);
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::transfer
+(
+  T *const           destination,                    // unconstructed cells
+  T *const           source,                         // the elements to transfer
+  const unsigned int count                           // the no. of elements to transfer
+)
+
+/*
+This function move-constructs (or, if "T's" move constructor can throw, copy-constructs)
+"count" cells at "destination" from "source".  The originals are left for the caller to
+destroy.  If a copy fails then the copies already made are destroyed, "source" is left alone
+and "OperationFailed" is thrown.
+*/
+
+{
+  if constexpr (std::is_trivially_copyable<T>::value)
+  {
+    if (count > 0U)
+      memcpy((void*)destination, source, sizeof(T) * count);
+  }
+  else
+  {
+    unsigned int i(0U);
+
+    try
+    {
+      for (; i < count; ++i)
+        new(destination + i) T(std::move_if_noexcept(source[i]));
+    }
+    catch (...)
+    {
+      destroy(destination, i);
+      throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+    }
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DArray<T>::destroy
+(
+  T *const           first,                          // the first element to destroy
+  const unsigned int count                           // the no. of elements to destroy
+)
+noexcept
+
+/*
+This function destroys "count" elements.  If "T" has a trivial destructor then nothing is done
+at all.
+*/
+
+{
+  if constexpr (!std::is_trivially_destructible<T>::value)
+  {
+    for (unsigned int i = 0U; i < count; ++i)
+      first[i].~T();
+  }
+
+  return;
+}
+
+#endif
@@ -0,0 +1,1009 @@
+#ifndef DSTRUCTS_DASSOCARRAY_H
+#define DSTRUCTS_DASSOCARRAY_H
+
+// ============================================================================================
+//
+// dassocarray.h -- Dynamic Associative Array Template Class
+//
+// ============================================================================================
+
+/*
+This class is a dynamic associative array -- that is, a hash table that stores its elements in
+free store.  A "DAssocArray" is an "Array" whose key is any type that "Hash" can hash and that
+has an "==" operator.
+
+As with "std::map", subscripting a "DAssocArray" with a key that isn't in it adds a
+default-constructed element with that key; "find()" and "contains()" look a key up without
+adding it, and "insert()" and "remove()" add and remove elements explicitly:
+
+  DAssocArray<unsigned int, std::string> wordCounts;
+
+  ++wordCounts["the"];
+
+  if (const unsigned int *const count = wordCounts.find("cat"))
+    ...
+
+The elements are iterated in no particular order.  An "ElementIterator" also has a "key()"
+method that returns the current element's key.  Pointers and references to elements -- and
+iterators -- are invalidated by anything that adds an element.
+
+A "DAssocArray" can only be concatenated with another "DAssocArray" (with the same types),
+since the elements of any other data structure don't have keys.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+This is a "Swiss table":  an open-addressing hash table whose slots are described by a
+separate array of one-byte control codes, 16 to a group.  A control code is either "EMPTY",
+"DELETED" (a tombstone) or, for a slot that holds an element, the top 7 bits of the element's
+key's hash ("H2").
+
+  control codes:  | 23 | E  | 05 | 7A | D  | E  | 11 | ... (16 per group)
+  slots:          | k,v|    | k,v| k,v|    |    | k,v| ...
+
+A lookup hashes the key once.  The rest of the hash ("H1") picks the group to start at; the
+group's 16 control codes are loaded with a single SSE2 instruction and compared with "H2" in
+one more, which gives a bit mask of the slots that are worth comparing keys in -- usually none
+or one.  If the group has an "EMPTY" slot then the key isn't in the table; otherwise the next
+group in the probe sequence is tried.  So a lookup touches one 16-byte group (one cache miss)
+and then, usually, one slot (the other).  Without SSE2, the groups are scanned a byte at a
+time with the same logic.
+
+The groups are probed in triangular order (the group after "g" is "g + 1", then "g + 1 + 2",
+then "g + 1 + 2 + 3" and so on, modulo the no. of groups), which visits every group once when
+the no. of groups is a power of two.
+
+The table never gets more than 7/8 full, counting tombstones, so every probe sequence reaches
+an "EMPTY" slot.  "_growthLeft" is how many more elements can go into "EMPTY" slots before
+that limit is reached.  When it runs out, the table is rehashed into a block twice the size --
+or the same size, if at least half of the used slots are tombstones.  "shrinkToFit()" rehashes
+into the smallest block that holds the elements at no more than 7/8 full, and "reserve()" into
+one that can take a given no. of elements without growing.
+
+Removing an element only leaves a tombstone if its group has no "EMPTY" slot.  A group with an
+"EMPTY" slot has never been full since the last rehash, so no probe sequence has ever passed
+through it, and its slot can simply be made "EMPTY" again.
+
+The control codes and the slots are in one block:  "capacity()" control codes and then
+"capacity()" slots.  The hash is passed through a 64-bit finalizer before it's used, since
+"std::hash" is the identity function for integers on some platforms and the table needs every
+bit of the hash to be well mixed.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define DSTRUCTS_DASSOCARRAY_SSE2
+#endif
+
+#include <dstructs/array.h>
+
+// ============================================================================================
+// DASSOCARRAY<T, KEY, HASH> CLASS DECLARATION
+// ============================================================================================
+
+template<class T, class Key, class Hash = std::hash<Key> > class DAssocArray:
+  virtual public DataStructureExceptions,
+  virtual public Array<T, Key>
+{
+  public:
+                           DAssocArray() noexcept;
+                           DAssocArray(const DAssocArray<T, Key, Hash>&);
+    virtual                ~DAssocArray();
+
+    DAssocArray<T, Key, Hash>& operator=(const DAssocArray<T, Key, Hash>&);
+    DAssocArray<T, Key, Hash>& operator+=(const DataStructure<T>&);
+
+    const unsigned int     capacity() const noexcept
+                             {return _capacity;}
+    void                   reserve(const unsigned int);
+    void                   shrinkToFit();
+
+    T *const               find(const Key&) noexcept;
+    const T *const         find(const Key&) const noexcept;
+    const bool             contains(const Key& key) const noexcept
+                             {return find(key) != NULL;}
+    const bool             insert(const Key&, const T&);
+    const bool             remove(const Key&) noexcept;
+
+  protected:
+    class Slot
+    {
+      public:
+        Key       key;
+        T         element;
+
+                  template<class... Args>
+                  Slot(const Key& newKey, Args&&... arguments):
+                    key(newKey), element(std::forward<Args>(arguments)...) {return;}
+    };
+
+  public:
+
+    // Element iterators
+
+    /*
+    The element iterators visit the slots that hold elements, in slot order.  Incrementing one
+    skips over the empty slots by looking at their control codes only.
+    */
+
+    template<class Element> class SlotIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                      SlotIterator(const signed char *const controls = NULL,
+                        Slot *const slots = NULL, const unsigned int index = 0U,
+                        const unsigned int capacity = 0U) noexcept:
+                        _controls(controls), _slots(slots), _index(index),
+                        _capacity(capacity) {skipEmpty(); return;}
+                      SlotIterator(const SlotIterator<T>& source) noexcept:
+                        _controls(source._controls), _slots(source._slots),
+                        _index(source._index), _capacity(source._capacity) {return;}
+
+        Element&      operator*() const noexcept
+                        {return _slots[_index].element;}
+        Element*      operator->() const noexcept
+                        {return &_slots[_index].element;}
+        const Key&    key() const noexcept
+                        {return _slots[_index].key;}
+        SlotIterator& operator++() noexcept
+                        {++_index; skipEmpty(); return *this;}
+        SlotIterator  operator++(int) noexcept
+                        {const SlotIterator old(*this); ++*this; return old;}
+
+        const bool    operator==(const SlotIterator& rhs) const noexcept
+                        {return _index == rhs._index;}
+        const bool    operator!=(const SlotIterator& rhs) const noexcept
+                        {return _index != rhs._index;}
+
+      private:
+        const signed char* _controls;               // the table's control codes
+        Slot*              _slots;                  // the table's slots
+        unsigned int       _index;                  // the current slot, or "_capacity"
+        unsigned int       _capacity;               // the table's "capacity()"
+
+        void               skipEmpty() noexcept
+                             {
+                               while (_index < _capacity && _controls[_index] < 0)
+                                 ++_index;
+
+                               return;
+                             }
+
+        friend class SlotIterator<const T>;
+    };
+
+    typedef SlotIterator<T>       ElementIterator;
+    typedef SlotIterator<const T> ConstElementIterator;
+
+    ElementIterator        begin() noexcept
+                             {return ElementIterator(_controls, _slots, 0U, _capacity);}
+    ElementIterator        end() noexcept
+                             {return ElementIterator(_controls, _slots, _capacity, _capacity);}
+    ConstElementIterator   begin() const noexcept
+                             {return ConstElementIterator(_controls, _slots, 0U, _capacity);}
+    ConstElementIterator   end() const noexcept
+                             {return ConstElementIterator(_controls, _slots, _capacity,
+                                _capacity);}
+
+    // DataStructure<T> methods
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    // LinearStructure<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&);
+
+    // Array<T, Key> methods
+
+    virtual T&             operator[](const Key&);
+    const T&               operator[](const Key&) const;
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+    static const unsigned int GROUP_SIZE = 16U;      // control codes per group
+    static const signed char  EMPTY      = -128;     // control code of a never-used slot
+    static const signed char  DELETED    = -2;       // control code of a tombstone
+
+    /*
+    A "Group" is the 16 control codes starting at a group boundary.  Each "match" method
+    returns a bit mask with bit "i" set iff control code "i" matches.
+    */
+
+    class Group
+    {
+      public:
+                       Group(const signed char *const codes) noexcept:
+                         _codes(codes) {return;}
+
+        const unsigned int match(const signed char) const noexcept;
+        const unsigned int matchEmpty() const noexcept
+                             {return match(EMPTY);}
+        const unsigned int matchNotFull() const noexcept;
+
+      private:
+        const signed char *const _codes;
+    };
+
+    signed char*           _controls;        // "_capacity" control codes, or NULL
+    Slot*                  _slots;           // "_capacity" slots (after the control codes)
+    unsigned int           _capacity;        // a power of two (at least 16), or 0
+    unsigned int           _growthLeft;      // no. of "EMPTY" slots that may still be used
+    unsigned int           _numDeleted;      // no. of tombstones
+
+    static const uint64_t  hashOf(const Key&) noexcept;
+    static const unsigned int maxLoad(const unsigned int) noexcept;
+    static const unsigned int lowestBit(const unsigned int) noexcept;
+
+    const unsigned int     findSlot(const Key&, const uint64_t) const noexcept;
+    const unsigned int     findNotFull(const uint64_t) const noexcept;
+    template<class... Args>
+    T&                     add(const Key&, const uint64_t, Args&&...);
+    void                   rehash(const unsigned int);
+    void                   setControl(const unsigned int, const signed char) noexcept;
+};
+
+// ============================================================================================
+// DASSOCARRAY<T, KEY, HASH> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> DAssocArray<T, Key, Hash>::DAssocArray() noexcept:
+
+/*
+This constructor instanciates an empty associative array.  Nothing is allocated until the first
+element is added (or "reserve()" is called).
+*/
+
+  _controls(NULL),
+  _slots(NULL),
+  _capacity(0U),
+  _growthLeft(0U),
+  _numDeleted(0U)
+
+{
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> DAssocArray<T, Key, Hash>::DAssocArray
+(
+  const DAssocArray<T, Key, Hash>& source                        // the array to copy
+):
+
+/*
+This constructor instanciates an associative array that holds copies of "source's" keys and
+elements.
+*/
+
+  _controls(NULL),
+  _slots(NULL),
+  _capacity(0U),
+  _growthLeft(0U),
+  _numDeleted(0U)
+
+{
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    ::operator delete(_controls, std::align_val_t(alignof(Slot) > 16U ? alignof(Slot) : 16U));
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> DAssocArray<T, Key, Hash>::~DAssocArray()
+
+{
+  empty();
+  ::operator delete(_controls, std::align_val_t(alignof(Slot) > 16U ? alignof(Slot) : 16U));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash>
+DAssocArray<T, Key, Hash>& DAssocArray<T, Key, Hash>::operator=
+(
+  const DAssocArray<T, Key, Hash>& source                        // the array to copy
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash>
+DAssocArray<T, Key, Hash>& DAssocArray<T, Key, Hash>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> void DAssocArray<T, Key, Hash>::reserve
+(
+  const unsigned int numElements             // the no. of elements that must fit
+)
+
+/*
+This method makes sure that "numElements" elements fit without the table growing.
+*/
+
+{
+  if (numElements <= this->_numElements + _growthLeft)
+    return;
+
+  unsigned int newCapacity(GROUP_SIZE);
+
+  while (maxLoad(newCapacity) < numElements)
+  {
+    if (newCapacity > ~0U / 2U)
+      throw Full(__FILE__, __LINE__);
+
+    newCapacity *= 2U;
+  }
+
+  rehash(newCapacity);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> void DAssocArray<T, Key, Hash>::shrinkToFit()
+
+/*
+This method rehashes the elements into the smallest table that holds them at no more than 7/8
+full (and clears out the tombstones).  An empty array releases its block altogether.
+*/
+
+{
+  unsigned int newCapacity(this->_numElements == 0U ? 0U : GROUP_SIZE);
+
+  while (maxLoad(newCapacity) < this->_numElements)
+    newCapacity *= 2U;
+
+  if (newCapacity < _capacity || _numDeleted > 0U)
+    rehash(newCapacity);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> T *const DAssocArray<T, Key, Hash>::find
+(
+  const Key& key                                      // the key to look for
+)
+noexcept
+
+/*
+This method returns a pointer to the element with the key "key", or NULL if there isn't one.
+*/
+
+{
+  const unsigned int index = findSlot(key, hashOf(key));
+
+  return index < _capacity ? &_slots[index].element : NULL;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> const T *const DAssocArray<T, Key, Hash>::find
+(
+  const Key& key                                      // the key to look for
+)
+const noexcept
+
+{
+  const unsigned int index = findSlot(key, hashOf(key));
+
+  return index < _capacity ? &_slots[index].element : NULL;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> const bool DAssocArray<T, Key, Hash>::insert
+(
+  const Key& key,                                     // the new element's key
+  const T&   element                                  // the new element
+)
+
+/*
+This method adds a copy of "element" with the key "key" and returns true, or returns false
+(and leaves the array alone) if there's already an element with that key.
+*/
+
+{
+  const uint64_t hash = hashOf(key);
+
+  if (findSlot(key, hash) < _capacity)
+    return false;
+
+  add(key, hash, element);
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> const bool DAssocArray<T, Key, Hash>::remove
+(
+  const Key& key                                      // the key of the element to remove
+)
+noexcept
+
+/*
+This method removes the element with the key "key" and returns true, or returns false if there
+isn't one.
+*/
+
+{
+  const unsigned int index = findSlot(key, hashOf(key));
+
+  if (index >= _capacity)
+    return false;
+
+  _slots[index].~Slot();
+  --this->_numElements;
+
+  if (Group(_controls + index / GROUP_SIZE * GROUP_SIZE).matchEmpty() != 0U)
+  {
+    setControl(index, EMPTY);
+    ++_growthLeft;
+  }
+  else
+  {
+    setControl(index, DELETED);
+    ++_numDeleted;
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> void DAssocArray<T, Key, Hash>::empty() noexcept
+
+/*
+This method removes every element.  The capacity doesn't change.
+*/
+
+{
+  for (unsigned int index = 0U; index < _capacity; ++index)
+  {
+    if (_controls[index] >= 0)
+      _slots[index].~Slot();
+  }
+
+  if (_capacity > 0U)
+    memset(_controls, EMPTY, _capacity);
+
+  this->_numElements = 0U;
+  _numDeleted        = 0U;
+  _growthLeft        = maxLoad(_capacity);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> void DAssocArray<T, Key, Hash>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method adds copies of the elements of "source" -- which must be a "DAssocArray" of the
+same type -- whose keys aren't already in this array.  "OperationFailed" is thrown for any
+other kind of data structure, since its elements have no keys.
+*/
+
+{
+  const DAssocArray<T, Key, Hash> *const keyed =
+    dynamic_cast<const DAssocArray<T, Key, Hash>*>(&source);
+
+  if (keyed == NULL)
+    throw OperationFailed("Only a DAssocArray can be added to a DAssocArray.", __FILE__,
+      __LINE__);
+
+  if (keyed == this)
+    return;
+
+  reserve(this->_numElements + keyed->_numElements);
+
+  for (ConstElementIterator i = keyed->begin(); i != keyed->end(); ++i)
+    insert(i.key(), *i);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> T& DAssocArray<T, Key, Hash>::operator[]
+(
+  const Key& key                                      // the key of the element to get
+)
+
+/*
+This method returns the element with the key "key".  If there isn't one then a
+default-constructed element is added with that key first.
+*/
+
+{
+  const uint64_t     hash  = hashOf(key);
+  const unsigned int index = findSlot(key, hash);
+
+  if (index < _capacity)
+    return _slots[index].element;
+
+  return add(key, hash);
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> const T& DAssocArray<T, Key, Hash>::operator[]
+(
+  const Key& key                                      // the key of the element to get
+)
+const
+
+/*
+This method returns the element with the key "key".  "OperationFailed" is thrown if there
+isn't one.
+*/
+
+{
+  const T *const element = find(key);
+
+  if (element == NULL)
+    throw OperationFailed("No element has that key.", __FILE__, __LINE__);
+
+  return *element;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T, class Key, class Hash>
+  void DAssocArray<T, Key, Hash>::assertInvariants() const noexcept
+
+  {
+    assert(_capacity == 0U ||
+      (_capacity >= GROUP_SIZE && (_capacity & (_capacity - 1U)) == 0U));
+    assert((_capacity == 0U) == (_controls == NULL));
+    assert(this->_numElements + _numDeleted + _growthLeft == maxLoad(_capacity));
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash>
+const uint64_t DAssocArray<T, Key, Hash>::hashOf
+(
+  const Key& key                                      // the key to hash
+)
+noexcept
+
+/*
+This function returns "key's" hash, passed through MurmurHash3's 64-bit finalizer so that
+every bit of it depends on every bit of "Hash's" result.
+*/
+
+{
+  uint64_t hash = (uint64_t)Hash()(key);
+
+  hash ^= hash >> 33U;
+  hash *= 0xFF51AFD7ED558CCDULL;
+  hash ^= hash >> 33U;
+  hash *= 0xC4CEB9FE1A85EC53ULL;
+  hash ^= hash >> 33U;
+
+  return hash;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash>
+inline const unsigned int DAssocArray<T, Key, Hash>::maxLoad
+(
+  const unsigned int capacity                         // a table's capacity
+)
+noexcept
+
+/*
+This function returns the no. of slots that a table with "capacity" slots may use (for
+elements and tombstones together):  7/8 of them.
+*/
+
+{
+  return capacity - capacity / 8U;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash>
+inline const unsigned int DAssocArray<T, Key, Hash>::lowestBit
+(
+  const unsigned int mask                             // a non-zero bit mask
+)
+noexcept
+
+/*
+This function returns the position of the lowest set bit in "mask".
+*/
+
+{
+  assert(mask != 0U);
+
+  #if defined(__GNUC__)
+    return (unsigned int)__builtin_ctz(mask);
+  #else
+    unsigned int position(0U);
+
+    while ((mask & (1U << position)) == 0U)
+      ++position;
+
+    return position;
+  #endif
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> const unsigned int DAssocArray<T, Key, Hash>::findSlot
+(
+  const Key&     key,                                 // the key to look for
+  const uint64_t hash                                 // "hashOf(key)"
+)
+const noexcept
+
+/*
+This method returns the index of the slot that holds the element with the key "key", or
+"_capacity" if there isn't one.
+*/
+
+{
+  if (_capacity == 0U)
+    return _capacity;
+
+  const unsigned int groupMask = _capacity / GROUP_SIZE - 1U;
+  const signed char  h2        = (signed char)(hash >> 57U);
+  unsigned int       group     = (unsigned int)hash & groupMask;
+
+  for (unsigned int step = 1U; ; ++step)
+  {
+    const Group  codes(_controls + group * GROUP_SIZE);
+    unsigned int matches = codes.match(h2);
+
+    while (matches != 0U)
+    {
+      const unsigned int index = group * GROUP_SIZE + lowestBit(matches);
+
+      if (_slots[index].key == key)
+        return index;
+
+      matches &= matches - 1U;
+    }
+
+    if (codes.matchEmpty() != 0U)
+      return _capacity;
+
+    assert(step <= groupMask + 1U);
+    group = (group + step) & groupMask;
+  }
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash>
+const unsigned int DAssocArray<T, Key, Hash>::findNotFull
+(
+  const uint64_t hash                                 // the hash of a key to add
+)
+const noexcept
+
+/*
+This method returns the index of the first "EMPTY" or "DELETED" slot in "hash's" probe
+sequence.  There must be one.
+*/
+
+{
+  assert(_capacity > 0U);
+
+  const unsigned int groupMask = _capacity / GROUP_SIZE - 1U;
+  unsigned int       group     = (unsigned int)hash & groupMask;
+
+  for (unsigned int step = 1U; ; ++step)
+  {
+    const unsigned int notFull = Group(_controls + group * GROUP_SIZE).matchNotFull();
+
+    if (notFull != 0U)
+      return group * GROUP_SIZE + lowestBit(notFull);
+
+    assert(step <= groupMask + 1U);
+    group = (group + step) & groupMask;
+  }
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> template<class... Args>
+T& DAssocArray<T, Key, Hash>::add
+(
+  const Key&     key,                                 // the new element's key
+  const uint64_t hash,                                // "hashOf(key)"
+  Args&&...      arguments                      // the arguments to construct the element with
+)
+
+/*
+This method adds an element constructed from "arguments" with the key "key" and returns it.
+The key mustn't be in the table.  If the new element would have to go into an "EMPTY" slot and
+there's no growth left then the table is rehashed first -- to the same size if at least half
+of the used slots are tombstones, or to twice the size otherwise.
+*/
+
+{
+  unsigned int index = _capacity > 0U ? findNotFull(hash) : 0U;
+
+  if (_capacity == 0U || (_controls[index] == EMPTY && _growthLeft == 0U))
+  {
+    unsigned int newCapacity(_capacity == 0U ? GROUP_SIZE : _capacity);
+
+    if (_capacity > 0U && this->_numElements >= maxLoad(_capacity) / 2U)
+    {
+      if (_capacity > ~0U / 2U)
+        throw Full(__FILE__, __LINE__);
+
+      newCapacity *= 2U;
+    }
+
+    rehash(newCapacity);
+    index = findNotFull(hash);
+  }
+
+  try
+  {
+    new(_slots + index) Slot(key, std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to add an element to a DAssocArray.", __FILE__, __LINE__);
+  }
+
+  if (_controls[index] == DELETED)
+    --_numDeleted;
+  else
+    --_growthLeft;
+
+  setControl(index, (signed char)(hash >> 57U));
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return _slots[index].element;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> void DAssocArray<T, Key, Hash>::rehash
+(
+  const unsigned int newCapacity              // the new no. of slots (0 or a power of two)
+)
+
+/*
+This method moves every element into a new block with "newCapacity" slots and no tombstones.
+The elements are moved if "Slot's" move constructor can't throw and copied otherwise; the old
+block isn't touched until they're all in the new one, so if a copy fails then the table is
+left as it was.
+*/
+
+{
+  assert(maxLoad(newCapacity) >= this->_numElements);
+
+  const size_t alignment   = alignof(Slot) > 16U ? alignof(Slot) : 16U;
+  const size_t slotsOffset = (newCapacity + alignof(Slot) - 1U) / alignof(Slot) *
+    alignof(Slot);
+  void*        block(NULL);
+
+  if (newCapacity > 0U)
+  {
+    if ((size_t)newCapacity > ((size_t)-1 - slotsOffset) / sizeof(Slot))
+      throw Full(__FILE__, __LINE__);
+
+    block = ::operator new(slotsOffset + sizeof(Slot) * newCapacity,
+      std::align_val_t(alignment), std::nothrow);
+
+    if (block == NULL)
+      throw Full(__FILE__, __LINE__);
+
+    memset(block, EMPTY, newCapacity);
+  }
+
+  signed char *const newControls = static_cast<signed char*>(block);
+  Slot *const        newSlots    = newCapacity > 0U ?
+    reinterpret_cast<Slot*>(static_cast<char*>(block) + slotsOffset) : NULL;
+
+  signed char *const oldControls = _controls;
+  Slot *const        oldSlots    = _slots;
+  const unsigned int oldCapacity = _capacity;
+  unsigned int       index(0U);
+
+  _controls = newControls;
+  _slots    = newSlots;
+  _capacity = newCapacity;
+
+  try
+  {
+    for (; index < oldCapacity; ++index)
+    {
+      if (oldControls[index] >= 0)
+      {
+        const unsigned int newIndex = findNotFull(hashOf(oldSlots[index].key));
+
+        new(newSlots + newIndex) Slot(std::move_if_noexcept(oldSlots[index]));
+        newControls[newIndex] = oldControls[index];
+      }
+    }
+  }
+  catch (...)
+  {
+    for (unsigned int newIndex = 0U; newIndex < newCapacity; ++newIndex)
+    {
+      if (newControls[newIndex] >= 0)
+        newSlots[newIndex].~Slot();
+    }
+
+    ::operator delete(block, std::align_val_t(alignment));
+
+    _controls = oldControls;
+    _slots    = oldSlots;
+    _capacity = oldCapacity;
+
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  for (index = 0U; index < oldCapacity; ++index)
+  {
+    if (oldControls[index] >= 0)
+      oldSlots[index].~Slot();
+  }
+
+  ::operator delete(oldControls, std::align_val_t(alignment));
+
+  _numDeleted = 0U;
+  _growthLeft = maxLoad(newCapacity) - this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash> inline void DAssocArray<T, Key, Hash>::setControl
+(
+  const unsigned int index,                           // the slot whose code is to be set
+  const signed char  code                             // the new control code
+)
+noexcept
+
+{
+  assert(index < _capacity);
+
+  _controls[index] = code;
+  return;
+}
+
+// ============================================================================================
+// DASSOCARRAY<T, KEY, HASH>::GROUP METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash>
+inline const unsigned int DAssocArray<T, Key, Hash>::Group::match
+(
+  const signed char code                              // the control code to look for
+)
+const noexcept
+
+{
+  #ifdef DSTRUCTS_DASSOCARRAY_SSE2
+    const __m128i codes = _mm_load_si128(reinterpret_cast<const __m128i*>(_codes));
+
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(codes, _mm_set1_epi8(code)));
+  #else
+    unsigned int mask(0U);
+
+    for (unsigned int i = 0U; i < GROUP_SIZE; ++i)
+      mask |= (unsigned int)(_codes[i] == code) << i;
+
+    return mask;
+  #endif
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Hash>
+inline const unsigned int DAssocArray<T, Key, Hash>::Group::matchNotFull() const noexcept
+
+/*
+"EMPTY" and "DELETED" are the only negative control codes, so this is a mask of the sign bits.
+*/
+
+{
+  #ifdef DSTRUCTS_DASSOCARRAY_SSE2
+    const __m128i codes = _mm_load_si128(reinterpret_cast<const __m128i*>(_codes));
+
+    return (unsigned int)_mm_movemask_epi8(codes);
+  #else
+    unsigned int mask(0U);
+
+    for (unsigned int i = 0U; i < GROUP_SIZE; ++i)
+      mask |= (unsigned int)(_codes[i] < 0) << i;
+
+    return mask;
+  #endif
+}
+
+#endif
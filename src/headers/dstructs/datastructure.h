@@ -14,24 +14,30 @@ There is one public non-virtual method:  "numElements()".  It returns the number
 (of type T) that the structure currently contains (not necessarily the maximum number of
 elements that the structure could contain).
 
-There are four protected abstract virtual methods:  "iterStart()", "iterMore()", "iterNext()"
-and "iterCurrent()".  Descendent classes must implement iteration algorithms such that all
-elements in the data structure can be accessed as in the following examples:
+There is one public abstract virtual method for iterating:  "iterator()".  It returns a new
+"Iterator_" object -- a cursor that the caller owns (and must delete, preferably by putting it
+in an "SDP") -- that's positioned at the first element.  All of the elements in the data
+structure can be accessed as in the following examples:
 
-  for (structure.iterStart(); structure.iterMore(); structure.iterNext())
+  const SDP<DataStructure<T>::Iterator_> i(structure.iterator());
+
+  for (; i->more(); i->next())
   {
-    structure.iterCurrent().doSomething();
+    i->current()->doSomething();
   }
 
-  structure.iterStart();
-  while (!found && structure.iterMore())
+  for (i->start(); !found && i->more(); i->next())
   {
-    if (structure.iterCurrent() == whatWeAreLookingFor)
+    if (*i->current() == whatWeAreLookingFor)
       found = true;
-    else
-      structure.findNext();
   }
 
+Because the iteration state lives in the "Iterator_" and not in the data structure, any number
+of iterations can be underway at once -- in nested loops or in several threads -- as long as
+nobody changes the data structure while they are.  "iterator()" is a "const" method and
+iterating never changes the data structure, so a structure that's shared between threads can
+be scanned by all of them without any locking.
+
 When declaring descendants of "DataStructure", it's recommended that "D" be prefixed to denote
 "dynamicly-allocated" implementations and "S" be prefixed to denote "staticly-allocated"
 implementations.  Consider the following class hierarchy, for example:
@@ -52,6 +58,28 @@ implementations.  Consider the following class hierarchy, for example:
               +--DBinaryTree  <--- binary tree implemented in free store
 
 Descendent classes are responsible for keeping the protected member "_numElements" accurate.
+
+An "Iterator_'s" methods are virtual, so a loop like the ones above makes three virtual calls
+per element that the compiler can't inline.  Concrete descendents therefore also provide
+standard iterators, named "ElementIterator" and "ConstElementIterator", through "begin()" and
+"end()".  They visit the elements in the same order as an "Iterator_" does but compile down to
+a pointer increment or a next-pointer chase, so they work at full speed with range-based "for"
+loops and "<algorithm>":
+
+  for (const Widget& widget : widgetStack)
+    widget.doSomething();
+
+The free "forAll()" function and the "==" and "!=" operators (at the end of this file) use them
+whenever the concrete type of a data structure is known, and fall back on "iterator()" when
+all that's known is that it's a "DataStructure<T>".  In fact, most descendents implement
+"iterator()" by wrapping their "ConstElementIterator" in an "IteratorAdaptor" (see below).
+
+There is also one public virtual method with a default implementation:
+"contiguousElements()".  Descendents whose elements all sit in one contiguous block of memory
+should override it to return that block -- refer to its comments for details.  Copy operations
+use it to copy a whole block at a time instead of going through an "Iterator_" one element at
+a time.  It's public because a structure calls it on its source, which is usually a structure
+of some other type.
 */
 
 // ============================================================================================
@@ -68,6 +96,12 @@ class to reduce code bloat.  It's recommended that descendants of "DataStructure
 // ============================================================================================
 
 #include <assert.h>
+#include <stddef.h>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 #ifdef FAT_FILENAMES
   #include <exceptn.h>
@@ -75,6 +109,8 @@ class to reduce code bloat.  It's recommended that descendants of "DataStructure
   #include <exception.h>
 #endif
 
+#include <sdp.h>
+
 // ============================================================================================
 // DATASTRUCTURE_ CLASS DECLARATION
 // ============================================================================================
@@ -110,53 +146,80 @@ class DataStructure_
           {return;}
     };
 
-                       DataStructure_() throw ():
+                       DataStructure_() noexcept:
                          _numElements(0U)
                          {return;}
     virtual            ~DataStructure_()
                          {return;}
 
-    const unsigned int numElements() const throw ()
+    const unsigned int numElements() const noexcept
                          {return _numElements;}
-    const bool         isEmpty() const throw ()
+    const bool         isEmpty() const noexcept
                          {return _numElements == 0U;}
 
   protected:
     unsigned int _numElements;              // no. of elements that the data structure contains
 
     #ifndef NDEBUG
-      virtual void assertInvariants() const throw () = 0;
+      virtual void assertInvariants() const noexcept = 0;
     #endif
 };
 
+/*
+Descendents name the exceptions through "DataStructureExceptions", which they list as a
+virtual base class so that "Full", "Empty" and "OperationFailed" can be used unqualified even
+when the rest of their bases depend on "T".
+*/
+
+typedef DataStructure_ DataStructureExceptions;
+
 // ============================================================================================
 // DATASTRUCTURE<T> CLASS DECLARATION
 // ============================================================================================
 
+template<class T> class DataStructure;
+
+template<class T> const bool operator==(const DataStructure<T>&, const DataStructure<T>&);
+
 template<class T> class DataStructure:
   virtual public DataStructure_
 {
   public:
-    virtual void      empty() = 0;
-    void              forAll(void (*)(T&));
+    class Iterator_
+    {
+      public:
+        virtual                ~Iterator_()
+                                 {return;}
+
+        virtual void           start()         noexcept = 0;
+        virtual const bool     more()    const noexcept = 0;
+        virtual void           next() = 0;
+        virtual const T *const current() const = 0;
+    };
+
+    virtual void             empty() = 0;
+    void                     forAll(void (*)(T&));
+
+    virtual Iterator_ *const iterator() const = 0;
+
+    DataStructure<T>&        operator=(const DataStructure<T>&);
+    DataStructure<T>&        operator+=(const DataStructure<T>&);
 
-    DataStructure<T>& operator=(const DataStructure<T>&);
-    DataStructure<T>& operator+=(const DataStructure<T>&);
+    virtual const T *const   contiguousElements(bool&) const noexcept
+                               {return NULL;}
 
   protected:
-    virtual void       iterStart() const throw () = 0;
-    virtual const bool iterMore() const throw () = 0;
-    virtual void       iterNext() const throw (OperationFailed) = 0;
-    virtual const T&   iterCurrent() const throw () = 0;
+    template<class Structure>
+    static Iterator_ *const  newIterator(const Structure&);
 
-    friend const bool operator==(const DataStructure<T>&, const DataStructure<T>&);
+    friend const bool operator== <>(const DataStructure<T>&, const DataStructure<T>&);
 };
 
 // ============================================================================================
 // DATASTRUCTURE<T> METHODS
 // ============================================================================================
 
-void template<class T> DataStructure<T>::forAll(void (*operation)(T&))
+template<class T> void DataStructure<T>::forAll(void (*operation)(T&))
 
 /*
 This method applies "operation" to every element in the data structure.  "operation" must
@@ -164,9 +227,11 @@ point to a function declared like "void doSomething(T&)".
 */
 
 {
-  for (iterStart(); iterMore(); iterNext())
+  const SDP<Iterator_> i(iterator());
+
+  for (; i->more(); i->next())
   {
-    operation((T&)iterCurrent());  // a rare time when const must be cast away from iterCurrent
+    operation((T&)*i->current());  // a rare time when const must be cast away from current()
   }
 
   return;
@@ -197,6 +262,108 @@ template<class T> DataStructure<T>& DataStructure<T>::operator+=
   return *this;
 }
 
+/*********************************************************************************************/
+
+/*
+"contiguousElements()" (declared inline above) describes how a descendent's elements are laid
+out in memory:
+
+  const T *const contiguousElements(bool& isReversed) const noexcept
+
+If every element sits in one contiguous block of "numElements()" cells then it returns the
+address of the lowest cell and sets "isReversed" to tell which way the iteration runs:  false
+if the first element in iterative order is in the lowest cell, true if it's in the highest one.
+Otherwise (or if the structure is empty) it returns NULL and "isReversed" is undefined.
+
+The pointer is only good until the structure is next changed.
+
+The default implementation returns NULL, so data structures that don't override it are copied
+through an "Iterator_" as usual.
+*/
+
+// ============================================================================================
+// ITERATORADAPTOR<T, STRUCTURE> CLASS DECLARATION
+// ============================================================================================
+
+/*
+An "IteratorAdaptor" is an "Iterator_" for a concrete data structure of type "Structure" that
+works by stepping one of the structure's "ConstElementIterator" objects.  It holds a reference
+to the structure and the element iterator -- nothing else -- so it's cheap to create and
+nothing in the structure changes while it's being used.
+*/
+
+template<class T, class Structure> class IteratorAdaptor:
+  public DataStructure<T>::Iterator_
+{
+  public:
+                           IteratorAdaptor(const Structure& structure) noexcept:
+                             _structure(structure), _current(structure.begin())
+                             {return;}
+
+    virtual void           start() noexcept
+                             {_current = _structure.begin(); return;}
+    virtual const bool     more() const noexcept
+                             {return _current != _structure.end();}
+    virtual void           next();
+    virtual const T *const current() const;
+
+  private:
+    const Structure&                        _structure;    // the structure being iterated
+    typename Structure::ConstElementIterator _current;     // the current element
+
+    IteratorAdaptor<T, Structure>& operator=(const IteratorAdaptor<T, Structure>&);
+};
+
+/*********************************************************************************************/
+
+template<class T, class Structure> void IteratorAdaptor<T, Structure>::next()
+{
+  if (!more())
+  {
+    throw DataStructure_::OperationFailed("Current iteration element is undefined.", __FILE__,
+      __LINE__);
+  }
+
+  ++_current;
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Structure> const T *const IteratorAdaptor<T, Structure>::current()
+  const
+{
+  if (!more())
+  {
+    throw DataStructure_::OperationFailed("Current iteration element is undefined.", __FILE__,
+      __LINE__);
+  }
+
+  return &*_current;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class Structure>
+  typename DataStructure<T>::Iterator_ *const DataStructure<T>::newIterator
+(
+  const Structure& structure                            // the concrete structure to iterate
+)
+
+/*
+This function returns a new "IteratorAdaptor" for "structure".  Descendents with element
+iterators can implement "iterator()" with nothing more than a call to it.
+*/
+
+{
+  Iterator_ *const newIterator = new(std::nothrow) IteratorAdaptor<T, Structure>(structure);
+
+  if (newIterator == NULL)
+    throw OperationFailed("Insufficient memory to create an iterator.", __FILE__, __LINE__);
+
+  return newIterator;
+}
+
 // ============================================================================================
 // MEANINGFUL OPERATORS
 // ============================================================================================
@@ -236,8 +403,8 @@ to be unequal.
 
   if (areEqual)
   {
-    lhs.iterStart();
-    rhs.iterStart();
+    const SDP<typename DataStructure<T>::Iterator_> lhsIterator(lhs.iterator());
+    const SDP<typename DataStructure<T>::Iterator_> rhsIterator(rhs.iterator());
 
     /*
     This is the main loop, and it iterates through both sides' elements.  During each
@@ -248,17 +415,17 @@ to be unequal.
     elements have been exhausted.
     */
 
-    while (areEqual && lhs.iterMore())
+    while (areEqual && lhsIterator->more())
     {
-      assert(rhs.iterMore())
+      assert(rhsIterator->more());
 
-      areEqual = lhs.iterCurrent() == rhs.iterCurrent();
+      areEqual = *lhsIterator->current() == *rhsIterator->current();
 
-      lhs.iterNext();
-      rhs.iterNext();
+      lhsIterator->next();
+      rhsIterator->next();
     }
 
-    assert(!areEqual || !rhs.iterMore());
+    assert(!areEqual || !rhsIterator->more());
   }
 
   return areEqual;
@@ -283,7 +450,82 @@ Refer to the comments for "operator==()" (above) for further information.
   Code re-use at its finest...
   */
 
-  return !operator==(rhs);
+  return !(lhs == rhs);
+}
+
+// ============================================================================================
+// ELEMENT ITERATOR FUNCTIONS & OPERATORS
+// ============================================================================================
+
+/*
+"HasElementIterators<S>::value" is true iff "S" is a data structure with "begin()" and "end()"
+-- that is, a concrete data structure.  The functions below are only considered for those, so
+that calls on abstract "DataStructure<T>" references still go to the virtual versions above.
+*/
+
+template<class Structure, class = void> struct HasElementIterators:
+  std::false_type
+{
+};
+
+template<class Structure> struct HasElementIterators<Structure,
+  decltype((void)std::declval<const Structure&>().begin())>:
+  std::integral_constant<bool, std::is_base_of<DataStructure_, Structure>::value>
+{
+};
+
+/*********************************************************************************************/
+
+template<class Structure, class Operation> inline
+  typename std::enable_if<HasElementIterators<Structure>::value>::type forAll
+(
+  Structure& structure,                                  // the data structure to operate on
+  Operation  operation                                   // what to do to each element
+)
+
+/*
+This function applies "operation" to every element in "structure".  "operation" can be
+anything that can be called with a "T&" -- a function pointer, a function object or a lambda --
+and, since nothing is called virtually, it can be inlined into the loop.
+*/
+
+{
+  for (auto& element : structure)
+    operation(element);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class LHS, class RHS> inline typename std::enable_if<HasElementIterators<LHS>::value
+  && HasElementIterators<RHS>::value, const bool>::type operator==
+(
+  const LHS& lhs,                                      // left-hand side of equality operation
+  const RHS& rhs                                       // right-hand side of equality operation
+)
+
+/*
+This function is the same as the "DataStructure<T>" equality operator (above) except that it
+walks both data structures with their element iterators.
+*/
+
+{
+  return lhs.numElements() == rhs.numElements() && std::equal(lhs.begin(), lhs.end(),
+    rhs.begin());
+}
+
+/*********************************************************************************************/
+
+template<class LHS, class RHS> inline typename std::enable_if<HasElementIterators<LHS>::value
+  && HasElementIterators<RHS>::value, const bool>::type operator!=
+(
+  const LHS& lhs,                                    // left-hand side of inequality operation
+  const RHS& rhs                                     // right-hand side of inequality operation
+)
+
+{
+  return !(lhs == rhs);
 }
 
 #endif
\ No newline at end of file
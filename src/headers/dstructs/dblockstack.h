@@ -0,0 +1,801 @@
+#ifndef DSTRUCTS_DBLOCKSTACK_H
+#define DSTRUCTS_DBLOCKSTACK_H
+
+// ============================================================================================
+//
+// dblockstack.h -- Implementation of a dynamic stack that stores its elements in a chain of
+// fixed-size blocks.
+//
+// ============================================================================================
+
+/*
+This class is a dynamic stack.  A "DBlockStack" is a "Stack".
+
+Like a "DStack", a "DBlockStack" can grow for as long as there's memory to grow into.  Unlike a
+"DStack", it doesn't allocate a node for every element -- it allocates blocks that each hold
+"elementsPerBlock()" elements side by side, the way an "SStack" does.  Pushing and popping are
+mostly a matter of incrementing and decrementing an index, and popping walks through memory in
+order.
+
+The structure of a "DBlockStack" object looks like this:
+
+          Block 2                 Block 1                 Block 0
+          ---------------------   ---------------------   ---------------------
+_top ---->| Block below       |-->| Block below       |-->| Block below       |-->NULL
+          | 0th | 1st |  ?  |     | 0th | 1st | 2nd |     | 0th | 1st | 2nd |
+          ---------------------   ---------------------   ---------------------
+                   ^
+_topCount - 1 -----+
+
+Every block except the topmost one is full.  The topmost element is element "_topCount - 1" of
+the topmost block.  If the structure is empty then "_top" is NULL.
+
+When popping empties the topmost block, the block isn't freed -- it's kept as a spare
+("_spare") and reused by the next push that needs a new block.  That way, a stack whose size
+hovers around a block boundary doesn't allocate and free a block on every push and pop.  At
+most one spare block is kept.
+
+Elements are constructed in a block's storage as they're pushed and destroyed as they're
+popped, so a block never holds more live "T" objects than there are elements in it.
+
+For iterations, the topmost element is the first element (as "Stack" requires).
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include <dstructs/stack.h>
+
+// ============================================================================================
+// DBLOCKSTACK<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class DBlockStack:
+  virtual public DataStructureExceptions,
+  virtual public Stack<T>
+{
+  public:
+    static const unsigned int DEFAULT_ELEMENTS_PER_BLOCK = 64U;
+
+                       DBlockStack(const unsigned int = DEFAULT_ELEMENTS_PER_BLOCK);
+                       DBlockStack(const DBlockStack<T>&);
+                       DBlockStack(const DataStructure<T>&,
+                         const unsigned int = DEFAULT_ELEMENTS_PER_BLOCK);
+    virtual            ~DBlockStack();
+
+    DBlockStack<T>&    operator=(const DataStructure<T>&);
+    DBlockStack<T>&    operator+=(const DataStructure<T>&);
+
+    const unsigned int elementsPerBlock() const noexcept
+                         {return _elementsPerBlock;}
+
+    // DataStructure<T> methods
+
+    virtual void       empty();
+
+    // LinearStructure<T> methods
+
+    virtual void       concatenate(const DataStructure<T>&);
+
+    // Stack<T> methods
+
+    virtual void       push(const T&);
+    virtual void       push(T&&);
+    virtual void       pop(T&);
+    virtual void       peek(T&) const;
+
+    template<class... Args>
+    void               emplace(Args&&...);
+
+  protected:
+
+    #ifndef NDEBUG
+      virtual void     assertInvariants() const noexcept;
+    #endif
+
+  private:
+    struct Block
+    {
+      Block* below;                        // the next block down the stack, or NULL if none
+    };
+
+    struct Position
+    {
+      const Block* block;                  // block that the position is in, or NULL if none
+      unsigned int count;                  // no. of elements in "block" at or below position
+    };
+
+    const unsigned int _elementsPerBlock;  // no. of elements that each block can hold
+    Block*             _top;               // topmost block, or NULL if the stack is empty
+    unsigned int       _topCount;          // no. of elements in the topmost block
+    Block*             _spare;             // a block kept for reuse, or NULL if none
+
+    Block*             newBlock(Block *const);
+    void               deleteBlock(Block *const) noexcept;
+    void               popBlock() noexcept;
+    void               copyTo(Position&, const T&);
+
+    static T *const    elements(const Block *const block) noexcept
+                         {
+                           return reinterpret_cast<T*>(const_cast<char*>(
+                             reinterpret_cast<const char*>(block) + HEADER_SIZE));
+                         }
+
+    static const size_t HEADER_SIZE = (sizeof(Block) + alignof(T) - 1U) / alignof(T) *
+                          alignof(T);
+
+  public:
+
+    /*
+    The element iterators are standard forward iterators that visit the elements from the top
+    down.  Within a block, incrementing one is an index decrement; only when it runs off the
+    bottom of a block does it follow the "below" pointer.
+    */
+
+    template<class Element> class BlockIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                       BlockIterator(const Block *const block = NULL,
+                         const unsigned int count = 0U,
+                         const unsigned int elementsPerBlock = 0U) noexcept:
+                         _block(block), _count(count), _elementsPerBlock(elementsPerBlock)
+                         {return;}
+                       BlockIterator(const BlockIterator<T>& source) noexcept:
+                         _block(source._block), _count(source._count),
+                         _elementsPerBlock(source._elementsPerBlock)
+                         {return;}
+
+        Element&       operator*() const noexcept
+                         {return elements(_block)[_count - 1U];}
+        Element*       operator->() const noexcept
+                         {return elements(_block) + _count - 1U;}
+        BlockIterator& operator++() noexcept
+                         {
+                           if (--_count == 0U)
+                           {
+                             _block = _block->below;
+                             _count = _elementsPerBlock;
+                           }
+
+                           return *this;
+                         }
+        BlockIterator  operator++(int) noexcept
+                         {const BlockIterator old(*this); operator++(); return old;}
+
+        const bool     operator==(const BlockIterator& rhs) const noexcept
+                         {
+                           return _block == rhs._block &&
+                             (_block == NULL || _count == rhs._count);
+                         }
+        const bool     operator!=(const BlockIterator& rhs) const noexcept
+                         {return !operator==(rhs);}
+
+      private:
+        const Block* _block;               // the current block, or NULL past the last element
+        unsigned int _count;               // no. of elements in "_block" at or below this one
+        unsigned int _elementsPerBlock;    // the stack's "elementsPerBlock()"
+
+        friend class BlockIterator<const T>;
+    };
+
+    typedef BlockIterator<T>       ElementIterator;
+    typedef BlockIterator<const T> ConstElementIterator;
+
+    ElementIterator      begin() noexcept
+                           {return ElementIterator(_top, _topCount, _elementsPerBlock);}
+    ElementIterator      end() noexcept
+                           {return ElementIterator();}
+    ConstElementIterator begin() const noexcept
+                           {return ConstElementIterator(_top, _topCount, _elementsPerBlock);}
+    ConstElementIterator end() const noexcept
+                           {return ConstElementIterator();}
+
+    // DataStructure<T> methods
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                           {return DataStructure<T>::newIterator(*this);}
+};
+
+// ============================================================================================
+// DBLOCKSTACK<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> DBlockStack<T>::DBlockStack
+(
+  const unsigned int elementsPerBlock          // the no. of elements that each block holds
+):
+
+/*
+This constructor instanciates an empty stack.  No blocks are allocated until the first element
+is pushed.
+
+PRECONDITIONS:
+"elementsPerBlock" must be greater than 0.
+
+POSTCONDITIONS:
+An empty stack is created.
+*/
+
+  _elementsPerBlock(elementsPerBlock),
+  _top(NULL),
+  _topCount(0U),
+  _spare(NULL)
+
+{
+  if (elementsPerBlock == 0U)
+    throw OperationFailed("\"elementsPerBlock\" can't be 0.", __FILE__, __LINE__);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DBlockStack<T>::DBlockStack
+(
+  const DBlockStack<T>& source                          // the stack to copy
+):
+
+/*
+This constructor makes a deep copy of "source", with the same number of elements per block.
+*/
+
+  _elementsPerBlock(source._elementsPerBlock),
+  _top(NULL),
+  _topCount(0U),
+  _spare(NULL)
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DBlockStack<T>::DBlockStack
+(
+  const DataStructure<T>& source,       // the data structure to copy the elements of
+  const unsigned int      elementsPerBlock     // the no. of elements that each block holds
+):
+
+/*
+This constructor instanciates a stack and copies the contents of "source" to it.  Refer to
+"concatenate()" for the order that the elements end up in.
+*/
+
+  _elementsPerBlock(elementsPerBlock),
+  _top(NULL),
+  _topCount(0U),
+  _spare(NULL)
+
+{
+  if (elementsPerBlock == 0U)
+    throw OperationFailed("\"elementsPerBlock\" can't be 0.", __FILE__, __LINE__);
+
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DBlockStack<T>::~DBlockStack()
+
+{
+  empty();
+
+  if (_spare != NULL)
+    deleteBlock(_spare);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DBlockStack<T>& DBlockStack<T>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> DBlockStack<T>& DBlockStack<T>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::empty()
+
+/*
+This method ensures that there are no elements in the stack.  One block is kept as a spare.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+The stack is empty.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  while (_top != NULL)
+  {
+    T *const topElements = elements(_top);
+
+    while (_topCount > 0U)
+      topElements[--_topCount].~T();
+
+    popBlock();
+    _topCount = (_top == NULL ? 0U : _elementsPerBlock);
+  }
+
+  _numElements = 0U;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method pushes copies of "source's" elements onto the stack.  As with "SStack", the first
+element in "source's" iteration order will be the first element to be popped off of the stack.
+Thus, copying a stack gives a stack with the same elements in the same order.
+
+If an exception is thrown then the stack is left as it was.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+"source's" elements are on top of the stack's original elements.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int numToCopy(source.numElements());
+
+  if (numToCopy == 0U)
+    return;
+
+  /*
+  Pushing each element in "source" in turn would put them in the wrong order, so enough blocks
+  to hold all of them are put on the stack first and the new elements are then filled in from
+  the top down.
+  */
+
+  Block *const       originalTop(_top);
+  const unsigned int originalTopCount(_topCount);
+  const unsigned int roomInTop(_top == NULL ? 0U : _elementsPerBlock - _topCount);
+
+  if (numToCopy <= roomInTop)
+    _topCount += numToCopy;
+  else
+  {
+    const unsigned int numInNewBlocks(numToCopy - roomInTop);
+
+    try
+    {
+      for (unsigned int numBlocks = (numInNewBlocks + _elementsPerBlock - 1U) /
+        _elementsPerBlock; numBlocks > 0U; --numBlocks)
+      {
+        _top = newBlock(_top);
+      }
+    }
+    catch (...)
+    {
+      while (_top != originalTop)
+        popBlock();
+
+      throw;
+    }
+
+    _topCount = numInNewBlocks - (numInNewBlocks - 1U) / _elementsPerBlock * _elementsPerBlock;
+  }
+
+  Position     destination = {_top, _topCount};
+  unsigned int numCopied(0U);
+
+  try
+  {
+    if (&source == this)
+    {
+      /*
+      The stack is being concatenated to itself, so its iterator would start at the cells that
+      were just added.  Its original elements are walked directly instead -- they're all below
+      the new cells, so filling those in doesn't disturb them.
+      */
+
+      ConstElementIterator original(originalTop, originalTopCount, _elementsPerBlock);
+
+      for (; numCopied < numToCopy; ++original, ++numCopied)
+        copyTo(destination, *original);
+    }
+    else
+    {
+      const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+      for (; i->more(); i->next(), ++numCopied)
+        copyTo(destination, *i->current());
+    }
+  }
+  catch (...)
+  {
+    /*
+    Destroy whatever was copied (from the top down, the same way it was copied) and take away
+    the blocks that were added.
+    */
+
+    destination.block = _top;
+    destination.count = _topCount;
+
+    for (; numCopied > 0U; --numCopied)
+    {
+      elements(destination.block)[destination.count - 1U].~T();
+
+      if (--destination.count == 0U)
+      {
+        destination.block = destination.block->below;
+        destination.count = _elementsPerBlock;
+      }
+    }
+
+    while (_top != originalTop)
+      popBlock();
+
+    _topCount = originalTopCount;
+
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  assert(numCopied == numToCopy);
+
+  _numElements += numToCopy;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::push
+(
+  const T& elementToPush                               // the element to be placed on the stack
+)
+
+/*
+This method pushes a copy of "elementToPush" onto the stack.  Refer to "emplace()" for details.
+*/
+
+{
+  emplace(elementToPush);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::push
+(
+  T&& elementToPush                                 // the element to be moved onto the stack
+)
+
+/*
+This method moves "elementToPush" onto the stack.  Refer to "emplace()" for details.
+*/
+
+{
+  emplace(std::move(elementToPush));
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void DBlockStack<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" directly in the topmost block.  A block
+is only allocated if the topmost block is full and there's no spare block.
+
+PRECONDITIONS:
+There must be enough memory for a new block if the topmost block is full.
+
+POSTCONDITIONS:
+The new element will be at the top of the stack and will be the first element to be popped off.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const bool needsBlock(_top == NULL || _topCount == _elementsPerBlock);
+
+  if (needsBlock)
+  {
+    _top      = newBlock(_top);
+    _topCount = 0U;
+  }
+
+  try
+  {
+    new(elements(_top) + _topCount) T(std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    if (needsBlock)
+    {
+      popBlock();
+      _topCount = (_top == NULL ? 0U : _elementsPerBlock);
+    }
+
+    throw OperationFailed("Unable to add an element to a DBlockStack.", __FILE__, __LINE__);
+  }
+
+  ++_topCount;
+  ++_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::pop
+(
+  T& poppedElement                                // the variable to receive the popped element
+)
+
+/*
+This method pops the topmost element off of the stack and moves it to "poppedElement" (refer to
+"LinearStructure<T>::moveElement()").  If that empties the topmost block then the block
+becomes the spare block.
+
+PRECONDITIONS:
+The stack cannot be empty.
+
+POSTCONDITIONS:
+The next element to be popped off of the stack is moved to "poppedElement" and removed from the
+stack.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (_top == NULL)
+    throw Empty(__FILE__, __LINE__);
+
+  T *const topElement = elements(_top) + _topCount - 1U;
+
+  try
+  {
+    this->moveElement(poppedElement, *topElement);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to remove an element from a DBlockStack.", __FILE__,
+      __LINE__);
+  }
+
+  topElement->~T();
+  --_numElements;
+
+  if (--_topCount == 0U)
+  {
+    popBlock();
+    _topCount = (_top == NULL ? 0U : _elementsPerBlock);
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::peek
+(
+  T& elementToBePopped                 // the variable to receive the next element to be popped
+)
+const
+
+/*
+This method retrieves the topmost element from the stack (without popping it off) and copies it
+to "elementToBePopped".
+
+PRECONDITIONS:
+The stack cannot be empty.
+
+POSTCONDITIONS:
+The next element to be popped off of the stack is copied to "elementToBePopped".
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (_top == NULL)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    elementToBePopped = elements(_top)[_topCount - 1U];
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to copy an element from a DBlockStack.", __FILE__, __LINE__);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void DBlockStack<T>::assertInvariants() const noexcept
+
+  {
+    assert(_elementsPerBlock > 0U);
+    assert((_top == NULL) == (_numElements == 0U));
+    assert(_top == NULL ? _topCount == 0U : _topCount > 0U && _topCount <= _elementsPerBlock);
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> typename DBlockStack<T>::Block* DBlockStack<T>::newBlock
+(
+  Block *const below                              // the block that the new block will sit on
+)
+
+/*
+This method returns an empty block that sits on top of "below".  The spare block is used if
+there is one; otherwise, a new block is allocated.  "Full" is thrown if there isn't enough
+memory for a new block.
+*/
+
+{
+  Block* block(_spare);
+
+  if (block != NULL)
+    _spare = NULL;
+  else
+  {
+    block = static_cast<Block*>(::operator new(HEADER_SIZE + sizeof(T) * _elementsPerBlock,
+      std::nothrow));
+
+    if (block == NULL)
+      throw Full(__FILE__, __LINE__);
+  }
+
+  block->below = below;
+  return block;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::deleteBlock
+(
+  Block *const block                             // a block that holds no constructed elements
+)
+noexcept
+{
+  ::operator delete(block);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::popBlock() noexcept
+
+/*
+This method takes the (already emptied) topmost block off of the stack and keeps it as the
+spare block.  If there already is a spare block then the one being taken off is freed instead.
+*/
+
+{
+  assert(_top != NULL);
+
+  Block *const block = _top;
+
+  _top = _top->below;
+
+  if (_spare == NULL)
+    _spare = block;
+  else
+    deleteBlock(block);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DBlockStack<T>::copyTo
+(
+  Position& destination,                 // the (unconstructed) cell to copy to; gets the next
+  const T&  element                      // the element to copy
+)
+
+/*
+This method copy-constructs "element" in the cell at "destination" and then moves "destination"
+down to the next cell, which is the topmost cell of the block below once it runs off the bottom
+of a block.  If the copy throws then "destination" is left as it was.
+*/
+
+{
+  new(elements(destination.block) + destination.count - 1U) T(element);
+
+  if (--destination.count == 0U)
+  {
+    destination.block = destination.block->below;
+    destination.count = _elementsPerBlock;
+  }
+
+  return;
+}
+
+#endif
@@ -0,0 +1,1061 @@
+#ifndef DSTRUCTS_DDOUBLYLINKEDLIST_H
+#define DSTRUCTS_DDOUBLYLINKEDLIST_H
+
+// ============================================================================================
+//
+// ddoublylinkedlist.h -- Dynamic Doubly-Linked List Template Class
+//
+// ============================================================================================
+
+/*
+This class is a doubly-linked list.  A "DDoublyLinkedList" is a "LinearStructure".
+
+Each element sits in its own node, and each node points to the nodes before and after it, so
+anything that's done at a known position takes constant time:  adding an element before it,
+removing the element at it and moving elements to or from it.  A position is an element
+iterator, which can be stepped forwards and backwards:
+
+  DDoublyLinkedList<Connection>                 connections;
+  DDoublyLinkedList<Connection>::ElementIterator newest;
+
+  connections.pushFront(connection);
+  newest = connections.begin();
+  ...
+  connections.remove(newest);
+
+Adding or moving elements never invalidates an iterator, and removing an element only
+invalidates iterators to that element -- so an iterator can be kept (in a hash table, say) as
+a handle to its element for as long as the element is in the list.  An LRU cache, for example,
+keeps a handle to each entry and moves an entry to the front every time it's used:
+
+  cache.moveToFront(handle);
+
+"splice()" moves a single element, a range of elements or a whole list from one list to
+another (or to another position in the same list) by relinking nodes:  no element is copied,
+moved or destroyed and every iterator to a spliced element stays valid (and now refers to an
+element of the destination list).
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+The list is circular around a "sentinel" link that's a member of the list object itself -- the
+sentinel's next link is the first node and its previous link is the last node.  Thus every node
+always has both neighbours and no operation needs to check for the ends of the list, and
+"end()" (an iterator at the sentinel) can be decremented to get at the last element.
+
+The structure of a "DDoublyLinkedList" with three elements looks like this:
+
+  +-----------------------------------------------------------------+
+  |                                                                 |
+  +-->Sentinel <--> Node 0 <--> Node 1 <--> Node 2 <--> (Sentinel)--+
+
+Nodes aren't allocated with "new" and "delete".  As with "DLinearStructure" and "AVLTree", they
+come from a "NodePool".  Since "splice()" moves nodes from one list to another, though, a node
+may be deleted by a list other than the one that allocated it, and its slot has to go back to
+the pool that it came from.  A list's pool is therefore held by reference count, and lists
+that splice to and from each other must share one (refer to "sharePool()").  "splice()" throws
+"OperationFailed" if they don't.
+
+Splicing a range of elements between two lists has to update both lists' element counts.
+"splice()" counts the elements in the range unless the caller passes the count in, in which
+case it takes constant time no matter how long the range is.  Splicing within one list,
+splicing a single element and splicing a whole list always take constant time.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include <sdp.h>
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/linearst.h>
+#else
+  #include <dstructs/linearstructure.h>
+#endif
+
+#include <dstructs/nodepool.h>
+
+// ============================================================================================
+// DDOUBLYLINKEDLIST<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class DDoublyLinkedList:
+  virtual public DataStructureExceptions,
+  virtual public LinearStructure<T>
+{
+  protected:
+    struct Link
+    {
+      Link* previous;
+      Link* next;
+    };
+
+    class Node:
+      public Link
+    {
+      public:
+        T element;
+
+        template<class... Args>
+        Node(Args&&... arguments):
+          element(std::forward<Args>(arguments)...) {return;}
+    };
+
+  public:
+
+    // Element iterators
+
+    /*
+    "ElementIterator" and "ConstElementIterator" are standard bidirectional iterators.  An
+    "ElementIterator" converts to a "ConstElementIterator", so either can be passed as a
+    position.
+    */
+
+    template<class Element> class LinkIterator
+    {
+      public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T                               value_type;
+        typedef ptrdiff_t                       difference_type;
+        typedef Element*                        pointer;
+        typedef Element&                        reference;
+
+                      LinkIterator(Link *const link = NULL) noexcept:
+                        _link(link) {return;}
+                      LinkIterator(const LinkIterator<T>& source) noexcept:
+                        _link(source._link) {return;}
+
+        LinkIterator& operator=(const LinkIterator&) noexcept = default;
+
+        Element&      operator*() const noexcept
+                        {return static_cast<Node*>(_link)->element;}
+        Element*      operator->() const noexcept
+                        {return &static_cast<Node*>(_link)->element;}
+        LinkIterator& operator++() noexcept
+                        {_link = _link->next; return *this;}
+        LinkIterator  operator++(int) noexcept
+                        {const LinkIterator old(*this); _link = _link->next; return old;}
+        LinkIterator& operator--() noexcept
+                        {_link = _link->previous; return *this;}
+        LinkIterator  operator--(int) noexcept
+                        {const LinkIterator old(*this); _link = _link->previous; return old;}
+
+        const bool    operator==(const LinkIterator& rhs) const noexcept
+                        {return _link == rhs._link;}
+        const bool    operator!=(const LinkIterator& rhs) const noexcept
+                        {return _link != rhs._link;}
+
+      private:
+        Link* _link;                              // the current node, or the list's sentinel
+
+        friend class LinkIterator<const T>;
+        friend class DDoublyLinkedList<T>;
+    };
+
+    typedef LinkIterator<T>       ElementIterator;
+    typedef LinkIterator<const T> ConstElementIterator;
+
+                           DDoublyLinkedList();
+                           DDoublyLinkedList(const DDoublyLinkedList<T>&);
+                           DDoublyLinkedList(const DataStructure<T>&);
+    virtual                ~DDoublyLinkedList()
+                             {empty(); releasePool(); return;}
+
+    DDoublyLinkedList<T>&  operator=(const DDoublyLinkedList<T>&);
+    DDoublyLinkedList<T>&  operator=(const DataStructure<T>&);
+    DDoublyLinkedList<T>&  operator+=(const DataStructure<T>&);
+
+    ElementIterator        begin() noexcept
+                             {return ElementIterator(_sentinel.next);}
+    ElementIterator        end() noexcept
+                             {return ElementIterator(&_sentinel);}
+    ConstElementIterator   begin() const noexcept
+                             {return ConstElementIterator(_sentinel.next);}
+    ConstElementIterator   end() const noexcept
+                             {return ConstElementIterator(const_cast<Link*>(&_sentinel));}
+
+    // Adding & removing elements
+
+    void                   pushFront(const T& element)
+                             {emplace(begin(), element); return;}
+    void                   pushFront(T&& element)
+                             {emplace(begin(), std::move(element)); return;}
+    void                   pushBack(const T& element)
+                             {emplace(end(), element); return;}
+    void                   pushBack(T&& element)
+                             {emplace(end(), std::move(element)); return;}
+    void                   popFront(T&);
+    void                   popBack(T&);
+
+    ElementIterator        insert(const ConstElementIterator position, const T& element)
+                             {return emplace(position, element);}
+    ElementIterator        insert(const ConstElementIterator position, T&& element)
+                             {return emplace(position, std::move(element));}
+
+    template<class... Args>
+    ElementIterator        emplace(const ConstElementIterator, Args&&...);
+
+    ElementIterator        remove(const ConstElementIterator) noexcept;
+
+    // Moving elements
+
+    void                   splice(const ConstElementIterator, DDoublyLinkedList<T>&);
+    void                   splice(const ConstElementIterator, DDoublyLinkedList<T>&,
+                             const ConstElementIterator);
+    void                   splice(const ConstElementIterator, DDoublyLinkedList<T>&,
+                             const ConstElementIterator, const ConstElementIterator);
+    void                   splice(const ConstElementIterator, DDoublyLinkedList<T>&,
+                             const ConstElementIterator, const ConstElementIterator,
+                             const unsigned int);
+
+    void                   moveToFront(const ConstElementIterator) noexcept;
+    void                   moveToBack(const ConstElementIterator) noexcept;
+
+    // Node pool
+
+    const unsigned int     nodesPerChunk() const noexcept
+                             {return _pool->pool.slotsPerChunk();}
+    void                   setNodesPerChunk(const unsigned int);
+    void                   sharePool(DDoublyLinkedList<T>&);
+    const bool             sharesPoolWith(const DDoublyLinkedList<T>& other) const noexcept
+                             {return _pool == other._pool;}
+
+    // DataStructure<T> methods
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    // LinearStructure<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+
+    /*
+    A "SharedPool" is a "NodePool" and the no. of lists that allocate their nodes from it.
+    It's deleted by the last list to let go of it.
+    */
+
+    struct SharedPool
+    {
+      NodePool     pool;
+      unsigned int numLists;
+
+                   SharedPool(const NodePool& source) noexcept:
+                     pool(source), numLists(1U) {return;}
+    };
+
+    Link                   _sentinel;                // the links to the first & last nodes
+    SharedPool*            _pool;                    // the pool that the nodes come from
+
+    void                   releasePool() noexcept;
+    void                   removeRange(Link *const, Link *const, const unsigned int) noexcept;
+    void                   deleteNode(Node *const) noexcept;
+
+    static SharedPool *const newPool(const NodePool&);
+    static void            transfer(Link *const, Link *const, Link *const) noexcept;
+};
+
+// ============================================================================================
+// DDOUBLYLINKEDLIST<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> DDoublyLinkedList<T>::DDoublyLinkedList():
+
+/*
+This constructor instanciates an empty list with a pool of its own.  "Full" is thrown if there
+isn't enough memory for the pool's bookkeeping.
+*/
+
+  _pool(newPool(NodePool(sizeof(Node), alignof(Node))))
+
+{
+  _sentinel.previous = &_sentinel;
+  _sentinel.next     = &_sentinel;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DDoublyLinkedList<T>::DDoublyLinkedList
+(
+  const DDoublyLinkedList<T>& source                   // the list to copy
+):
+
+/*
+This constructor makes a deep copy of "source".  The copy gets its own (empty) pool with the
+same no. of nodes per chunk as "source's" pool -- it doesn't share "source's" pool.
+*/
+
+  _pool(newPool(source._pool->pool))
+
+{
+  _sentinel.previous = &_sentinel;
+  _sentinel.next     = &_sentinel;
+
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    releasePool();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DDoublyLinkedList<T>::DDoublyLinkedList
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+):
+
+/*
+This constructor instanciates a list that holds copies of "source's" elements, in iterative
+order.
+*/
+
+  _pool(newPool(NodePool(sizeof(Node), alignof(Node))))
+
+{
+  _sentinel.previous = &_sentinel;
+  _sentinel.next     = &_sentinel;
+
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    releasePool();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DDoublyLinkedList<T>& DDoublyLinkedList<T>::operator=
+(
+  const DDoublyLinkedList<T>& source                   // the list to copy
+)
+
+/*
+This operator replaces this list's elements with copies of "source's".  The list keeps its own
+pool.
+*/
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> DDoublyLinkedList<T>& DDoublyLinkedList<T>::operator=
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> DDoublyLinkedList<T>& DDoublyLinkedList<T>::operator+=
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::popFront
+(
+  T& poppedElement                      // the variable to receive the first element
+)
+
+/*
+This method moves the first element to "poppedElement" (refer to
+"LinearStructure<T>::moveElement()") and removes it from the list.
+
+PRECONDITIONS:
+The list cannot be empty.
+
+POSTCONDITIONS:
+The first element is moved to "poppedElement" and removed from the list.  If "OperationFailed"
+is thrown then the list is unchanged.
+*/
+
+{
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    this->moveElement(poppedElement, static_cast<Node*>(_sentinel.next)->element);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to remove an element from a DDoublyLinkedList.", __FILE__,
+      __LINE__);
+  }
+
+  remove(begin());
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::popBack
+(
+  T& poppedElement                      // the variable to receive the last element
+)
+
+/*
+This method is the same as "popFront()" except that it removes the last element.
+*/
+
+{
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    this->moveElement(poppedElement, static_cast<Node*>(_sentinel.previous)->element);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to remove an element from a DDoublyLinkedList.", __FILE__,
+      __LINE__);
+  }
+
+  remove(--end());
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args>
+typename DDoublyLinkedList<T>::ElementIterator DDoublyLinkedList<T>::emplace
+(
+  const ConstElementIterator position,         // the element to add the new one before
+  Args&&...                  arguments         // the arguments to construct the element from
+)
+
+/*
+This method constructs a new element in place from "arguments" -- passing an element copies it,
+passing an rvalue moves it and passing anything else calls the matching "T" constructor -- and
+links it in before "position" ("end()" appends it).  It returns an iterator at the new element.
+
+"Full" is thrown if no memory could be allocated for the node.  "OperationFailed" is thrown if
+the element couldn't be constructed.  The list is unchanged in either case.
+*/
+
+{
+  void *const slot = _pool->pool.allocate();
+
+  if (slot == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  Node* node;
+
+  try
+  {
+    node = new(slot) Node(std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    _pool->pool.release(slot);
+    throw OperationFailed("Unable to copy an element into a new node.", __FILE__, __LINE__);
+  }
+
+  Link *const next = position._link;
+
+  node->previous       = next->previous;
+  node->next           = next;
+  next->previous->next = node;
+  next->previous       = node;
+
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return ElementIterator(node);
+}
+
+/*********************************************************************************************/
+
+template<class T> typename DDoublyLinkedList<T>::ElementIterator DDoublyLinkedList<T>::remove
+(
+  const ConstElementIterator position                  // the element to remove
+)
+noexcept
+
+/*
+This method removes the element at "position" and returns an iterator at the element that
+followed it.
+
+PRECONDITIONS:
+"position" must be at an element of this list (not at "end()").
+*/
+
+{
+  assert(position._link != &_sentinel);
+
+  Link *const link = position._link;
+  Link *const next = link->next;
+
+  link->previous->next = next;
+  next->previous       = link->previous;
+
+  deleteNode(static_cast<Node*>(link));
+  --this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return ElementIterator(next);
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::splice
+(
+  const ConstElementIterator position,       // the element to move the others before
+  DDoublyLinkedList<T>&      source          // the list to move every element from
+)
+
+/*
+This method moves all of "source's" elements to before "position", in order, and leaves
+"source" empty.  It takes constant time.
+
+"OperationFailed" is thrown if "source" is this list or doesn't share this list's pool (refer
+to "sharePool()").
+*/
+
+{
+  if (&source == this || source._pool != _pool)
+  {
+    throw OperationFailed("A list can only be spliced into another list with the same pool.",
+      __FILE__, __LINE__);
+  }
+
+  if (source._numElements > 0U)
+  {
+    transfer(position._link, source._sentinel.next, &source._sentinel);
+
+    this->_numElements  += source._numElements;
+    source._numElements  = 0U;
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+    source.assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::splice
+(
+  const ConstElementIterator position,       // the element to move the other before
+  DDoublyLinkedList<T>&      source,         // the list that "element" is in
+  const ConstElementIterator element         // the element to move
+)
+
+/*
+This method moves "element" from "source" to before "position".  "source" can be this list.  It
+takes constant time.
+
+"OperationFailed" is thrown if "source" doesn't share this list's pool (refer to
+"sharePool()").
+*/
+
+{
+  assert(element._link != &source._sentinel);
+
+  if (source._pool != _pool)
+  {
+    throw OperationFailed("Elements can only be spliced between lists with the same pool.",
+      __FILE__, __LINE__);
+  }
+
+  transfer(position._link, element._link, element._link->next);
+
+  --source._numElements;
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+    source.assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::splice
+(
+  const ConstElementIterator position,       // the element to move the others before
+  DDoublyLinkedList<T>&      source,         // the list that the range is in
+  const ConstElementIterator first,          // the first element to move
+  const ConstElementIterator last            // the element after the last one to move
+)
+
+/*
+This method moves the elements from "first" up to (but not including) "last" from "source" to
+before "position", in order.  "source" can be this list, but then "position" mustn't be in the
+range.
+
+Moving a range within a list takes constant time.  Moving a range between lists takes time in
+proportion to the length of the range because the elements have to be counted -- use the
+overload that takes the count if it's already known.
+
+"OperationFailed" is thrown if "source" doesn't share this list's pool (refer to
+"sharePool()").
+*/
+
+{
+  unsigned int count(0U);
+
+  if (&source != this)
+  {
+    for (const Link* link = first._link; link != last._link; link = link->next)
+      ++count;
+  }
+
+  splice(position, source, first, last, count);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::splice
+(
+  const ConstElementIterator position,       // the element to move the others before
+  DDoublyLinkedList<T>&      source,         // the list that the range is in
+  const ConstElementIterator first,          // the first element to move
+  const ConstElementIterator last,           // the element after the last one to move
+  const unsigned int         count           // the no. of elements in the range
+)
+
+/*
+This method is the same as the one above except that the caller passes the no. of elements in
+the range (which is ignored if "source" is this list), so it always takes constant time.
+
+PRECONDITIONS:
+"count" must be the no. of elements from "first" up to (but not including) "last".
+*/
+
+{
+  if (source._pool != _pool)
+  {
+    throw OperationFailed("Elements can only be spliced between lists with the same pool.",
+      __FILE__, __LINE__);
+  }
+
+  #ifndef NDEBUG
+    if (&source != this)
+    {
+      unsigned int numInRange(0U);
+
+      for (const Link* link = first._link; link != last._link; link = link->next)
+        ++numInRange;
+
+      assert(numInRange == count);
+    }
+  #endif
+
+  if (first != last)
+  {
+    transfer(position._link, first._link, last._link);
+
+    if (&source != this)
+    {
+      source._numElements -= count;
+      this->_numElements  += count;
+    }
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+    source.assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::moveToFront
+(
+  const ConstElementIterator element                   // the element to move
+)
+noexcept
+
+/*
+This method moves "element" to the front of the list in constant time.  It's the same as
+"splice(begin(), *this, element)" but can't throw.
+*/
+
+{
+  assert(element._link != &_sentinel);
+
+  transfer(_sentinel.next, element._link, element._link->next);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::moveToBack
+(
+  const ConstElementIterator element                   // the element to move
+)
+noexcept
+
+/*
+This method moves "element" to the back of the list in constant time.
+*/
+
+{
+  assert(element._link != &_sentinel);
+
+  transfer(&_sentinel, element._link, element._link->next);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::setNodesPerChunk
+(
+  const unsigned int nodesPerChunk      // no. of nodes to allocate from the heap at a time
+)
+
+/*
+This method changes how many nodes this list's pool allocates from the heap at a time.  0 turns
+pooling off, so that every node is allocated from and returned to the heap individually.
+
+Any memory that the pool is holding onto is returned to the heap.
+
+PRECONDITIONS:
+The list must be empty and its pool mustn't be shared.
+
+POSTCONDITIONS:
+Nodes will be allocated "nodesPerChunk" at a time.
+*/
+
+{
+  if (this->_numElements > 0U || _pool->numLists > 1U)
+  {
+    throw OperationFailed("The node pool of a non-empty or sharing DDoublyLinkedList can't be "
+      "changed.", __FILE__, __LINE__);
+  }
+
+  _pool->pool.reset(nodesPerChunk);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::sharePool
+(
+  DDoublyLinkedList<T>& other                          // the list whose pool to share
+)
+
+/*
+This method makes this list allocate its nodes from "other's" pool, so that elements can be
+spliced between the two (and any other lists that share the pool).  This list's own pool is
+released.
+
+PRECONDITIONS:
+This list must be empty.
+
+POSTCONDITIONS:
+This list and "other" share a pool.
+*/
+
+{
+  if (other._pool == _pool)
+    return;
+
+  if (this->_numElements > 0U)
+  {
+    throw OperationFailed("The node pool of a non-empty DDoublyLinkedList can't be changed.",
+      __FILE__, __LINE__);
+  }
+
+  releasePool();
+
+  _pool = other._pool;
+  ++_pool->numLists;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::empty() noexcept
+
+/*
+This method removes every element.
+*/
+
+{
+  removeRange(_sentinel.next, &_sentinel, this->_numElements);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method appends copies of "source's" elements, in iterative order.  "source" can be this
+list, in which case its elements are appended once.
+
+If an exception is thrown then the list is unchanged.
+*/
+
+{
+  Link *const        oldLast = _sentinel.previous;
+  const unsigned int oldCount(this->_numElements);
+
+  try
+  {
+    bool           isReversed;
+    const T *const block = source.contiguousElements(isReversed);
+
+    if (block != NULL)
+    {
+      const unsigned int count(source.numElements());
+
+      for (unsigned int i = 0U; i < count; ++i)
+        emplace(end(), block[isReversed ? count - 1U - i : i]);
+    }
+    else if (&source == this)
+    {
+      ConstElementIterator element(begin());
+
+      for (unsigned int i = 0U; i < oldCount; ++i, ++element)
+        emplace(end(), *element);
+    }
+    else
+    {
+      const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+      for (; i->more(); i->next())
+        emplace(end(), *i->current());
+    }
+  }
+  catch (...)
+  {
+    removeRange(oldLast->next, &_sentinel, this->_numElements - oldCount);
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void DDoublyLinkedList<T>::assertInvariants() const noexcept
+
+  {
+    assert(_sentinel.next->previous == &_sentinel);
+    assert(_sentinel.previous->next == &_sentinel);
+    assert((this->_numElements == 0U) == (_sentinel.next == &_sentinel));
+    assert((this->_numElements == 1U) == (_sentinel.next != &_sentinel &&
+      _sentinel.next == _sentinel.previous));
+    assert(_pool != NULL && _pool->numLists > 0U);
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::releasePool() noexcept
+
+/*
+This method lets go of this list's pool, deleting it if no other list shares it.
+*/
+
+{
+  if (--_pool->numLists == 0U)
+    delete _pool;
+
+  _pool = NULL;
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::removeRange
+(
+  Link *const        first,                   // the first node to remove
+  Link *const        last,                    // the link after the last node to remove
+  const unsigned int count                    // the no. of nodes from "first" up to "last"
+)
+noexcept
+
+/*
+This method unlinks and deletes the nodes from "first" up to (but not including) "last".
+*/
+
+{
+  Link *const previous = first->previous;
+
+  previous->next = last;
+  last->previous = previous;
+
+  for (Link* link = first; link != last; )
+  {
+    Link *const next = link->next;
+
+    deleteNode(static_cast<Node*>(link));
+    link = next;
+  }
+
+  this->_numElements -= count;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::deleteNode
+(
+  Node *const node                              // a node that came from this list's pool
+)
+noexcept
+
+{
+  assert(node != NULL);
+
+  node->~Node();
+  _pool->pool.release(node);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T>
+typename DDoublyLinkedList<T>::SharedPool *const DDoublyLinkedList<T>::newPool
+(
+  const NodePool& settings                  // a pool with the slot size & chunk size to use
+)
+
+/*
+This function creates a new (empty) shared pool with the same settings as "settings", used by
+one list.  "Full" is thrown if there isn't enough memory for it.
+*/
+
+{
+  SharedPool *const pool = new(std::nothrow) SharedPool(settings);
+
+  if (pool == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  return pool;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DDoublyLinkedList<T>::transfer
+(
+  Link *const position,                     // the link to move the nodes before
+  Link *const first,                        // the first node to move
+  Link *const last                          // the link after the last node to move
+)
+noexcept
+
+/*
+This function unlinks the nodes from "first" up to (but not including) "last" and links them
+in before "position" -- in the same list or in another one.  Nothing is done if the range is
+empty or if "position" is "first" or "last" (the nodes are already there).
+
+PRECONDITIONS:
+"position" mustn't be in the range, except at "first".
+*/
+
+{
+  if (first == last || position == first || position == last)
+    return;
+
+  Link *const lastToMove = last->previous;
+
+  // Close the gap that the nodes leave behind.
+
+  first->previous->next = last;
+  last->previous        = first->previous;
+
+  // Link the nodes in before "position".
+
+  first->previous          = position->previous;
+  lastToMove->next         = position;
+  position->previous->next = first;
+  position->previous       = lastToMove;
+
+  return;
+}
+
+#endif
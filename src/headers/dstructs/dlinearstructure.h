@@ -3,14 +3,43 @@
 
 // ============================================================================================
 //
-// dlinearstruct.h -- Dynamic Linear Data Structure Base Class
+// dlinearstructure.h -- Dynamic Linear Data Structure Base Class
 //
 // ============================================================================================
 
 /*
-This class is an abstract data type base class for all linear data structures.
+This class is an abstract data type base class for all dynamicly-allocated linear data
+structures.
+
+A "DLinearStructure" keeps its elements in a singly-linked chain of nodes ("_first" through
+"_last").  The nodes come from a "NodePool" that the structure owns:  descendents get a node
+with "newNode()" and give it back with "deleteNode()", and "setNodesPerChunk()" sets how many
+nodes the pool takes from the heap at a time.  "concatenate()" appends copies of another
+structure's elements, which is how the copy constructor, "operator=()" and "operator+=()" are
+implemented.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
 
-It's completely abstract -- there are no methods and no members.
+/*
+Nodes aren't allocated with "new" and "delete".  Each "DLinearStructure" owns a "NodePool" and
+constructs its nodes in the pool's slots with "newNode()" and destroys them with
+"deleteNode()". Nodes that are deleted go onto the pool's free list and are reused by later
+calls to "newNode()", so a structure that repeatedly grows and shrinks (like a stack in a tight
+push/pop loop) stops calling the heap once it has reached its working size.
+
+The number of nodes allocated from the heap at a time can be changed with "setNodesPerChunk()".
+Setting it to 0 turns pooling off so that every node comes from (and goes back to) the heap.
+
+"concatenate()" asks its source for a contiguous block of elements (refer to
+"DataStructure<T>::contiguousElements()") and, if it gets one, copies from it directly instead
+of making three virtual "Iterator_" calls per element.  Nodes can't be copied as a block, but
+that still leaves a tight loop of node constructions.
+
+A "DLinearStructure" keeps no iteration state of its own.  "iterator()" wraps a
+"ConstElementIterator" in an "IteratorAdaptor", so every reader gets its own cursor.
 */
 
 // ============================================================================================
@@ -18,6 +47,10 @@ It's completely abstract -- there are no methods and no members.
 // ============================================================================================
 
 #include <stdarg.h>
+#include <stddef.h>
+
+#include <iterator>
+#include <utility>
 
 #ifdef FAT_FILENAMES
   #include <dstructs/linearst.h>
@@ -25,18 +58,23 @@ It's completely abstract -- there are no methods and no members.
   #include <dstructs/linearstructure.h>
 #endif
 
+#include <dstructs/nodepool.h>
+
 // ============================================================================================
 // DLINEARSTRUCTURE<T> CLASS DECLARATION
 // ============================================================================================
 
 template<class T> class DLinearStructure:
+  virtual public DataStructureExceptions,
   virtual public LinearStructure<T>
 {
   public:
                          DLinearStructure();
+                         DLinearStructure(const DLinearStructure<T>&);
                          DLinearStructure(const DataStructure<T>&);
     virtual              ~DLinearStructure();
 
+    DLinearStructure<T>& operator=(const DLinearStructure<T>&);
     DLinearStructure<T>& operator=(const DataStructure<T>&);
     DLinearStructure<T>& operator+=(const DataStructure<T>&);
 
@@ -44,17 +82,22 @@ template<class T> class DLinearStructure:
 
     virtual void         empty();
 
+    const unsigned int   nodesPerChunk() const noexcept
+                           {return _pool.slotsPerChunk();}
+    void                 setNodesPerChunk(const unsigned int);
+
   protected:
     class Node
     {
       public:
-                     Node(const T&, Node *const);
+                     template<class... Args>
+                     Node(Node *const, Args&&...);
 
-        T *const     element() throw ()
+        T *const     element() noexcept
                        {return &_element;}
-        Node *const  next() const throw ()
+        Node *const  next() const noexcept
                        {return _next;}
-        virtual void setNext(Node *const next) throw ()
+        virtual void setNext(Node *const next) noexcept
                        {_next = next; return;}
 
       private:
@@ -62,20 +105,76 @@ template<class T> class DLinearStructure:
         Node* _next;
     };
 
-    Node* _first;
-    Node* _last;
+  public:
 
-    void               initWithVarArgs(const unsigned int, va_list&);
+    /*
+    "ElementIterator" and "ConstElementIterator" are standard forward iterators.
+    Incrementing one is a single next-pointer chase, so range-based "for" loops and
+    "<algorithm>" run as fast over a "DLinearStructure" as over a hand-written loop.
+    */
+
+    template<class Element> class NodeIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                      NodeIterator(Node *const node = NULL) noexcept:
+                        _node(node) {return;}
+                      NodeIterator(const NodeIterator<T>& source) noexcept:
+                        _node(source._node) {return;}
+
+        Element&      operator*() const noexcept
+                        {return *_node->element();}
+        Element*      operator->() const noexcept
+                        {return _node->element();}
+        NodeIterator& operator++() noexcept
+                        {_node = _node->next(); return *this;}
+        NodeIterator  operator++(int) noexcept
+                        {const NodeIterator old(*this); _node = _node->next(); return old;}
+
+        const bool    operator==(const NodeIterator& rhs) const noexcept
+                        {return _node == rhs._node;}
+        const bool    operator!=(const NodeIterator& rhs) const noexcept
+                        {return _node != rhs._node;}
+
+      private:
+        Node* _node;                        // the current node, or NULL past the last element
+
+        friend class NodeIterator<const T>;
+    };
+
+    typedef NodeIterator<T>       ElementIterator;
+    typedef NodeIterator<const T> ConstElementIterator;
+
+    ElementIterator      begin() noexcept
+                           {return ElementIterator(_first);}
+    ElementIterator      end() noexcept
+                           {return ElementIterator();}
+    ConstElementIterator begin() const noexcept
+                           {return ConstElementIterator(_first);}
+    ConstElementIterator end() const noexcept
+                           {return ConstElementIterator();}
 
     // DataStructure<T> methods
 
-    virtual void       iterStart() const throw ();
-    virtual const bool iterMore() const throw ();
-    virtual void       iterNext() const throw (OperationFailed);
-    virtual const T&   iterCurrent() const throw () = 0;
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                           {return DataStructure<T>::newIterator(*this);}
+
+  protected:
+    Node* _first;
+    Node* _last;
+
+    template<class... Args>
+    Node *const        newNode(Node *const, Args&&...);
+    void               deleteNode(Node *const) noexcept;
+    void               initWithVarArgs(const unsigned int, va_list&);
 
     #ifndef NDEBUG
-      void             assertInvariants() const throw ();
+      void             assertInvariants() const noexcept;
     #endif
 
     // LinearStructure methods
@@ -83,7 +182,19 @@ template<class T> class DLinearStructure:
     virtual void     concatenate(const DataStructure<T>&);
 
   private:
-    Node * *const _iterCurrent;
+    NodePool      _pool;                     // the pool that this structure's nodes come from
+
+    void          appendNode(Node *const node) noexcept
+                    {
+                      if (_last != NULL)
+                        _last->setNext(node);
+                      else
+                        _first = node;
+
+                      _last = node;
+                      ++this->_numElements;
+                      return;
+                    }
 };
 
 // ============================================================================================
@@ -95,14 +206,26 @@ template<class T> class DLinearStructure:
 template<class T> DLinearStructure<T>::DLinearStructure():
   _first(NULL),
   _last(NULL),
-  _iterCurrent(new Node*)
+  _pool(sizeof(Node), alignof(Node))
 
 {
-  if (_iterCurrent == NULL)
-  {
-    throw OperationFailed("Insufficient memory to instantiate a DLinearStructure.", __FILE__,
-      __LINE__);
-  }
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DLinearStructure<T>::DLinearStructure(const DLinearStructure<T>& source):
+  _first(NULL),
+  _last(NULL),
+  _pool(source._pool)
+
+/*
+This constructor makes a deep copy of "source".  The copy gets its own (empty) pool with the
+same number of nodes per chunk as "source's" pool.
+*/
+
+{
+  concatenate(source);
   return;
 }
 
@@ -110,7 +233,8 @@ template<class T> DLinearStructure<T>::DLinearStructure():
 
 template<class T> DLinearStructure<T>::DLinearStructure(const DataStructure<T>& source):
   _first(NULL),
-  _last(NULL)
+  _last(NULL),
+  _pool(sizeof(Node), alignof(Node))
 
 {
   concatenate(source);
@@ -132,7 +256,7 @@ template<class T> void DLinearStructure<T>::empty()
 
 {
   #ifndef NDEBUG
-    assertInvariants();
+    DLinearStructure<T>::assertInvariants();
   #endif
 
   while (_first != NULL)
@@ -140,15 +264,15 @@ template<class T> void DLinearStructure<T>::empty()
     Node* current = _first;
 
     _first = _first->next();
-    --_numElements;
-    delete current;
+    --this->_numElements;
+    deleteNode(current);
   }
 
   _last = NULL;
-  assert(_numElements = 0U);
+  assert(this->_numElements == 0U);
 
   #ifndef NDEBUG
-    assertInvariants();
+    DLinearStructure<T>::assertInvariants();
   #endif
 
   return;
@@ -156,14 +280,34 @@ template<class T> void DLinearStructure<T>::empty()
 
 /*********************************************************************************************/
 
+template<class T> DLinearStructure<T>& DLinearStructure<T>::operator=
+(
+  const DLinearStructure<T>& source
+)
+
+/*
+This method is the same as the other "operator=()" -- it's only here because a "NodePool" can't
+be assigned, so the compiler can't generate one.  The pool is left as it is.
+*/
+
+{
+  return operator=(static_cast<const DataStructure<T>&>(source));
+}
+
+/*********************************************************************************************/
+
 template<class T> DLinearStructure<T>& DLinearStructure<T>::operator=
 (
   const DataStructure<T>& source
 )
 
 {
-  empty();
-  concatenate(source);
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
   return *this;
 }
 
@@ -181,77 +325,123 @@ template<class T> DLinearStructure<T>& DLinearStructure<T>::operator+=
 
 /*********************************************************************************************/
 
-template<class T> void DLinearStructure<T>::initWithVarArgs
+template<class T> void DLinearStructure<T>::setNodesPerChunk
 (
-  const unsigned int numElements,
-  va_list&           elements
+  const unsigned int nodesPerChunk      // no. of nodes to allocate from the heap at a time
 )
 
-{
-  assert(_first == NULL && _last == NULL && _numElements == 0U);
+/*
+This method changes how many nodes this structure's pool allocates from the heap at a time.  0
+turns pooling off, so that every node is allocated from and returned to the heap individually.
 
-  for (unsigned int currentElement = 0U; currentElement < numElements; ++currentElement)
-  {
-    Node const* newNode = new Node(va_arg(elements, T), NULL);
+Any memory that the pool is holding onto is returned to the heap.
 
-    if (newNode == NULL)
-      throw Full(__FILE__, __LINE__);
+PRECONDITIONS:
+The structure must be empty.
 
-    if (_first == NULL)
-      _first = newNode;
-
-    if (_last != NULL)
-      _last->setNext(newNode);
+POSTCONDITIONS:
+Nodes will be allocated "nodesPerChunk" at a time.
+*/
 
-    _last = newNode
-    ++_numElements;
+{
+  if (_first != NULL)
+  {
+    throw OperationFailed("The node pool of a non-empty DLinearStructure can't be changed.",
+      __FILE__, __LINE__);
   }
 
+  _pool.reset(nodesPerChunk);
   return;
 }
 
 /*********************************************************************************************/
 
-template<class T> void DLinearStructure<T>::iterStart() const throw ()
-{
-  *_iterCurrent = _first;
-  return;
-}
+template<class T> template<class... Args>
+typename DLinearStructure<T>::Node *const DLinearStructure<T>::newNode
+(
+  Node *const next,                                // the node that will follow the new one
+  Args&&...   arguments                          // the arguments to construct the element from
+)
 
-/*********************************************************************************************/
+/*
+This method constructs a new node in a slot from the pool and returns it.  The node's element
+is constructed in place from "arguments" -- passing an element copies it, passing an rvalue
+moves it and passing anything else calls the matching "T" constructor.
+
+"Full" is thrown if no memory could be allocated for the node.  "OperationFailed" is thrown if
+the element couldn't be constructed -- the slot is returned to the pool in that case.
+*/
 
-template<class T> const bool DLinearStructure<T>::iterMore() const throw ()
 {
-  return *_iterCurrent != NULL;
+  void *const slot = _pool.allocate();
+
+  if (slot == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  try
+  {
+    return new(slot) Node(next, std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    _pool.release(slot);
+    throw OperationFailed("Unable to copy an element into a new node.", __FILE__, __LINE__);
+  }
 }
 
 /*********************************************************************************************/
 
-template<class T> void DLinearStructure<T>::iterNext() const throw ()
+template<class T> void DLinearStructure<T>::deleteNode
+(
+  Node *const node                              // a node that was created by "newNode()"
+)
+noexcept
+
 {
-  assert(*_iterCurrent != NULL);
+  assert(node != NULL);
+
+  node->~Node();
+  _pool.release(node);
 
-  *_iterCurrent = (*_iterCurrent)->next();
   return;
 }
 
 /*********************************************************************************************/
 
-template<class T> const T& DLinearStructure<T>::iterCurrent() const throw ()
+template<class T> void DLinearStructure<T>::initWithVarArgs
+(
+  const unsigned int numElements,
+  va_list&           elements
+)
+
 {
-  assert(*_iterCurrent != NULL);
+  assert(_first == NULL && _last == NULL && this->_numElements == 0U);
 
-  return *((*_iterCurrent)->element());
+  for (unsigned int currentElement = 0U; currentElement < numElements; ++currentElement)
+  {
+    Node *const node = newNode(NULL, va_arg(elements, T));
+
+    if (_first == NULL)
+      _first = node;
+
+    if (_last != NULL)
+      _last->setNext(node);
+
+    _last = node;
+    ++this->_numElements;
+  }
+
+  return;
 }
 
 /*********************************************************************************************/
 
 #ifndef NDEBUG
-  template<class T> void DLinearStructure<T>::assertInvariants() const throw ()
+  template<class T> void DLinearStructure<T>::assertInvariants() const noexcept
 
   {
-    assert((_numElements > 1U) || (_first == _last));
-    assert(_numElements == 0U ? _first == NULL : _first != NULL));
+    assert((this->_numElements > 1U) || (_first == _last));
+    assert(this->_numElements == 0U ? _first == NULL : _first != NULL);
 
     return;
   }
@@ -269,21 +459,31 @@ template<class T> void DLinearStructure<T>::concatenate
     DLinearStructure<T>::assertInvariants();
   #endif
 
-  for (source.iterStart(); source.iterMore(); source.iterNext())
-  {
-    Node const* newNode = new Node(source.iterCurrent(), NULL);
+  bool               isReversed;
+  const T *const     block = source.contiguousElements(isReversed);
+  const unsigned int count(source.numElements());
 
-    if (newNode == NULL)
-      throw Full(__FILE__, __LINE__);
+  if (block != NULL)
+  {
+    /*
+    "source's" elements are contiguous, so they're read straight out of the block without
+    going through an "Iterator_".
+    */
 
-    if (_first == NULL)
-      _first = newNode;
+    for (unsigned int i = 0U; i < count; ++i)
+      appendNode(newNode(NULL, block[isReversed ? count - 1U - i : i]));
+  }
+  else
+  {
+    /*
+    Only "count" elements are copied, so that concatenating a structure to itself stops at the
+    nodes that were there to begin with instead of chasing the ones that it appends.
+    */
 
-    if (_last != NULL)
-      _last->setNext(newNode);
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
 
-    _last = newNode
-    ++_numElements;
+    for (unsigned int n = 0U; n < count; ++n, i->next())
+      appendNode(newNode(NULL, *i->current()));
   }
 
   #ifndef NDEBUG
@@ -299,12 +499,12 @@ template<class T> void DLinearStructure<T>::concatenate
 
 /*********************************************************************************************/
 
-template<class T> DLinearStructure<T>::Node::Node
+template<class T> template<class... Args> DLinearStructure<T>::Node::Node
 (
-  const T&    newElement,
-  Node *const next
+  Node *const next,
+  Args&&...   arguments
 ):
-  _element(newElement),
+  _element(std::forward<Args>(arguments)...),
   _next(next)
 
 {
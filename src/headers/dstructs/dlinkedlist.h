@@ -1,6 +1,21 @@
 #ifndef DSTRUCTS_DLINKEDLIST_H
 #define DSTRUCTS_DLINKEDLIST_H
 
+// ============================================================================================
+//
+// dlinkedlist.h -- Implementation of a dynamic singly-linked list
+//
+// ============================================================================================
+
+/*
+This class is a dynamic singly-linked list.  A "DLinkedList" is a "LinkedList".
+
+The list has a cursor:  "_current" is the node that "retrieve()" returns and that "insert()"
+inserts in front of, and "_prev" is the node before it (or NULL if "_current" is the first
+node).  When the cursor has moved past the last node, "_current" is NULL and "_prev" is the
+last node.
+*/
+
 // ============================================================================================
 // INCLUDE FILES
 // ============================================================================================
@@ -8,8 +23,10 @@
 #include <assert.h>
 
 #ifdef FAT_FILENAMES
+  #include <dstructs/dlinearst.h>
   #include <dstructs/linkedli.h>
 #else
+  #include <dstructs/dlinearstructure.h>
   #include <dstructs/linkedlist.h>
 #endif
 
@@ -18,33 +35,51 @@
 // ============================================================================================
 
 template <class T> class DLinkedList:
+  virtual public DataStructureExceptions,
   virtual public DLinearStructure<T>,
   virtual public LinkedList<T>
 {
   public:
-                       DLinkedList<T>() throw ():
+                       DLinkedList():
                          _prev(NULL), _current(NULL) {return;}
+                       DLinkedList(const DLinkedList<T>& source):
+                         DLinearStructure<T>(source), _prev(NULL),
+                         _current(_first) {return;}
 
+    DLinkedList<T>&    operator=(const DLinkedList<T>&);
     DLinkedList<T>&    operator=(const DataStructure<T>&);
     DLinkedList<T>&    operator+=(const DataStructure<T>&);
 
+    // DataStructure<T> methods
+
+    virtual void       empty();
+
     // LinkedList<T> methods
 
-    virtual void       findFirst() throw (Empty);
-    virtual void       findNext() throw (Empty, OperationFailed);
-    virtual T *const   retrieve() throw (Empty);
+    virtual void       findFirst();
+    virtual void       findNext();
+    virtual T *const   retrieve();
     virtual void       insert(const T&);
     virtual void       append(const T&);
     virtual void       remove();
-    virtual const bool isLast() const throw (Empty);
+    virtual const bool isLast() const;
 
-  private:
+  protected:
+    typedef typename DLinearStructure<T>::Node Node;
+
+    using DLinearStructure<T>::_first;
+    using DLinearStructure<T>::_last;
+
+    // LinearStructure<T> methods
+
+    virtual void       concatenate(const DataStructure<T>&);
 
+  private:
     Node* _prev;
     Node* _current;
 
     #ifndef NDEBUG
-      void assertInvariants() const throw ();
+      void assertInvariants() const noexcept;
     #endif
 };
 
@@ -52,14 +87,36 @@ template <class T> class DLinkedList:
 // METHOD DEFINITIONS
 // ============================================================================================
 
+/*********************************************************************************************/
+
+template<class T> DLinkedList<T>& DLinkedList<T>::operator=
+(
+  const DLinkedList<T>& source                                 // the source list to copy from
+)
+
+/*
+This method is the same as the other "operator=()" -- it's only here because otherwise the
+compiler would generate a (memberwise) one for assigning one "DLinkedList" to another.
+*/
+
+{
+  return operator=(static_cast<const DataStructure<T>&>(source));
+}
+
+/*********************************************************************************************/
+
 template<class T> DLinkedList<T>& DLinkedList<T>::operator=
 (
   const DataStructure<T>& source
 )
 
 {
-  empty();
-  concatenate(source);
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
   return *this;
 }
 
@@ -77,7 +134,7 @@ template<class T> DLinkedList<T>& DLinkedList<T>::operator+=
 
 /*********************************************************************************************/
 
-template <class T> void DLinkedListT<T>::findFirst()
+template <class T> void DLinkedList<T>::findFirst()
 
 {
   #ifndef NDEBUG
@@ -92,7 +149,7 @@ template <class T> void DLinkedListT<T>::findFirst()
 
 /*********************************************************************************************/
 
-template <class T> void DLinkedListT<T>::findNext() throw (DataStructure::OperationFailed)
+template <class T> void DLinkedList<T>::findNext()
 
 {
   #ifndef NDEBUG
@@ -110,7 +167,7 @@ template <class T> void DLinkedListT<T>::findNext() throw (DataStructure::Operat
 
 /*********************************************************************************************/
 
-template <class T> T *const DLinkedListT<T>::current() const throw ()
+template <class T> T *const DLinkedList<T>::retrieve()
 
 {
   #ifndef NDEBUG
@@ -122,90 +179,78 @@ template <class T> T *const DLinkedListT<T>::current() const throw ()
 
 /*********************************************************************************************/
 
-template <class T> void DLinkedListT<T>::insert(const T& newElement) throw
-  (DataStructure::Full, DataStructure::OperationFailed)
+template <class T> void DLinkedList<T>::insert(const T& newElement)
+
+/*
+This method inserts a copy of "newElement" in front of the current element (or at the end of
+the list if the cursor has moved past the last element).  The new element becomes the current
+element.
+*/
 
 {
   #ifndef NDEBUG
     assertInvariants();
   #endif
 
-  Node* newNode;
+  Node *const node = this->newNode(_current, newElement);
 
-  try
-  {
-    newNode = new Node(newElement, _current)
-  }
-  catch (...)
+  if (_prev != NULL)
   {
-    throw OperationFailed("Unable to copy an element while inserting.", __FILE__, __LINE__);
-  }
-
-  if (newNode == NULL)
-    throw Full(__FILE__, __LINE__);
+    if (_prev == _last)
+      _last = node;
 
-  if (_first == NULL)
-  {
-    _first = _newNode;
-    _last  = _newNode;
+    _prev->setNext(node);
   }
-
-  if (_prev != NULL)
+  else
   {
-    if (_prev->next() == NULL)
-      _last = _newNode;
+    if (_first == NULL)
+      _last = node;
 
-    _prev->setNext(_newNode);
+    _first = node;
   }
 
-  _current = _newNode;
+  _current = node;
 
-  ++_numElements;
+  ++this->_numElements;
   return;
 }
 
 /*********************************************************************************************/
 
-template <class T> void DLinkedListT<T>::append(const T& newElement) throw
-  (DataStructure::Full, DataStructure::OperationFailed)
+template <class T> void DLinkedList<T>::append(const T& newElement)
+
+/*
+This method adds a copy of "newElement" to the end of the list.  The new element becomes the
+current element.
+*/
 
 {
   #ifndef NDEBUG
     assertInvariants();
   #endif
 
-  Node* newNode;
-
-  try
-  {
-    newNode = new Node(newElement, _current)
-  }
-  catch (...)
-  {
-    throw OperationFailed("Unable to copy an element while appending.", __FILE__, __LINE__);
-  }
-
-  if (newNode == NULL)
-    throw Full(__FILE__, __LINE__);
+  Node *const node = this->newNode(NULL, newElement);
 
   if (_last == NULL)
-    _first = _newNode;
+    _first = node;
   else
-  {
-    _prev = _last;
-    _prev->setNext(newNode);
-  }
+    _last->setNext(node);
 
-  _last    = _newNode;
-  _current = _newNode;
+  _prev    = _last;
+  _last    = node;
+  _current = node;
 
-  ++_numElements;
+  ++this->_numElements;
   return;
 }
 
 /*********************************************************************************************/
 
-template <class T> void DLinkedListT<T>::deleteCurrent() throw (DataStructure::OperationFailed)
+template <class T> void DLinkedList<T>::remove()
+
+/*
+This method removes the current element.  The element after it becomes the current element.
+*/
 
 {
   #ifndef NDEBUG
@@ -222,12 +267,7 @@ template <class T> void DLinkedListT<T>::deleteCurrent() throw (DataStructure::O
   {
     _first = _first->next();
 
-    try
-    {
-      delete _current;
-    }
-    catch (...)
-    {}
+    this->deleteNode(_current);
 
     _current = _first;
   }
@@ -235,50 +275,87 @@ template <class T> void DLinkedListT<T>::deleteCurrent() throw (DataStructure::O
   {
     _prev->setNext(_current->next());
 
-    try
-    {
-      delete _current;
-    }
-    catch (...)
-    {}
+    this->deleteNode(_current);
 
     _current = _prev->next();
   }
 
-  --_numElements;
+  --this->_numElements;
   return;
 }
 
 /*********************************************************************************************/
 
-template <class T> void DLinkedListT::empty() throw ()
+template <class T> const bool DLinkedList<T>::isLast() const
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return (_current != NULL && _current == _last);
+}
+
+/*********************************************************************************************/
+
+template <class T> void DLinkedList<T>::empty()
 
 {
   #ifndef NDEBUG
     assertInvariants();
   #endif
 
-  DLinearStructureT<T>::empty();
+  DLinearStructure<T>::empty();
 
   _prev    = NULL;
   _current = NULL;
 
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template <class T> void DLinkedList<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method appends copies of "source's" elements to the list.  If the cursor had moved past
+the last element then it ends up on the first of the new ones.
+*/
+
+{
+  DLinearStructure<T>::concatenate(source);
+
+  if (_current == NULL)
+    _current = (_prev != NULL ? _prev->next() : _first);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
   return;
 }
 
 /*********************************************************************************************/
 
 #ifndef NDEBUG
-  template <class T> void DLinkedListT<T>::assertInvariants() const throw ()
+  template <class T> void DLinkedList<T>::assertInvariants() const noexcept
 
   {
+    DLinearStructure<T>::assertInvariants();
+
     assert(_first != NULL || (_current == NULL && _prev == NULL));
     assert(_prev == NULL || _prev->next() == _current);
     assert(_prev != NULL || _current == _first);
-    assert(_prev == NULL || _prev != _last || _prev->next() == NULL);
 
     return;
   }
 #endif
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,1354 @@
+#ifndef DSTRUCTS_DLOCKFREESKIPLIST_H
+#define DSTRUCTS_DLOCKFREESKIPLIST_H
+
+// ============================================================================================
+//
+// dlockfreeskiplist.h -- Implementation of a dynamic ordered set that several threads can
+// search and change at the same time without any locks.
+//
+// ============================================================================================
+
+/*
+This class is a lock-free skip list holding an ordered set of elements.  A "DLockFreeSkipList"
+is a "DataStructure".
+
+The elements are kept in the order that "Compare" defines and each element appears at most
+once, as in an "AVLTree":
+
+  DLockFreeSkipList<unsigned int> sessions;
+
+  sessions.insert(42U);                      // false if 42 was already there
+  sessions.remove(17U);                      // false if 17 wasn't there
+
+  if (sessions.contains(42U))
+    ...
+
+  for (DLockFreeSkipList<unsigned int>::ConstElementIterator i = sessions.lowerBound(100U);
+    i != sessions.end(); ++i)
+    ...
+
+Any number of threads can call any of the methods on the same "DLockFreeSkipList" at the same
+time, with no locks.  "insert()", "remove()", "contains()" and "lowerBound()" each take effect
+at a single instant, so they behave as though they'd been called one at a time in some order.
+
+Iterations are weakly consistent:  an iterator visits elements in ascending order, never visits
+an element twice and never visits one that was removed before the iteration began.  Every
+element that's in the set for the whole iteration is visited.  Elements added or removed while
+it's under way may or may not be.  An iterator stays safe to use no matter what other threads
+remove, but it holds up the reclamation of removed elements while it exists (see below), so
+iterators shouldn't be kept for long.
+
+"numElements()" and "isEmpty()" can be called at any time, but they're only exact while no
+other thread is changing the set.  Otherwise they give a snapshot.  Called through a reference
+to a base class, as the copy operations of other structures do, they're the base class's
+ordinary reads of the count, so they mustn't overlap with changes.  "empty()", "concatenate()"
+and the copy operations are one "remove()" or "insert()" per element, not single atomic steps.
+
+Elements can't be changed in place (that could put them out of order), so both kinds of
+element iterator are constant.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+This is the lock-free skip list of Fraser and of Herlihy and Shavit.  Each level is a sorted
+singly-linked list built from compare-and-swaps, as in Harris's lock-free linked list, and
+each node is on level 0 and also on each level above with probability 1/4 (up to
+"MAX_HEIGHT").
+
+A node is removed in two steps.  First it's removed logically by setting the low "mark" bit of
+its "next" pointers (top level first).  Then it's unlinked physically, level by level.  The
+marked pointers can no longer be changed, so nothing can be linked in after a node that's being
+removed.  Marking level 0 is what removes the element -- whichever thread marks it wins, and
+any other removal of the same node returns false.  Unlinking is done by "find()", which snips
+out every marked node that it passes.  Every thread that searches helps with the unlinking, so
+no thread ever waits for another.
+
+"insert()" links a new node into level 0 first -- which adds the element -- and then into the
+levels above, one at a time.  It re-searches whenever a link fails.  It stops early if the node
+has been marked in the meantime.
+
+Reclamation is the hard part.  A thread may still be reading a node (or following its "next"
+pointers) after another thread has unlinked it.  The reuse-only free list of "DLockFreeStack"
+isn't enough here:  a reader that wandered into a reused node could follow its new links to
+the wrong place.  Removed nodes are therefore freed with epoch-based reclamation:
+
+  - There's a global epoch counter.  Each operation (and each live iterator) "enters" the
+    epoch that's current when it starts and "leaves" when it's done.  Entering is counted in
+    one of "STRIPES" cache-line-sized counter sets.  A thread always uses the same stripe, so
+    threads don't usually contend for a counter.
+
+  - A node is retired only once it's unlinked from every level.  It goes onto the limbo list
+    of the epoch that's current then.  Only operations that entered that epoch or earlier can
+    still hold a pointer to it.
+
+  - The epoch is advanced from e to e + 1 only when nothing is left in epoch e - 1.  The nodes
+    retired in epoch e - 1 are then freed:  everything that could have seen them is gone.
+    Only three epochs are ever live, so the counters and limbo lists are indexed modulo 3.
+
+  - A thread tries to advance the epoch after every "RECLAIM_INTERVAL" of its removals.
+
+The unlinking step above has one race to close.  An inserter may link a node into an upper
+level after the remover has already unlinked it.  So the node is retired by whichever of the
+two finishes last.  That thread first does another "find()" to unlink the node from every level
+that it ended up on.  The "state" flags record who has finished.  An inserter that sees the
+node marked also does a "find()" before it records that it has finished, even if it finishes
+first:  the remover's "find()" may have run before the inserter's last link went in.
+
+Nodes are allocated from the heap and freed to the heap.  "NodePool" isn't thread-safe, and the
+skip list's variable-height nodes wouldn't fit a single pool anyway.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include <sdp.h>
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/datastruct.h>
+#else
+  #include <dstructs/datastructure.h>
+#endif
+
+// ============================================================================================
+// DLOCKFREESKIPLIST<T, COMPARE> CLASS DECLARATION
+// ============================================================================================
+
+template<class T, class Compare = std::less<T> > class DLockFreeSkipList:
+  virtual public DataStructureExceptions,
+  virtual public DataStructure<T>
+{
+  public:
+    static const unsigned int MAX_HEIGHT = 16U;           // enough for 4^16 elements
+
+  private:
+    typedef std::atomic<uintptr_t> Link;      // a "Node*" whose low bit is the "mark" bit
+
+    struct Node
+    {
+      T                          element;
+      std::atomic<unsigned char> state;         // "INSERTED" and/or "REMOVED"
+      unsigned char              height;        // the no. of links after the node
+      Node*                      nextRetired;   // the next node on a limbo list
+
+      template<class... Args>
+      Node(const unsigned int newHeight, Args&&... arguments):
+        element(std::forward<Args>(arguments)...), state(0U),
+        height((unsigned char)newHeight), nextRetired(NULL)
+        {return;}
+
+      Link *const links() noexcept
+                    {return reinterpret_cast<Link*>(reinterpret_cast<char*>(this) +
+                       LINKS_OFFSET);}
+    };
+
+  public:
+                           DLockFreeSkipList() noexcept;
+                           DLockFreeSkipList(const DLockFreeSkipList<T, Compare>&);
+                           DLockFreeSkipList(const DataStructure<T>&);
+    virtual                ~DLockFreeSkipList();
+
+    DLockFreeSkipList<T, Compare>& operator=(const DLockFreeSkipList<T, Compare>&);
+    DLockFreeSkipList<T, Compare>& operator=(const DataStructure<T>&);
+    DLockFreeSkipList<T, Compare>& operator+=(const DataStructure<T>&);
+
+    const bool             insert(const T& element)
+                             {return add(element);}
+    const bool             insert(T&& element)
+                             {return add(std::move(element));}
+    const bool             remove(const T&) noexcept;
+    const bool             contains(const T&) const noexcept;
+
+    // Element iterators
+
+    /*
+    The element iterators visit the elements in ascending order.  Each one (other than "end()")
+    keeps the epoch that it was created in entered until it's destroyed or reaches the end, so
+    the node that it's on can't be freed under it.
+    */
+
+    class NodeIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef const T*                  pointer;
+        typedef const T&                  reference;
+
+                      NodeIterator() noexcept:
+                        _list(NULL), _node(NULL) {return;}
+                      NodeIterator(const NodeIterator& source) noexcept;
+                      ~NodeIterator()
+                        {leave(); return;}
+
+        NodeIterator& operator=(const NodeIterator&) noexcept;
+
+        const T&      operator*() const noexcept
+                        {return _node->element;}
+        const T*      operator->() const noexcept
+                        {return &_node->element;}
+        NodeIterator& operator++() noexcept;
+        NodeIterator  operator++(int) noexcept
+                        {const NodeIterator old(*this); ++*this; return old;}
+
+        const bool    operator==(const NodeIterator& rhs) const noexcept
+                        {return _node == rhs._node;}
+        const bool    operator!=(const NodeIterator& rhs) const noexcept
+                        {return _node != rhs._node;}
+
+      private:
+        const DLockFreeSkipList<T, Compare>* _list;   // the list, or NULL if not in an epoch
+        Node*                                _node;   // the current node, or NULL past the end
+        unsigned int                         _stripe; // the stripe that counts the epoch
+        unsigned int                         _epoch;  // the epoch entered, modulo 3
+
+                      NodeIterator(const DLockFreeSkipList<T, Compare> *const list) noexcept:
+                        _list(list), _node(NULL), _stripe(threadStripe()),
+                        _epoch(list->enter(_stripe)) {return;}
+
+        void          leave() noexcept;
+
+        friend class DLockFreeSkipList<T, Compare>;
+    };
+
+    typedef NodeIterator ElementIterator;
+    typedef NodeIterator ConstElementIterator;
+
+    ConstElementIterator   begin() const noexcept;
+    ConstElementIterator   end() const noexcept
+                             {return ConstElementIterator();}
+
+    ConstElementIterator   lowerBound(const T&) const noexcept;
+
+    // DataStructure<T> methods
+
+    const unsigned int     numElements() const noexcept
+                             {return count().load(std::memory_order_relaxed);}
+    const bool             isEmpty() const noexcept
+                             {return numElements() == 0U;}
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    // Copying
+
+    virtual void           concatenate(const DataStructure<T>&);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+    static const uintptr_t     MARK             = 1U;
+    static const unsigned char INSERTED         = 1U;  // the inserter has finished linking
+    static const unsigned char REMOVED          = 2U;  // the remover has finished unlinking
+    static const unsigned int  STRIPES          = 64U;
+    static const unsigned int  RECLAIM_INTERVAL = 32U;
+    static const size_t        CACHE_LINE_SIZE  = 64U;
+    static const size_t        LINKS_OFFSET     = (sizeof(Node) + alignof(Link) - 1U) /
+                                 alignof(Link) * alignof(Link);
+    static const size_t        NODE_ALIGNMENT   = alignof(Node) > alignof(Link) ?
+                                 alignof(Node) : alignof(Link);
+
+    /*
+    Each stripe counts the operations and iterators in each of the three live epochs.
+    */
+
+    struct alignas(CACHE_LINE_SIZE) Stripe
+    {
+      std::atomic<unsigned int> numActive[3];
+    };
+
+    Link                               _head[MAX_HEIGHT];     // the head's links
+    alignas(CACHE_LINE_SIZE) mutable std::atomic<unsigned int> _epoch;   // the global epoch
+    std::atomic<Node*>                 _retired[3];           // a limbo list for each epoch
+    mutable Stripe                     _stripes[STRIPES];
+
+    template<class Arg>
+    const bool             add(Arg&&);
+    const bool             find(const T&, Link* (&)[MAX_HEIGHT], Node* (&)[MAX_HEIGHT])
+                             noexcept;
+    const bool             tryFind(const T&, Link* (&)[MAX_HEIGHT], Node* (&)[MAX_HEIGHT],
+                             bool&) noexcept;
+    Node *const            lowerBoundNode(const T&) const noexcept;
+    Node *const            nextNode(Node *const) const noexcept;
+
+    const unsigned int     enter(const unsigned int) const noexcept;
+    void                   leave(const unsigned int stripe, const unsigned int epoch) const
+                             noexcept
+                             {_stripes[stripe].numActive[epoch].fetch_sub(1U,
+                                std::memory_order_release); return;}
+    void                   retire(Node *const) noexcept;
+    void                   tryToReclaim() noexcept;
+    void                   adjustNumElements(const int) noexcept;
+    void                   deleteNodes() noexcept;
+
+    std::atomic_ref<unsigned int> count() const noexcept
+                             {
+                               return std::atomic_ref<unsigned int>(
+                                 const_cast<unsigned int&>(this->_numElements));
+                             }
+
+    template<class... Args>
+    static Node *const     newNode(const unsigned int, Args&&...);
+    static void            deleteNode(Node *const) noexcept;
+    static void            deleteChain(Node*) noexcept;
+
+    static const unsigned int threadStripe() noexcept
+                             {return threadNumber() % STRIPES;}
+    static const unsigned int threadNumber() noexcept;
+    static const unsigned int randomHeight() noexcept;
+
+    static Node *const     pointerOf(const uintptr_t link) noexcept
+                             {return reinterpret_cast<Node*>(link & ~MARK);}
+    static const bool      isMarked(const uintptr_t link) noexcept
+                             {return (link & MARK) != 0U;}
+};
+
+// ============================================================================================
+// DLOCKFREESKIPLIST<T, COMPARE> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Compare> DLockFreeSkipList<T, Compare>::DLockFreeSkipList() noexcept:
+
+/*
+This constructor instanciates an empty set.
+*/
+
+  _epoch(0U)
+
+{
+  for (unsigned int level = 0U; level < MAX_HEIGHT; ++level)
+    _head[level].store(0U, std::memory_order_relaxed);
+
+  for (unsigned int epoch = 0U; epoch < 3U; ++epoch)
+  {
+    _retired[epoch].store(NULL, std::memory_order_relaxed);
+
+    for (unsigned int stripe = 0U; stripe < STRIPES; ++stripe)
+      _stripes[stripe].numActive[epoch].store(0U, std::memory_order_relaxed);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> DLockFreeSkipList<T, Compare>::DLockFreeSkipList
+(
+  const DLockFreeSkipList<T, Compare>& source                        // the set to copy
+):
+
+/*
+This constructor makes a copy of "source".  Other threads may be changing "source" at the same
+time -- the copy then holds what a weakly consistent iteration of "source" visited.
+*/
+
+  _epoch(0U)
+
+{
+  for (unsigned int level = 0U; level < MAX_HEIGHT; ++level)
+    _head[level].store(0U, std::memory_order_relaxed);
+
+  for (unsigned int epoch = 0U; epoch < 3U; ++epoch)
+  {
+    _retired[epoch].store(NULL, std::memory_order_relaxed);
+
+    for (unsigned int stripe = 0U; stripe < STRIPES; ++stripe)
+      _stripes[stripe].numActive[epoch].store(0U, std::memory_order_relaxed);
+  }
+
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    deleteNodes();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> DLockFreeSkipList<T, Compare>::DLockFreeSkipList
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+):
+
+/*
+This constructor instanciates a set that holds copies of "source's" elements (without
+duplicates).
+*/
+
+  _epoch(0U)
+
+{
+  for (unsigned int level = 0U; level < MAX_HEIGHT; ++level)
+    _head[level].store(0U, std::memory_order_relaxed);
+
+  for (unsigned int epoch = 0U; epoch < 3U; ++epoch)
+  {
+    _retired[epoch].store(NULL, std::memory_order_relaxed);
+
+    for (unsigned int stripe = 0U; stripe < STRIPES; ++stripe)
+      _stripes[stripe].numActive[epoch].store(0U, std::memory_order_relaxed);
+  }
+
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    deleteNodes();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> DLockFreeSkipList<T, Compare>::~DLockFreeSkipList()
+
+/*
+This destructor frees every node -- the ones still in the set and the ones in limbo.  No other
+thread may be using the set by now (and no iterators to it may be left).
+*/
+
+{
+  deleteNodes();
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+DLockFreeSkipList<T, Compare>& DLockFreeSkipList<T, Compare>::operator=
+(
+  const DLockFreeSkipList<T, Compare>& source                        // the set to copy
+)
+
+/*
+As with "DLockFreeStack", this isn't a single atomic step -- other threads may see the set
+part-way between its old and new contents.
+*/
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+DLockFreeSkipList<T, Compare>& DLockFreeSkipList<T, Compare>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+DLockFreeSkipList<T, Compare>& DLockFreeSkipList<T, Compare>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const bool DLockFreeSkipList<T, Compare>::remove
+(
+  const T& element                                              // the element to remove
+)
+noexcept
+
+/*
+This method removes the element equal to "element" and returns true, or returns false if there
+isn't one.  It takes effect when the element's level-0 link is marked.
+*/
+
+{
+  const unsigned int stripe = threadStripe();
+  const unsigned int epoch  = enter(stripe);
+  Link*              predecessors[MAX_HEIGHT];
+  Node*              successors[MAX_HEIGHT];
+  bool               isRemoved(false);
+
+  if (find(element, predecessors, successors))
+  {
+    Node *const victim = successors[0];
+    Link *const links  = victim->links();
+
+    // Mark the upper levels, top first, so that nothing more can be linked in after the node.
+
+    for (unsigned int level = victim->height; level-- > 1U; )
+    {
+      uintptr_t next(links[level].load(std::memory_order_acquire));
+
+      while (!isMarked(next) && !links[level].compare_exchange_weak(next, next | MARK,
+        std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+      }
+    }
+
+    // Marking level 0 removes the element -- unless another thread gets there first.
+
+    uintptr_t next(links[0].load(std::memory_order_acquire));
+
+    while (!isMarked(next))
+    {
+      if (links[0].compare_exchange_weak(next, next | MARK, std::memory_order_acq_rel,
+        std::memory_order_acquire))
+      {
+        isRemoved = true;
+        break;
+      }
+    }
+
+    if (isRemoved)
+    {
+      adjustNumElements(-1);
+      find(victim->element, predecessors, successors);
+
+      if ((victim->state.fetch_or(REMOVED, std::memory_order_acq_rel) & INSERTED) != 0U)
+        retire(victim);
+    }
+  }
+
+  leave(stripe, epoch);
+
+  if (isRemoved)
+    tryToReclaim();
+
+  return isRemoved;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const bool DLockFreeSkipList<T, Compare>::contains
+(
+  const T& element                                              // the element to look for
+)
+const noexcept
+
+/*
+This method returns true if an element equal to "element" is in the set.  It only reads the
+list (marked nodes are stepped over rather than snipped out), so searches never write to shared
+memory other than their own stripe's counter.
+*/
+
+{
+  const unsigned int stripe = threadStripe();
+  const unsigned int epoch  = enter(stripe);
+  Node *const        node   = lowerBoundNode(element);
+  const bool         isFound(node != NULL && !Compare()(element, node->element));
+
+  leave(stripe, epoch);
+
+  return isFound;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> DLockFreeSkipList<T, Compare>::NodeIterator::NodeIterator
+(
+  const NodeIterator& source                                    // the iterator to copy
+)
+noexcept:
+
+/*
+The copy enters the same epoch as "source" (which can't have been left behind while "source"
+is in it), so it protects the same node.
+*/
+
+  _list(source._list),
+  _node(source._node),
+  _stripe(source._stripe),
+  _epoch(source._epoch)
+
+{
+  if (_list != NULL)
+    _list->_stripes[_stripe].numActive[_epoch].fetch_add(1U, std::memory_order_relaxed);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename DLockFreeSkipList<T, Compare>::NodeIterator&
+DLockFreeSkipList<T, Compare>::NodeIterator::operator=
+(
+  const NodeIterator& source                                    // the iterator to copy
+)
+noexcept
+
+{
+  if (&source != this)
+  {
+    if (source._list != NULL)
+    {
+      source._list->_stripes[source._stripe].numActive[source._epoch].fetch_add(1U,
+        std::memory_order_relaxed);
+    }
+
+    leave();
+
+    _list   = source._list;
+    _node   = source._node;
+    _stripe = source._stripe;
+    _epoch  = source._epoch;
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename DLockFreeSkipList<T, Compare>::NodeIterator&
+DLockFreeSkipList<T, Compare>::NodeIterator::operator++() noexcept
+
+/*
+This method moves on to the next element that isn't marked as removed.  The epoch is left as
+soon as the end is reached.
+*/
+
+{
+  _node = _list->nextNode(_node);
+
+  if (_node == NULL)
+    leave();
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void DLockFreeSkipList<T, Compare>::NodeIterator::leave()
+  noexcept
+
+{
+  if (_list != NULL)
+  {
+    _list->leave(_stripe, _epoch);
+    _list = NULL;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename DLockFreeSkipList<T, Compare>::ConstElementIterator
+DLockFreeSkipList<T, Compare>::begin() const noexcept
+
+/*
+This method returns an iterator to the smallest element, or "end()" if the set is empty.
+*/
+
+{
+  ConstElementIterator first(this);
+  const uintptr_t      link(_head[0].load(std::memory_order_acquire));
+
+  first._node = pointerOf(link);
+
+  if (first._node != NULL && isMarked(first._node->links()[0].load(std::memory_order_acquire)))
+    first._node = nextNode(first._node);
+
+  if (first._node == NULL)
+    first.leave();
+
+  return first;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename DLockFreeSkipList<T, Compare>::ConstElementIterator
+DLockFreeSkipList<T, Compare>::lowerBound
+(
+  const T& element                                              // the element to look for
+)
+const noexcept
+
+/*
+This method returns an iterator to the smallest element that isn't less than "element", or
+"end()" if there isn't one.
+*/
+
+{
+  ConstElementIterator bound(this);
+
+  bound._node = lowerBoundNode(element);
+
+  if (bound._node == NULL)
+    bound.leave();
+
+  return bound;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void DLockFreeSkipList<T, Compare>::empty() noexcept
+
+/*
+This method removes the elements one at a time, smallest first, until it finds the set empty.
+Elements that other threads add meanwhile may be removed too.
+*/
+
+{
+  for (;;)
+  {
+    const ConstElementIterator first(begin());
+
+    if (first == end())
+      break;
+
+    remove(*first);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void DLockFreeSkipList<T, Compare>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method adds copies of the elements of "source" that aren't already in the set.  If an
+exception is thrown then the elements that were added before it stay in the set.
+*/
+
+{
+  if (&source == this)
+    return;
+
+  bool           isReversed;
+  const T *const block = source.contiguousElements(isReversed);
+
+  if (block != NULL)
+  {
+    const unsigned int numToCopy(source.numElements());
+
+    for (unsigned int i = 0U; i < numToCopy; ++i)
+      add(block[isReversed ? numToCopy - 1U - i : i]);
+  }
+  else
+  {
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+    for (; i->more(); i->next())
+      add(*i->current());
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T, class Compare> void DLockFreeSkipList<T, Compare>::assertInvariants() const
+    noexcept
+
+  /*
+  Nothing can be asserted about the links while other threads may be changing them, so only
+  the head (which is never marked) is checked.
+  */
+
+  {
+    for (unsigned int level = 0U; level < MAX_HEIGHT; ++level)
+      assert(!isMarked(_head[level].load(std::memory_order_relaxed)));
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T, class Compare> template<class Arg>
+const bool DLockFreeSkipList<T, Compare>::add
+(
+  Arg&& element                                 // the element to copy (or move) into the set
+)
+
+/*
+This method adds "element" and returns true, or returns false if an equal element is already
+in the set.  It takes effect when the new node is linked into level 0.  The node is built
+before the search (and freed again if it isn't needed) so that nothing can throw once the
+search has begun.
+*/
+
+{
+  const unsigned int height = randomHeight();
+  Node *const        node   = newNode(height, std::forward<Arg>(element));
+  Link *const        links  = node->links();
+  const unsigned int stripe = threadStripe();
+  const unsigned int epoch  = enter(stripe);
+  Link*              predecessors[MAX_HEIGHT];
+  Node*              successors[MAX_HEIGHT];
+
+  for (;;)
+  {
+    if (find(node->element, predecessors, successors))
+    {
+      leave(stripe, epoch);
+      deleteNode(node);
+      return false;
+    }
+
+    for (unsigned int level = 0U; level < height; ++level)
+      links[level].store((uintptr_t)successors[level], std::memory_order_relaxed);
+
+    uintptr_t expected((uintptr_t)successors[0]);
+
+    if (predecessors[0]->compare_exchange_strong(expected, (uintptr_t)node,
+      std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+      break;
+    }
+  }
+
+  adjustNumElements(1);
+
+  /*
+  Link the node into the levels above.  Its link on each level is pointed at the current
+  successor first, unless it's been marked -- in which case the node is being removed and
+  there's no point going on.
+  */
+
+  bool isMarkSeen(false);
+
+  for (unsigned int level = 1U; level < height && !isMarkSeen; ++level)
+  {
+    for (;;)
+    {
+      uintptr_t next(links[level].load(std::memory_order_acquire));
+
+      if (isMarked(next))
+      {
+        isMarkSeen = true;
+        break;
+      }
+
+      if (next != (uintptr_t)successors[level] && !links[level].compare_exchange_strong(next,
+        (uintptr_t)successors[level], std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        continue;
+      }
+
+      uintptr_t expected((uintptr_t)successors[level]);
+
+      if (predecessors[level]->compare_exchange_strong(expected, (uintptr_t)node,
+        std::memory_order_acq_rel, std::memory_order_relaxed))
+      {
+        break;
+      }
+
+      find(node->element, predecessors, successors);
+    }
+
+    if (isMarked(links[level].load(std::memory_order_acquire)))
+      isMarkSeen = true;
+  }
+
+  /*
+  If the node was marked while it was being linked in then the remover may have finished
+  unlinking before the last few links went in.  Those are unlinked here -- before "INSERTED" is
+  set, since the remover retires the node as soon as it sees that flag.  If the remover has
+  already finished then the node is retired here instead.
+  */
+
+  if (isMarkSeen)
+    find(node->element, predecessors, successors);
+
+  const bool isRemoved((node->state.fetch_or(INSERTED, std::memory_order_acq_rel) &
+    REMOVED) != 0U);
+
+  if (isRemoved)
+  {
+    find(node->element, predecessors, successors);
+    retire(node);
+  }
+
+  leave(stripe, epoch);
+
+  if (isRemoved)
+    tryToReclaim();
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const bool DLockFreeSkipList<T, Compare>::find
+(
+  const T& element,                                   // the element to look for
+  Link*    (&predecessors)[MAX_HEIGHT],               // gets the links to the successors
+  Node*    (&successors)[MAX_HEIGHT]                  // gets the nodes where the search stops
+)
+noexcept
+
+/*
+This method finds where "element" goes on every level:  "successors[level]" gets the first
+unmarked node on that level that isn't less than "element" (or NULL) and "predecessors[level]"
+gets the link that points to it.  Marked nodes on the way are unlinked.  It returns true if
+"successors[0]" is equal to "element".
+
+The caller must have entered an epoch.
+*/
+
+{
+  bool isFound;
+
+  while (!tryFind(element, predecessors, successors, isFound))
+  {
+  }
+
+  return isFound;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const bool DLockFreeSkipList<T, Compare>::tryFind
+(
+  const T& element,                                   // the element to look for
+  Link*    (&predecessors)[MAX_HEIGHT],               // gets the links to the successors
+  Node*    (&successors)[MAX_HEIGHT],                 // gets the nodes where the search stops
+  bool&    isFound                                    // gets whether "element" was found
+)
+noexcept
+
+/*
+This method makes one attempt at "find()".  It returns false (and "find()" starts over from the
+head) if a marked node couldn't be unlinked because its predecessor changed -- most likely
+because the predecessor was marked itself.
+*/
+
+{
+  Link* predecessor(_head);
+  Node* current(NULL);
+
+  for (unsigned int level = MAX_HEIGHT; level-- > 0U; )
+  {
+    current = pointerOf(predecessor[level].load(std::memory_order_acquire));
+
+    while (current != NULL)
+    {
+      uintptr_t next(current->links()[level].load(std::memory_order_acquire));
+
+      if (isMarked(next))
+      {
+        uintptr_t expected((uintptr_t)current);
+
+        if (!predecessor[level].compare_exchange_strong(expected, next & ~MARK,
+          std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+          return false;
+        }
+
+        current = pointerOf(next);
+      }
+      else if (Compare()(current->element, element))
+      {
+        predecessor = current->links();
+        current     = pointerOf(next);
+      }
+      else
+        break;
+    }
+
+    predecessors[level] = &predecessor[level];
+    successors[level]   = current;
+  }
+
+  isFound = current != NULL && !Compare()(element, current->element);
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename DLockFreeSkipList<T, Compare>::Node *const
+DLockFreeSkipList<T, Compare>::lowerBoundNode
+(
+  const T& element                                              // the element to look for
+)
+const noexcept
+
+/*
+This method returns the first unmarked node on level 0 that isn't less than "element", or NULL.
+It's "find()" without the unlinking.  The caller must have entered an epoch.
+*/
+
+{
+  const Link* predecessor(_head);
+  Node*       current(NULL);
+
+  for (unsigned int level = MAX_HEIGHT; level-- > 0U; )
+  {
+    current = pointerOf(predecessor[level].load(std::memory_order_acquire));
+
+    while (current != NULL)
+    {
+      const uintptr_t next(current->links()[level].load(std::memory_order_acquire));
+
+      if (isMarked(next))
+        current = pointerOf(next);
+      else if (Compare()(current->element, element))
+      {
+        predecessor = current->links();
+        current     = pointerOf(next);
+      }
+      else
+        break;
+    }
+  }
+
+  return current;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+typename DLockFreeSkipList<T, Compare>::Node *const DLockFreeSkipList<T, Compare>::nextNode
+(
+  Node *const node                                              // the node to start from
+)
+const noexcept
+
+/*
+This method returns the next node after "node" on level 0 that isn't marked, or NULL.  "node"
+may be marked itself -- its frozen link still leads forward.  The caller must have entered an
+epoch.
+*/
+
+{
+  Node* next(pointerOf(node->links()[0].load(std::memory_order_acquire)));
+
+  while (next != NULL)
+  {
+    const uintptr_t link(next->links()[0].load(std::memory_order_acquire));
+
+    if (!isMarked(link))
+      break;
+
+    next = pointerOf(link);
+  }
+
+  return next;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> const unsigned int DLockFreeSkipList<T, Compare>::enter
+(
+  const unsigned int stripe                   // the calling thread's stripe
+)
+const noexcept
+
+/*
+This method enters the current epoch and returns it (modulo 3).  The count goes up before the
+epoch is checked again, so an epoch that's counted as entered can't be left behind without the
+reclaimer seeing the count.  If the epoch moved on in between then the count is moved with it.
+*/
+
+{
+  unsigned int epoch(_epoch.load(std::memory_order_seq_cst));
+
+  for (;;)
+  {
+    _stripes[stripe].numActive[epoch % 3U].fetch_add(1U, std::memory_order_seq_cst);
+
+    const unsigned int current(_epoch.load(std::memory_order_seq_cst));
+
+    if (current == epoch)
+      break;
+
+    _stripes[stripe].numActive[epoch % 3U].fetch_sub(1U, std::memory_order_release);
+    epoch = current;
+  }
+
+  return epoch % 3U;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void DLockFreeSkipList<T, Compare>::retire
+(
+  Node *const node                              // a node that's unlinked from every level
+)
+noexcept
+
+/*
+This method puts "node" onto the limbo list of the current epoch.  The caller must still be in
+its own epoch, so the list can't be freed while the node is being pushed onto it.
+*/
+
+{
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  std::atomic<Node*>& limbo = _retired[_epoch.load(std::memory_order_seq_cst) % 3U];
+
+  node->nextRetired = limbo.load(std::memory_order_relaxed);
+
+  while (!limbo.compare_exchange_weak(node->nextRetired, node, std::memory_order_release,
+    std::memory_order_relaxed))
+  {
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void DLockFreeSkipList<T, Compare>::tryToReclaim() noexcept
+
+/*
+Every "RECLAIM_INTERVAL" calls from a thread, this method advances the epoch from e to e + 1
+if nothing is left in epoch e - 1, and then frees the nodes retired in e - 1.  Only the thread
+whose compare-and-swap advances the epoch frees them.
+*/
+
+{
+  static thread_local unsigned int numCalls(0U);
+
+  if (++numCalls % RECLAIM_INTERVAL != 0U)
+    return;
+
+  unsigned int       epoch(_epoch.load(std::memory_order_seq_cst));
+  const unsigned int previous((epoch + 2U) % 3U);
+
+  for (unsigned int stripe = 0U; stripe < STRIPES; ++stripe)
+  {
+    if (_stripes[stripe].numActive[previous].load(std::memory_order_seq_cst) != 0U)
+      return;
+  }
+
+  if (_epoch.compare_exchange_strong(epoch, epoch + 1U, std::memory_order_seq_cst))
+    deleteChain(_retired[previous].exchange(NULL, std::memory_order_acquire));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> inline void DLockFreeSkipList<T, Compare>::adjustNumElements
+(
+  const int delta                                        // how much to change the count by
+)
+noexcept
+
+/*
+As in "DLockFreeStack", "_numElements" is only ever changed and read through an atomic
+reference (refer to "count()").
+*/
+
+{
+  count().fetch_add((unsigned int)delta, std::memory_order_relaxed);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void DLockFreeSkipList<T, Compare>::deleteNodes() noexcept
+
+/*
+This method frees every node -- the ones still in the set and the ones in limbo -- without
+going through "remove()".  Only the destructor and the constructors use it, when no other
+thread can be using the set.
+*/
+
+{
+  Node* node(pointerOf(_head[0].load(std::memory_order_acquire)));
+
+  while (node != NULL)
+  {
+    Node *const next = pointerOf(node->links()[0].load(std::memory_order_relaxed));
+
+    deleteNode(node);
+    node = next;
+  }
+
+  for (unsigned int level = 0U; level < MAX_HEIGHT; ++level)
+    _head[level].store(0U, std::memory_order_relaxed);
+
+  for (unsigned int epoch = 0U; epoch < 3U; ++epoch)
+    deleteChain(_retired[epoch].exchange(NULL, std::memory_order_acquire));
+
+  count().store(0U, std::memory_order_relaxed);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> template<class... Args>
+typename DLockFreeSkipList<T, Compare>::Node *const DLockFreeSkipList<T, Compare>::newNode
+(
+  const unsigned int height,                     // the no. of links that the node needs
+  Args&&...          arguments                   // the arguments to construct the element from
+)
+
+/*
+This function allocates a node with "height" links (all NULL) and constructs its element from
+"arguments".  "Full" is thrown if there's no memory for it and "OperationFailed" if the element
+couldn't be constructed.
+*/
+
+{
+  void *const memory = ::operator new(LINKS_OFFSET + height * sizeof(Link),
+    std::align_val_t(NODE_ALIGNMENT), std::nothrow);
+
+  if (memory == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  Node* node;
+
+  try
+  {
+    node = new(memory) Node(height, std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    ::operator delete(memory, std::align_val_t(NODE_ALIGNMENT));
+    throw OperationFailed("Unable to copy an element into a new node.", __FILE__, __LINE__);
+  }
+
+  for (unsigned int level = 0U; level < height; ++level)
+    new(&node->links()[level]) Link(0U);
+
+  return node;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void DLockFreeSkipList<T, Compare>::deleteNode
+(
+  Node *const node                              // a node that was created by "newNode()"
+)
+noexcept
+
+{
+  node->~Node();
+  ::operator delete(node, std::align_val_t(NODE_ALIGNMENT));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare> void DLockFreeSkipList<T, Compare>::deleteChain
+(
+  Node* node                                    // the first node on a limbo list, or NULL
+)
+noexcept
+
+{
+  while (node != NULL)
+  {
+    Node *const next = node->nextRetired;
+
+    deleteNode(node);
+    node = next;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+const unsigned int DLockFreeSkipList<T, Compare>::threadNumber() noexcept
+
+/*
+This function returns a number that's unique to the calling thread (until the numbers wrap).
+The threads are numbered in the order that they first call it.
+*/
+
+{
+  static std::atomic<unsigned int>    numThreads(0U);
+  static thread_local const unsigned int number(numThreads.fetch_add(1U,
+    std::memory_order_relaxed));
+
+  return number;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare>
+const unsigned int DLockFreeSkipList<T, Compare>::randomHeight() noexcept
+
+/*
+This function returns a random height from 1 to "MAX_HEIGHT":  1 with probability 3/4, 2 with
+probability 3/16 and so on.  Each thread has its own xorshift generator, seeded from its thread
+number.
+*/
+
+{
+  static thread_local unsigned int random((threadNumber() * 2654435769U) ^ 2463534242U);
+
+  if (random == 0U)
+    random = 2463534242U;
+
+  random ^= random << 13;
+  random ^= random >> 17;
+  random ^= random << 5;
+
+  unsigned int height(1U);
+
+  for (unsigned int bits = random; height < MAX_HEIGHT && (bits & 3U) == 0U; bits >>= 2)
+    ++height;
+
+  return height;
+}
+
+#endif
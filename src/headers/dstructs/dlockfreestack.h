@@ -0,0 +1,797 @@
+#ifndef DSTRUCTS_DLOCKFREESTACK_H
+#define DSTRUCTS_DLOCKFREESTACK_H
+
+// ============================================================================================
+//
+// dlockfreestack.h -- Implementation of a dynamic stack that several threads can push onto and
+// pop off of at the same time without any locks.
+//
+// ============================================================================================
+
+/*
+This class is a lock-free dynamic stack.  A "DLockFreeStack" is a "Stack".
+
+Any number of threads can call "push()", "emplace()", "pop()", "concatenate()" and "empty()" on
+the same "DLockFreeStack" at the same time.  None of them ever blocks:  each one is a short
+read-compute-compare-and-swap loop on the top of the stack, and a thread only has to go around
+the loop again if another thread changed the top in the meantime (so some thread always makes
+progress).
+
+The other methods -- "peek()", "iterator()", "begin()", "end()" and the copy operations that
+read a "DLockFreeStack" as a source -- read elements in place, so they must not be called while
+another thread may be popping elements off of (or emptying) the same stack.
+
+"numElements()" and "isEmpty()" can be called at any time, but they're only exact while no
+other thread is changing the stack; otherwise they give a snapshot of a count that pushes raise
+before their elements appear and pops lower after theirs are gone.  Called through a reference
+to a base class, as the copy operations of other structures do, they're the base class's
+ordinary reads of the count, so the same rule applies as for iterating.
+
+For iterations, the topmost element is the first element (as "Stack" requires).
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+This is a Treiber stack:  a singly-linked list of nodes whose head ("_top") is changed with a
+single compare-and-swap.  Pushing a node sets its "next" pointer to the current top and swaps
+the node in; popping reads the top node's "next" pointer and swaps it in.
+
+The classic problem with that is ABA:  thread 1 reads top node A and its successor B, thread 2
+pops A and B and pushes A again, and thread 1's compare-and-swap then succeeds (the top is A
+again) and installs B, which is no longer on the stack.  To prevent that, "_top" isn't a plain
+pointer -- it's a pointer packed together with a tag that's incremented on every change.  The
+compare-and-swap compares both, so a top that has been changed and changed back no longer
+matches.  On 64-bit platforms the pointer takes the low 48 bits (all that current x86-64 and
+AArch64 user-space addresses use) and the tag takes the other 16; on 32-bit platforms each gets
+32 bits.  Packing them into 64 bits keeps the compare-and-swap a single-word instruction.
+
+That has two limits.  First, a 16-bit tag wraps after 65,536 changes, so ABA is still possible
+if a thread is held up between reading the top and its compare-and-swap for a multiple of
+65,536 changes that leave the same node back on top.  Second, an address above 48 bits (which
+x86-64's 5-level paging allows, though Linux only hands such addresses to programs that ask for
+them) can't be packed, so "allocateNode()" checks every new node's address and throws
+"OperationFailed" rather than truncate it.  A double-width compare-and-swap would lift both
+limits, but it isn't lock-free on every compiler and platform that a 64-bit one is.
+
+The other problem is reclamation:  thread 1 may still be about to read A's "next" pointer when
+thread 2 pops A.  If thread 2 returned A to the heap then thread 1 would read freed memory.
+Therefore popped nodes are never returned to the heap while the stack exists.  They go onto a
+free list ("_free") -- itself a tagged Treiber stack -- and are reused by later pushes.  A
+stale read of a reused node's "next" pointer is harmless (it's an atomic read of live memory)
+and the tag makes the compare-and-swap that follows it fail.  All of the nodes are returned to
+the heap when the stack is destroyed, so the stack's memory use is the high-water mark of its
+size.
+
+The element count is "DataStructure_::_numElements", which knows nothing about threads, so
+this class only ever changes it through a "std::atomic_ref" and hides "numElements()" and
+"isEmpty()" with versions that read it the same way.
+
+An element is only touched by a thread that owns its node exclusively -- the pusher before the
+compare-and-swap that publishes the node, and the popper after the compare-and-swap that
+unlinks it -- so elements need no synchronization of their own.
+
+"_top" and "_free" are each kept on their own cache line so that pushes and pops don't
+invalidate the free list's line (and vice versa) more often than they have to.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include <dstructs/stack.h>
+
+// ============================================================================================
+// DLOCKFREESTACK<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class DLockFreeStack:
+  virtual public DataStructureExceptions,
+  virtual public Stack<T>
+{
+  private:
+    struct Node
+    {
+      std::atomic<Node*> next;                  // the node below this one, or NULL
+      alignas(T) unsigned char storage[sizeof(T)];      // raw storage for the element
+
+      T *const element() noexcept
+                 {return reinterpret_cast<T*>(storage);}
+    };
+
+  public:
+                       DLockFreeStack() noexcept;
+                       DLockFreeStack(const DLockFreeStack<T>&);
+                       DLockFreeStack(const DataStructure<T>&);
+    virtual            ~DLockFreeStack();
+
+    DLockFreeStack<T>& operator=(const DataStructure<T>&);
+    DLockFreeStack<T>& operator+=(const DataStructure<T>&);
+
+    // Element iterators (not safe while other threads are popping)
+
+    template<class Element> class NodeIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                      NodeIterator(Node *const node = NULL) noexcept:
+                        _node(node) {return;}
+                      NodeIterator(const NodeIterator<T>& source) noexcept:
+                        _node(source._node) {return;}
+
+        Element&      operator*() const noexcept
+                        {return *_node->element();}
+        Element*      operator->() const noexcept
+                        {return _node->element();}
+        NodeIterator& operator++() noexcept
+                        {_node = _node->next.load(std::memory_order_relaxed); return *this;}
+        NodeIterator  operator++(int) noexcept
+                        {const NodeIterator old(*this); operator++(); return old;}
+
+        const bool    operator==(const NodeIterator& rhs) const noexcept
+                        {return _node == rhs._node;}
+        const bool    operator!=(const NodeIterator& rhs) const noexcept
+                        {return _node != rhs._node;}
+
+      private:
+        Node* _node;                        // the current node, or NULL past the last element
+
+        friend class NodeIterator<const T>;
+    };
+
+    typedef NodeIterator<T>       ElementIterator;
+    typedef NodeIterator<const T> ConstElementIterator;
+
+    ElementIterator      begin() noexcept
+                           {return ElementIterator(topNode());}
+    ElementIterator      end() noexcept
+                           {return ElementIterator();}
+    ConstElementIterator begin() const noexcept
+                           {return ConstElementIterator(topNode());}
+    ConstElementIterator end() const noexcept
+                           {return ConstElementIterator();}
+
+    // DataStructure<T> methods
+
+    const unsigned int   numElements() const noexcept
+                           {return count().load(std::memory_order_relaxed);}
+    const bool           isEmpty() const noexcept
+                           {return numElements() == 0U;}
+
+    virtual void         empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                           {return DataStructure<T>::newIterator(*this);}
+
+    // LinearStructure<T> methods
+
+    virtual void         concatenate(const DataStructure<T>&);
+
+    // Stack<T> methods
+
+    virtual void         push(const T&);
+    virtual void         push(T&&);
+    virtual void         pop(T&);
+    virtual void         peek(T&) const;
+
+    template<class... Args>
+    void                 emplace(Args&&...);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void       assertInvariants() const noexcept;
+    #endif
+
+  private:
+    typedef uint64_t TaggedPointer;        // a "Node*" in the low bits, a tag in the high bits
+
+    static_assert(sizeof(void*) <= sizeof(TaggedPointer), "A pointer must fit in 64 bits.");
+
+    static const unsigned int  POINTER_BITS = sizeof(void*) < 8U ? 32U : 48U;
+    static const TaggedPointer POINTER_MASK = ((TaggedPointer)1U << POINTER_BITS) - 1U;
+    static const size_t        CACHE_LINE_SIZE = 64U;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<TaggedPointer> _top;     // the topmost node
+    alignas(CACHE_LINE_SIZE) std::atomic<TaggedPointer> _free;    // nodes kept for reuse
+
+    Node *const          topNode() const noexcept
+                           {return pointerOf(_top.load(std::memory_order_acquire));}
+    Node *const          allocateNode();
+    void                 releaseNode(Node *const node) noexcept
+                           {pushChain(_free, node, node); return;}
+    void                 adjustNumElements(const int) noexcept;
+
+    std::atomic_ref<unsigned int> count() const noexcept
+                           {
+                             return std::atomic_ref<unsigned int>(
+                               const_cast<unsigned int&>(this->_numElements));
+                           }
+
+    static void          pushChain(std::atomic<TaggedPointer>&, Node *const, Node *const)
+                           noexcept;
+    static Node *const   popNode(std::atomic<TaggedPointer>&) noexcept;
+
+    static Node *const   pointerOf(const TaggedPointer tagged) noexcept
+                           {return reinterpret_cast<Node*>((uintptr_t)(tagged &
+                             POINTER_MASK));}
+    static const TaggedPointer retag(Node *const node, const TaggedPointer previous) noexcept
+                           {
+                             return (((previous >> POINTER_BITS) + 1U) << POINTER_BITS) |
+                               (TaggedPointer)(uintptr_t)node;
+                           }
+};
+
+// ============================================================================================
+// DLOCKFREESTACK<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> DLockFreeStack<T>::DLockFreeStack() noexcept:
+  _top(0U),
+  _free(0U)
+
+/*
+This constructor instanciates an empty stack.  No nodes are allocated until the first element
+is pushed.
+*/
+
+{
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DLockFreeStack<T>::DLockFreeStack
+(
+  const DLockFreeStack<T>& source                       // the stack to copy
+):
+  _top(0U),
+  _free(0U)
+
+/*
+This constructor makes a deep copy of "source".  No other thread may be popping elements off of
+"source" while it's being copied.
+*/
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DLockFreeStack<T>::DLockFreeStack
+(
+  const DataStructure<T>& source                  // the data structure to copy the elements of
+):
+  _top(0U),
+  _free(0U)
+
+/*
+This constructor instanciates a stack and copies the contents of "source" to it.  Refer to
+"concatenate()" for the order that the elements end up in.
+*/
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DLockFreeStack<T>::~DLockFreeStack()
+
+/*
+This destructor destroys every element and returns every node -- including the ones on the
+free list -- to the heap.  No other thread may be using the stack by now.
+*/
+
+{
+  empty();
+
+  Node* node(pointerOf(_free.load(std::memory_order_acquire)));
+
+  while (node != NULL)
+  {
+    Node *const next = node->next.load(std::memory_order_relaxed);
+
+    node->~Node();
+    ::operator delete(node, std::align_val_t(alignof(Node)));
+    node = next;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DLockFreeStack<T>& DLockFreeStack<T>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+Unlike the other methods that change the stack, this one isn't a single atomic step -- other
+threads may push elements between the "empty()" and the "concatenate()".
+*/
+
+{
+  empty();
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> DLockFreeStack<T>& DLockFreeStack<T>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DLockFreeStack<T>::empty() noexcept
+
+/*
+This method removes every element from the stack.  The whole chain of nodes is unlinked with a
+single compare-and-swap, so elements pushed by other threads at the same time either end up
+on the emptied stack or in the chain being destroyed -- never half-way.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+Every element that was on the stack when the chain was unlinked has been destroyed.
+*/
+
+{
+  TaggedPointer oldTop(_top.load(std::memory_order_acquire));
+
+  while (!_top.compare_exchange_weak(oldTop, retag(NULL, oldTop), std::memory_order_acquire,
+    std::memory_order_acquire))
+  {
+  }
+
+  Node *const first = pointerOf(oldTop);
+
+  if (first != NULL)
+  {
+    Node*        last(first);
+    unsigned int numRemoved(1U);
+
+    for (;;)
+    {
+      last->element()->~T();
+
+      Node *const next = last->next.load(std::memory_order_relaxed);
+
+      if (next == NULL)
+        break;
+
+      last = next;
+      ++numRemoved;
+    }
+
+    adjustNumElements(-(int)numRemoved);
+    pushChain(_free, first, last);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DLockFreeStack<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method pushes copies of "source's" elements onto the stack.  As with "SStack", the first
+element in "source's" iteration order will be the first element to be popped off of the stack.
+
+The copies are linked into a private chain first and then the whole chain is pushed with a
+single compare-and-swap, so other threads see either none of the new elements or all of them.
+If an exception is thrown then the stack is left as it was.
+
+PRECONDITIONS:
+"source" must not be changing while it's being copied.
+
+POSTCONDITIONS:
+"source's" elements are on top of the stack's original elements.
+*/
+
+{
+  Node*        first(NULL);
+  Node*        last(NULL);
+  unsigned int numCopied(0U);
+
+  try
+  {
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+    for (; i->more(); i->next())
+    {
+      Node *const node = allocateNode();
+
+      try
+      {
+        new(node->storage) T(*i->current());
+      }
+      catch (...)
+      {
+        releaseNode(node);
+        throw;
+      }
+
+      node->next.store(NULL, std::memory_order_relaxed);
+
+      if (last == NULL)
+        first = node;
+      else
+        last->next.store(node, std::memory_order_relaxed);
+
+      last = node;
+      ++numCopied;
+    }
+  }
+  catch (const Full&)
+  {
+    if (first != NULL)
+    {
+      for (Node* node = first; node != NULL; node = node->next.load(std::memory_order_relaxed))
+        node->element()->~T();
+
+      pushChain(_free, first, last);
+    }
+
+    throw;
+  }
+  catch (...)
+  {
+    if (first != NULL)
+    {
+      for (Node* node = first; node != NULL; node = node->next.load(std::memory_order_relaxed))
+        node->element()->~T();
+
+      pushChain(_free, first, last);
+    }
+
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  if (first != NULL)
+  {
+    adjustNumElements((int)numCopied);
+    pushChain(_top, first, last);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DLockFreeStack<T>::push
+(
+  const T& elementToPush                               // the element to be placed on the stack
+)
+
+/*
+This method pushes a copy of "elementToPush" onto the stack.
+
+PRECONDITIONS:
+There must be enough memory for a new node (unless there's one on the free list).
+
+POSTCONDITIONS:
+The copy of "elementToPush" will be added at the top of the stack.
+*/
+
+{
+  emplace(elementToPush);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DLockFreeStack<T>::push
+(
+  T&& elementToPush                                 // the element to be moved onto the stack
+)
+
+/*
+This method moves "elementToPush" onto the stack.  Otherwise, it's the same as the other
+"push()".
+*/
+
+{
+  emplace(std::move(elementToPush));
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void DLockFreeStack<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" directly in a node and pushes it onto
+the stack.  The element is constructed before the node is published, so no other thread can
+see a half-constructed element.
+
+PRECONDITIONS:
+There must be enough memory for a new node (unless there's one on the free list).
+
+POSTCONDITIONS:
+The new element will be at the top of the stack (until another thread pushes another one).
+*/
+
+{
+  Node *const node = allocateNode();
+
+  try
+  {
+    new(node->storage) T(std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    releaseNode(node);
+    throw OperationFailed("Unable to construct an element on a DLockFreeStack.", __FILE__,
+      __LINE__);
+  }
+
+  /*
+  The count goes up before the node is published and down after a node is unlinked, so it's
+  never lower than the number of elements that other threads can pop.
+  */
+
+  adjustNumElements(1);
+  pushChain(_top, node, node);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DLockFreeStack<T>::pop
+(
+  T& poppedElement                                // the variable to receive the popped element
+)
+
+/*
+This method pops the topmost element off of the stack and moves it to "poppedElement" (refer to
+"LinearStructure<T>::moveElement()").
+
+If moving (or copying) the element throws then the element is pushed back onto the stack --
+though, if other threads are pushing at the same time, not necessarily back on top.
+
+PRECONDITIONS:
+The stack cannot be empty.
+
+POSTCONDITIONS:
+The element that was on top of the stack is moved to "poppedElement" and removed from the
+stack.
+*/
+
+{
+  Node *const node = popNode(_top);
+
+  if (node == NULL)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    this->moveElement(poppedElement, *node->element());
+  }
+  catch (...)
+  {
+    pushChain(_top, node, node);
+    throw OperationFailed("Unable to remove an element from a DLockFreeStack.", __FILE__,
+      __LINE__);
+  }
+
+  node->element()->~T();
+  releaseNode(node);
+  adjustNumElements(-1);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DLockFreeStack<T>::peek
+(
+  T& elementToBePopped                 // the variable to receive the next element to be popped
+)
+const
+
+/*
+This method copies the topmost element to "elementToBePopped" without popping it off.
+
+PRECONDITIONS:
+The stack cannot be empty, and no other thread may be popping elements off of it (the element
+is copied in place).
+
+POSTCONDITIONS:
+The topmost element is copied to "elementToBePopped".
+*/
+
+{
+  Node *const node = topNode();
+
+  if (node == NULL)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    elementToBePopped = *node->element();
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to copy an element from a DLockFreeStack.", __FILE__,
+      __LINE__);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void DLockFreeStack<T>::assertInvariants() const noexcept
+
+  /*
+  Nothing can be asserted about the chain or the count while other threads may be changing
+  them, so only the node pointers' packing is checked.
+  */
+
+  {
+    const Node *const node = pointerOf(_top.load(std::memory_order_relaxed));
+
+    assert(((uintptr_t)node & (alignof(Node) - 1U)) == 0U);
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> typename DLockFreeStack<T>::Node *const DLockFreeStack<T>::allocateNode()
+
+/*
+This method returns an unlinked node with unconstructed element storage.  A node from the free
+list is reused if there is one; otherwise a new node is allocated from the heap.
+*/
+
+{
+  Node* node(popNode(_free));
+
+  if (node == NULL)
+  {
+    void *const memory = ::operator new(sizeof(Node), std::align_val_t(alignof(Node)),
+      std::nothrow);
+
+    if (memory == NULL)
+      throw Full(__FILE__, __LINE__);
+
+    /*
+    A node's address has to fit in the pointer bits of a "TaggedPointer" (refer to the design
+    notes).
+    */
+
+    if (((uintptr_t)memory & ~(uintptr_t)POINTER_MASK) != 0U)
+    {
+      ::operator delete(memory, std::align_val_t(alignof(Node)));
+      throw OperationFailed("A node's address doesn't fit in a tagged pointer.", __FILE__,
+        __LINE__);
+    }
+
+    node = new(memory) Node;
+  }
+
+  return node;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline void DLockFreeStack<T>::adjustNumElements
+(
+  const int delta                                        // how much to change the count by
+)
+noexcept
+
+/*
+"_numElements" belongs to "DataStructure_", which knows nothing about threads, so it's changed
+through an atomic reference (refer to "count()").
+*/
+
+{
+  count().fetch_add((unsigned int)delta, std::memory_order_relaxed);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DLockFreeStack<T>::pushChain
+(
+  std::atomic<TaggedPointer>& list,                   // the list to push onto ("_top"/"_free")
+  Node *const                 first,                  // the first node in the chain
+  Node *const                 last                    // the last node in the chain
+)
+noexcept
+
+/*
+This function pushes the chain of nodes from "first" to "last" onto "list" with a single
+compare-and-swap.  The release ordering publishes the nodes (and their elements) to whichever
+thread pops them.
+*/
+
+{
+  TaggedPointer oldTop(list.load(std::memory_order_relaxed));
+
+  do
+    last->next.store(pointerOf(oldTop), std::memory_order_relaxed);
+  while (!list.compare_exchange_weak(oldTop, retag(first, oldTop), std::memory_order_release,
+    std::memory_order_relaxed));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> typename DLockFreeStack<T>::Node *const DLockFreeStack<T>::popNode
+(
+  std::atomic<TaggedPointer>& list                   // the list to pop from ("_top"/"_free")
+)
+noexcept
+
+/*
+This function unlinks the first node from "list" and returns it, or returns NULL if "list" is
+empty.
+
+"next" may be read from a node that another thread has already popped (and even reused); that
+read is safe because nodes are never freed while the stack exists, and the tag makes the
+compare-and-swap fail so that the stale value is never installed.
+*/
+
+{
+  TaggedPointer oldTop(list.load(std::memory_order_acquire));
+  Node*         node;
+
+  do
+  {
+    node = pointerOf(oldTop);
+
+    if (node == NULL)
+      break;
+  }
+  while (!list.compare_exchange_weak(oldTop, retag(node->next.load(std::memory_order_relaxed),
+    oldTop), std::memory_order_acquire, std::memory_order_acquire));
+
+  return node;
+}
+
+#endif
@@ -0,0 +1,951 @@
+#ifndef DSTRUCTS_DMULTILINKEDLIST_H
+#define DSTRUCTS_DMULTILINKEDLIST_H
+
+// ============================================================================================
+//
+// dmultilinkedlist.h -- Dynamic Multi-Linked List Template Class
+//
+// ============================================================================================
+
+/*
+This class is a multi-linked list:  one set of elements threaded onto "N" doubly-linked
+"chains", each of which keeps the elements in an order of its own.  A "DMultiLinkedList" is a
+"LinearStructure".
+
+Each element is stored once, in a node with a pair of links for each chain, so keeping the
+same records in (say) arrival order and in key order costs one copy of each record rather than
+one per order:
+
+  enum {BY_ARRIVAL, BY_KEY};
+
+  DMultiLinkedList<Order, 2U> orders;
+
+  orders.pushBack(order);                           // at the back of both chains
+  orders.sort(BY_KEY, OrderKeyLess());
+
+  for (DMultiLinkedList<Order, 2U>::ElementIterator i = orders.begin(BY_KEY);
+    i != orders.end(BY_KEY); ++i)
+    ...
+
+Adding an element links it into every chain and removing one unlinks it from every chain, each
+in one operation.  "insert()" and "emplace()" take a position in each chain to add the new
+element before.  Once an element is in the list, it can be moved around within any one chain
+("moveBefore()", "moveToFront()", "moveToBack()") or a whole chain can be sorted ("sort()")
+without disturbing the others.
+
+An element iterator walks one chain (forwards or backwards), but it can be switched to any
+other chain at the same element with "in()" -- so an element that's found by walking one
+order can be removed, or its neighbours looked at, in another.  As with "DDoublyLinkedList",
+adding or moving elements never invalidates an iterator and removing an element only
+invalidates iterators to that element.
+
+The "DataStructure" iteration ("iterator()", "begin()", "end()", "==" and copying to other
+structures) follows chain 0.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+Each chain is circular around a sentinel link, as in "DDoublyLinkedList".  The list object
+holds "N" sentinels and each node holds "N" links, in a "LinkSet" that's the node's (first and
+only) base class, followed by the element:
+
+  Node:  | chain 0 links | chain 1 links | ... | chain N-1 links | element |
+
+A link in chain "c" is therefore "c" links past the start of its node's "LinkSet", so an
+iterator only needs its link and its chain no. to get at the element, and switching chains is
+pointer arithmetic.  Nothing else is stored per node:  a node takes "N" pairs of pointers
+plus the element, where "N" separate lists would take "N" nodes and "N" copies of the element.
+
+Nodes come from a "NodePool", as in the other dynamic structures.
+
+Copying a "DMultiLinkedList" to another one keeps every chain's order.  The new nodes are made
+in chain 0's order, and then each of the other chains is threaded by looking up where each of
+its source nodes was copied to (in a table sorted by address).  That takes O(N n log n) time.
+
+"sort()" is a bottom-up merge sort of one chain (as "std::list::sort()" does it).  It relinks
+nodes rather than moving elements, it's stable and it doesn't touch the other chains.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <sdp.h>
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/linearst.h>
+#else
+  #include <dstructs/linearstructure.h>
+#endif
+
+#include <dstructs/nodepool.h>
+
+// ============================================================================================
+// DMULTILINKEDLIST<T, N> CLASS DECLARATION
+// ============================================================================================
+
+template<class T, unsigned int N> class DMultiLinkedList:
+  virtual public DataStructureExceptions,
+  virtual public LinearStructure<T>
+{
+  static_assert(N > 0U, "A DMultiLinkedList needs at least one chain.");
+
+  protected:
+    struct Link
+    {
+      Link* previous;
+      Link* next;
+    };
+
+    struct LinkSet
+    {
+      Link links[N];                                           // one pair for each chain
+    };
+
+    class Node:
+      public LinkSet
+    {
+      public:
+        T element;
+
+        template<class... Args>
+        Node(Args&&... arguments):
+          element(std::forward<Args>(arguments)...) {return;}
+    };
+
+    static Node *const nodeOf(Link *const link, const unsigned int chain) noexcept
+                         {return static_cast<Node*>(reinterpret_cast<LinkSet*>(link - chain));}
+
+  public:
+
+    // Element iterators
+
+    /*
+    "ElementIterator" and "ConstElementIterator" are standard bidirectional iterators over one
+    chain.  An "ElementIterator" converts to a "ConstElementIterator", so either can be passed
+    as a position.
+    */
+
+    template<class Element> class LinkIterator
+    {
+      public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T                               value_type;
+        typedef ptrdiff_t                       difference_type;
+        typedef Element*                        pointer;
+        typedef Element&                        reference;
+
+                      LinkIterator(Link *const link = NULL, const unsigned int chain = 0U)
+                        noexcept:
+                        _link(link), _chain(chain) {return;}
+                      LinkIterator(const LinkIterator<T>& source) noexcept:
+                        _link(source._link), _chain(source._chain) {return;}
+
+        Element&      operator*() const noexcept
+                        {return nodeOf(_link, _chain)->element;}
+        Element*      operator->() const noexcept
+                        {return &nodeOf(_link, _chain)->element;}
+        LinkIterator& operator++() noexcept
+                        {_link = _link->next; return *this;}
+        LinkIterator  operator++(int) noexcept
+                        {const LinkIterator old(*this); _link = _link->next; return old;}
+        LinkIterator& operator--() noexcept
+                        {_link = _link->previous; return *this;}
+        LinkIterator  operator--(int) noexcept
+                        {const LinkIterator old(*this); _link = _link->previous; return old;}
+
+        const bool    operator==(const LinkIterator& rhs) const noexcept
+                        {return _link == rhs._link;}
+        const bool    operator!=(const LinkIterator& rhs) const noexcept
+                        {return _link != rhs._link;}
+
+        const unsigned int chain() const noexcept
+                        {return _chain;}
+        LinkIterator  in(const unsigned int chain) const noexcept
+                        {return LinkIterator(_link - _chain + chain, chain);}
+
+      private:
+        Link*        _link;                       // the current node's link, or a sentinel
+        unsigned int _chain;                      // the chain that's being walked
+
+        friend class LinkIterator<const T>;
+        friend class DMultiLinkedList<T, N>;
+    };
+
+    typedef LinkIterator<T>       ElementIterator;
+    typedef LinkIterator<const T> ConstElementIterator;
+
+                             DMultiLinkedList() noexcept;
+                             DMultiLinkedList(const DMultiLinkedList<T, N>&);
+                             DMultiLinkedList(const DataStructure<T>&);
+    virtual                  ~DMultiLinkedList()
+                               {empty(); return;}
+
+    DMultiLinkedList<T, N>&  operator=(const DMultiLinkedList<T, N>&);
+    DMultiLinkedList<T, N>&  operator=(const DataStructure<T>&);
+    DMultiLinkedList<T, N>&  operator+=(const DataStructure<T>&);
+
+    ElementIterator          begin(const unsigned int chain = 0U) noexcept
+                               {return ElementIterator(_sentinels[chain].next, chain);}
+    ElementIterator          end(const unsigned int chain = 0U) noexcept
+                               {return ElementIterator(&_sentinels[chain], chain);}
+    ConstElementIterator     begin(const unsigned int chain = 0U) const noexcept
+                               {return ConstElementIterator(_sentinels[chain].next, chain);}
+    ConstElementIterator     end(const unsigned int chain = 0U) const noexcept
+                               {return ConstElementIterator(const_cast<Link*>(
+                                 &_sentinels[chain]), chain);}
+
+    // Adding & removing elements
+
+    void                     pushFront(const T& element)
+                               {emplaceAtEnds(true, element); return;}
+    void                     pushFront(T&& element)
+                               {emplaceAtEnds(true, std::move(element)); return;}
+    void                     pushBack(const T& element)
+                               {emplaceAtEnds(false, element); return;}
+    void                     pushBack(T&& element)
+                               {emplaceAtEnds(false, std::move(element)); return;}
+
+    ElementIterator          insert(const ConstElementIterator (&positions)[N],
+                               const T& element)
+                               {return emplace(positions, element);}
+    ElementIterator          insert(const ConstElementIterator (&positions)[N], T&& element)
+                               {return emplace(positions, std::move(element));}
+
+    template<class... Args>
+    ElementIterator          emplace(const ConstElementIterator (&)[N], Args&&...);
+
+    void                     remove(const ConstElementIterator) noexcept;
+
+    // Reordering one chain
+
+    void                     moveBefore(const ConstElementIterator, const ConstElementIterator)
+                               noexcept;
+    void                     moveToFront(const ConstElementIterator element) noexcept
+                               {moveBefore(begin(element._chain), element); return;}
+    void                     moveToBack(const ConstElementIterator element) noexcept
+                               {moveBefore(end(element._chain), element); return;}
+
+    template<class Compare>
+    void                     sort(const unsigned int, Compare) noexcept;
+
+    // Node pool
+
+    const unsigned int       nodesPerChunk() const noexcept
+                               {return _pool.slotsPerChunk();}
+    void                     setNodesPerChunk(const unsigned int);
+
+    // DataStructure<T> methods
+
+    virtual void             empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                               {return DataStructure<T>::newIterator(*this);}
+
+    // LinearStructure<T> methods
+
+    virtual void             concatenate(const DataStructure<T>&);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void           assertInvariants() const noexcept;
+    #endif
+
+  private:
+    Link                     _sentinels[N];          // the links to each chain's first & last
+    NodePool                 _pool;                  // the pool that the nodes come from
+
+    template<class... Args>
+    void                     emplaceAtEnds(const bool, Args&&...);
+    template<class... Args>
+    Node *const              newNode(Args&&...);
+    void                     deleteNode(Node *const) noexcept;
+    void                     copyChains(const DMultiLinkedList<T, N>&);
+    void                     initSentinels() noexcept;
+
+    static void              linkBefore(Link *const, Link *const) noexcept;
+    static void              unlink(Link *const) noexcept;
+
+    template<class Compare>
+    static Link *const       merge(Link*, Link*, const unsigned int, Compare&) noexcept;
+};
+
+// ============================================================================================
+// DMULTILINKEDLIST<T, N> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> DMultiLinkedList<T, N>::DMultiLinkedList() noexcept:
+
+/*
+This constructor instanciates an empty list.
+*/
+
+  _pool(sizeof(Node), alignof(Node))
+
+{
+  initSentinels();
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> DMultiLinkedList<T, N>::DMultiLinkedList
+(
+  const DMultiLinkedList<T, N>& source                 // the list to copy
+):
+
+/*
+This constructor makes a deep copy of "source", with every chain in the same order as in
+"source".  The copy gets its own (empty) pool with the same no. of nodes per chunk as
+"source's" pool.
+*/
+
+  _pool(source._pool)
+
+{
+  initSentinels();
+  copyChains(source);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> DMultiLinkedList<T, N>::DMultiLinkedList
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+):
+
+/*
+This constructor instanciates a list that holds copies of "source's" elements.  Every chain
+has them in "source's" iterative order.
+*/
+
+  _pool(sizeof(Node), alignof(Node))
+
+{
+  initSentinels();
+
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> DMultiLinkedList<T, N>& DMultiLinkedList<T, N>::operator=
+(
+  const DMultiLinkedList<T, N>& source                 // the list to copy
+)
+
+/*
+This operator replaces this list's elements with copies of "source's", with every chain in the
+same order as in "source".  If an exception is thrown then the list is left empty.
+*/
+
+{
+  if (&source != this)
+  {
+    empty();
+    copyChains(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> DMultiLinkedList<T, N>& DMultiLinkedList<T, N>::operator=
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> DMultiLinkedList<T, N>& DMultiLinkedList<T, N>::operator+=
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> template<class... Args>
+typename DMultiLinkedList<T, N>::ElementIterator DMultiLinkedList<T, N>::emplace
+(
+  const ConstElementIterator (&positions)[N],  // the element to add before, in each chain
+  Args&&...                  arguments         // the arguments to construct the element from
+)
+
+/*
+This method constructs a new element in place from "arguments" (refer to
+"DDoublyLinkedList<T>::emplace()") and links it into each chain "c" before "positions[c]"
+("end(c)" puts it at the back of that chain).  It returns an iterator at the new element in
+chain 0.
+
+"Full" is thrown if no memory could be allocated for the node.  "OperationFailed" is thrown if
+the element couldn't be constructed.  The list is unchanged in either case.
+
+PRECONDITIONS:
+"positions[c]" must be an iterator over chain "c".
+*/
+
+{
+  Node *const node = newNode(std::forward<Args>(arguments)...);
+
+  for (unsigned int chain = 0U; chain < N; ++chain)
+  {
+    assert(positions[chain]._chain == chain);
+
+    linkBefore(positions[chain]._link, &node->links[chain]);
+  }
+
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return ElementIterator(&node->links[0], 0U);
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::remove
+(
+  const ConstElementIterator element           // the element to remove (in any chain)
+)
+noexcept
+
+/*
+This method unlinks "element" from every chain and destroys it.
+
+PRECONDITIONS:
+"element" must be at an element of this list (not at an "end()").
+*/
+
+{
+  assert(element._link != &_sentinels[element._chain]);
+
+  Node *const node = nodeOf(element._link, element._chain);
+
+  for (unsigned int chain = 0U; chain < N; ++chain)
+    unlink(&node->links[chain]);
+
+  deleteNode(node);
+  --this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::moveBefore
+(
+  const ConstElementIterator position,         // the element to move the other before
+  const ConstElementIterator element           // the element to move
+)
+noexcept
+
+/*
+This method moves "element" to before "position" in their chain ("end()" moves it to the
+back).  The other chains aren't touched.
+
+PRECONDITIONS:
+"position" and "element" must be iterators over the same chain, and "element" mustn't be at an
+"end()".
+*/
+
+{
+  assert(position._chain == element._chain);
+  assert(element._link != &_sentinels[element._chain]);
+
+  if (position._link != element._link && position._link != element._link->next)
+  {
+    unlink(element._link);
+    linkBefore(position._link, element._link);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> template<class Compare> void DMultiLinkedList<T, N>::sort
+(
+  const unsigned int chain,                 // the chain to sort
+  Compare            isLess                 // tells whether one element is less than another
+)
+noexcept
+
+/*
+This method sorts the elements of "chain" into ascending order, as "isLess" (a function or
+function object called with two "const T&") defines it.  Equal elements keep their order.  The
+other chains aren't touched.
+
+The chain is opened up into a NULL-terminated list along its next links, which is merged
+bottom-up:  "runs[i]" holds a sorted run of 2^i nodes (or none), and each node is merged into
+the runs the way 1 is added to a binary number.  The previous links are set afterwards.
+*/
+
+{
+  assert(chain < N);
+
+  Link *const  sentinel = &_sentinels[chain];
+  Link*        runs[sizeof(unsigned int) * 8U + 1U] = {NULL};
+  unsigned int numRuns(0U);
+
+  if (this->_numElements < 2U)
+    return;
+
+  sentinel->previous->next = NULL;
+
+  for (Link* link = sentinel->next; link != NULL; )
+  {
+    Link*        carry = link;
+    unsigned int i(0U);
+
+    link        = link->next;
+    carry->next = NULL;
+
+    for (; i < numRuns && runs[i] != NULL; ++i)
+    {
+      carry   = merge(runs[i], carry, chain, isLess);
+      runs[i] = NULL;
+    }
+
+    runs[i] = carry;
+
+    if (i == numRuns)
+      ++numRuns;
+  }
+
+  Link* sorted(NULL);
+
+  for (unsigned int i = 0U; i < numRuns; ++i)
+  {
+    if (runs[i] != NULL)
+      sorted = sorted == NULL ? runs[i] : merge(runs[i], sorted, chain, isLess);
+  }
+
+  // Close the chain back up and set the previous links.
+
+  Link* previous(sentinel);
+
+  for (Link* link = sorted; link != NULL; link = link->next)
+  {
+    previous->next = link;
+    link->previous = previous;
+    previous       = link;
+  }
+
+  previous->next     = sentinel;
+  sentinel->previous = previous;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::setNodesPerChunk
+(
+  const unsigned int nodesPerChunk      // no. of nodes to allocate from the heap at a time
+)
+
+/*
+This method changes how many nodes this list's pool allocates from the heap at a time.  0 turns
+pooling off, so that every node is allocated from and returned to the heap individually.
+
+Any memory that the pool is holding onto is returned to the heap.
+
+PRECONDITIONS:
+The list must be empty.
+
+POSTCONDITIONS:
+Nodes will be allocated "nodesPerChunk" at a time.
+*/
+
+{
+  if (this->_numElements > 0U)
+  {
+    throw OperationFailed("The node pool of a non-empty DMultiLinkedList can't be changed.",
+      __FILE__, __LINE__);
+  }
+
+  _pool.reset(nodesPerChunk);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::empty() noexcept
+
+/*
+This method removes every element.
+*/
+
+{
+  for (Link* link = _sentinels[0].next; link != &_sentinels[0]; )
+  {
+    Link *const next = link->next;
+
+    deleteNode(nodeOf(link, 0U));
+    link = next;
+  }
+
+  initSentinels();
+  this->_numElements = 0U;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method adds copies of "source's" elements to the back of every chain, in "source's"
+iterative order.  "source" can be this list, in which case its elements are added once (in
+chain 0's order).
+
+If an exception is thrown then the elements that were added before it stay in the list.
+*/
+
+{
+  bool           isReversed;
+  const T *const block = source.contiguousElements(isReversed);
+
+  if (block != NULL)
+  {
+    const unsigned int count(source.numElements());
+
+    for (unsigned int i = 0U; i < count; ++i)
+      emplaceAtEnds(false, block[isReversed ? count - 1U - i : i]);
+  }
+  else if (&source == this)
+  {
+    const unsigned int   count(this->_numElements);
+    ConstElementIterator element(begin());
+
+    for (unsigned int i = 0U; i < count; ++i, ++element)
+      emplaceAtEnds(false, *element);
+  }
+  else
+  {
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+    for (; i->more(); i->next())
+      emplaceAtEnds(false, *i->current());
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T, unsigned int N> void DMultiLinkedList<T, N>::assertInvariants() const
+    noexcept
+
+  {
+    for (unsigned int chain = 0U; chain < N; ++chain)
+    {
+      const Link& sentinel = _sentinels[chain];
+
+      assert(sentinel.next->previous == &sentinel);
+      assert(sentinel.previous->next == &sentinel);
+      assert((this->_numElements == 0U) == (sentinel.next == &sentinel));
+    }
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> template<class... Args>
+void DMultiLinkedList<T, N>::emplaceAtEnds
+(
+  const bool atFront,                         // true for the front of each chain, or the back
+  Args&&...  arguments                        // the arguments to construct the element from
+)
+
+/*
+This method constructs a new element in place from "arguments" and links it in at the front or
+the back of every chain.
+*/
+
+{
+  Node *const node = newNode(std::forward<Args>(arguments)...);
+
+  for (unsigned int chain = 0U; chain < N; ++chain)
+    linkBefore(atFront ? _sentinels[chain].next : &_sentinels[chain], &node->links[chain]);
+
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> template<class... Args>
+typename DMultiLinkedList<T, N>::Node *const DMultiLinkedList<T, N>::newNode
+(
+  Args&&... arguments                            // the arguments to construct the element from
+)
+
+/*
+This method constructs a new (unlinked) node in a slot from the pool and returns it.  "Full" is
+thrown if no memory could be allocated for the node.  "OperationFailed" is thrown if the
+element couldn't be constructed -- the slot is returned to the pool in that case.
+*/
+
+{
+  void *const slot = _pool.allocate();
+
+  if (slot == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  try
+  {
+    return new(slot) Node(std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    _pool.release(slot);
+    throw OperationFailed("Unable to copy an element into a new node.", __FILE__, __LINE__);
+  }
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::deleteNode
+(
+  Node *const node                              // a node that was created by "newNode()"
+)
+noexcept
+
+{
+  assert(node != NULL);
+
+  node->~Node();
+  _pool.release(node);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::copyChains
+(
+  const DMultiLinkedList<T, N>& source                 // the list to copy
+)
+
+/*
+This method copies "source's" elements into this (empty) list, with every chain in the same
+order as in "source".  If an exception is thrown then the list is left empty.
+
+The copies are made and linked into chain 0 in "source's" chain 0 order.  Each pair of source
+and copy nodes goes into a table that's then sorted by source node address, so that each of
+the other chains can be threaded by walking "source's" chain and looking up the copy of each
+node.
+*/
+
+{
+  typedef std::pair<const Node*, Node*> Copy;
+
+  assert(this->_numElements == 0U);
+
+  if (source._numElements == 0U)
+    return;
+
+  try
+  {
+    std::vector<Copy> copies;
+
+    copies.reserve(source._numElements);
+
+    for (ConstElementIterator element = source.begin(); element != source.end(); ++element)
+    {
+      Node *const node = newNode(*element);
+
+      linkBefore(&_sentinels[0], &node->links[0]);
+      ++this->_numElements;
+      copies.push_back(Copy(nodeOf(element._link, 0U), node));
+    }
+
+    std::sort(copies.begin(), copies.end());
+
+    for (unsigned int chain = 1U; chain < N; ++chain)
+    {
+      for (const Link* link = source._sentinels[chain].next; link != &source._sentinels[chain];
+        link = link->next)
+      {
+        const Node *const original = nodeOf(const_cast<Link*>(link), chain);
+        const typename std::vector<Copy>::const_iterator copy = std::lower_bound(
+          copies.begin(), copies.end(), Copy(original, NULL));
+
+        linkBefore(&_sentinels[chain], &copy->second->links[chain]);
+      }
+    }
+  }
+  catch (const std::bad_alloc&)
+  {
+    empty();
+    throw Full(__FILE__, __LINE__);
+  }
+  catch (...)
+  {
+    empty();
+    throw;
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::initSentinels() noexcept
+
+{
+  for (unsigned int chain = 0U; chain < N; ++chain)
+  {
+    _sentinels[chain].previous = &_sentinels[chain];
+    _sentinels[chain].next     = &_sentinels[chain];
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::linkBefore
+(
+  Link *const position,                     // the link to add the other before
+  Link *const link                          // the link to add
+)
+noexcept
+
+{
+  link->previous           = position->previous;
+  link->next               = position;
+  position->previous->next = link;
+  position->previous       = link;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> void DMultiLinkedList<T, N>::unlink
+(
+  Link *const link                          // the link to take out of its chain
+)
+noexcept
+
+{
+  link->previous->next = link->next;
+  link->next->previous = link->previous;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, unsigned int N> template<class Compare>
+typename DMultiLinkedList<T, N>::Link *const DMultiLinkedList<T, N>::merge
+(
+  Link*              first,                 // a sorted, NULL-terminated list of links
+  Link*              second,                // another one, of links that came after "first's"
+  const unsigned int chain,                 // the chain that the links are in
+  Compare&           isLess                 // tells whether one element is less than another
+)
+noexcept
+
+/*
+This function merges two sorted lists (along their next links only) into one and returns it.
+A link from "second" only goes before a link from "first" if its element is less, so equal
+elements keep their order.
+*/
+
+{
+  Link  head;
+  Link* last(&head);
+
+  while (first != NULL && second != NULL)
+  {
+    if (isLess(nodeOf(second, chain)->element, nodeOf(first, chain)->element))
+    {
+      last->next = second;
+      second     = second->next;
+    }
+    else
+    {
+      last->next = first;
+      first      = first->next;
+    }
+
+    last = last->next;
+  }
+
+  last->next = first != NULL ? first : second;
+
+  return head.next;
+}
+
+#endif
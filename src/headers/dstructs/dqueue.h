@@ -0,0 +1,501 @@
+#ifndef DSTRUCTS_DQUEUE_H
+#define DSTRUCTS_DQUEUE_H
+
+// ============================================================================================
+//
+// dqueue.h -- Implementation of a dynamic queue -- that is, a queue that stores its elements
+// in dynamicly-allocated memory.
+//
+// ============================================================================================
+
+/*
+This class is a dynamic queue.  A "DQueue" is a "Queue".
+
+The structure of a "DQueue" object looks like this:
+
+Node 0           Node 1           Node 2           Node 3
+-------------    -------------    -------------    -------------
+| Element   |    | Element   |    | Element   |    | Element   |
+| Next node |--->| Next node |--->| Next node |--->| Next node |--->NULL
+-------------    -------------    -------------    -------------
+       ^                                                  ^
+       |                                                  |
+_first--                                           _last --
+
+When a new element is enqueued, a "Node" object is created (in a slot from the queue's node
+pool), the "Node" pointed to by "_last" (in this case, "Node 3") is set to point to it and
+"_last" is then set to point to the new "Node".
+
+When an element is dequeued, the element is extracted from the "Node" pointed to by "_first"
+(in this case, "Node 0"), "_first" is set to point to the next "Node" (in this case, "Node 1")
+and the old first "Node" is destroyed (and its slot goes back to the node pool).
+
+Both ends take constant time.  As with "DStack", a queue that keeps enqueuing and dequeuing
+doesn't call the heap once it has reached its working size.  Refer to "DLinearStructure" for
+details.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stdarg.h>
+
+#include <utility>
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/dlinearst.h>
+#else
+  #include <dstructs/dlinearstructure.h>
+#endif
+
+#include <dstructs/queue.h>
+
+// ============================================================================================
+// CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class DQueue:
+  virtual public DataStructureExceptions,
+  virtual public DLinearStructure<T>,
+  virtual public Queue<T>
+{
+  public:
+                 DQueue()
+                   {return;}
+                 DQueue(const DQueue<T>& source):
+                   DLinearStructure<T>(source) {return;}
+                 DQueue(const DataStructure<T>& source):
+                   DLinearStructure<T>(source) {return;}
+                 DQueue(const unsigned int, ...);
+
+    DQueue<T>&   operator=(const DQueue<T>&);
+    DQueue<T>&   operator=(const DataStructure<T>&);
+    DQueue<T>&   operator+=(const DataStructure<T>&);
+
+    // Queue virtual methods
+
+    virtual void enqueue(const T&);
+    virtual void enqueue(T&&);
+    virtual void enqueue(const T *const, const unsigned int);
+    virtual void dequeue(T&);
+    virtual void dequeue(T *const, const unsigned int);
+    virtual void peek(T&) const;
+
+    template<class... Args>
+    void         emplace(Args&&...);
+
+  protected:
+    typedef typename DLinearStructure<T>::Node Node;
+
+    using DLinearStructure<T>::_first;
+    using DLinearStructure<T>::_last;
+};
+
+// ============================================================================================
+// METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> DQueue<T>::DQueue
+(
+  const unsigned int numElements,         // the # of elements in the parameter list
+  ...                               // the elements to be enqueued
+)
+
+/*
+This constructor creates a new queue that contains copies of the elements passed in the
+parameter list.  The elements in the parameter list are enqueued in the order in which they
+appear -- in other words, the first element in the parameter list will be the first element
+to be dequeued.
+
+Note:  due to type promotion issues, "T" cannot be "char", "unsigned char" or "float".
+
+PRECONDITIONS:
+There must be enough memory for a node for each element.
+
+POSTCONDITIONS:
+A new queue is created.  Its contents are copies of the elements passed in the parameter list.
+*/
+
+{
+  va_list argList;                            // for managing the argument list
+
+  va_start(argList, numElements);
+  this->initWithVarArgs(numElements, argList);
+  va_end(argList);
+
+  #ifndef NDEBUG
+    DLinearStructure<T>::assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DQueue<T>::enqueue
+(
+  const T& elementToEnqueue                  // the element to be placed on the queue
+)
+
+/*
+This method enqueues a copy of "elementToEnqueue" at the tail of the queue.
+
+PRECONDITIONS:
+There must be enough memory for a new node.
+
+POSTCONDITIONS:
+The copy of "elementToEnqueue" will be the last element to be dequeued.
+*/
+
+{
+  emplace(elementToEnqueue);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DQueue<T>::enqueue
+(
+  T&& elementToEnqueue                       // the element to be moved onto the queue
+)
+
+/*
+This method moves "elementToEnqueue" onto the tail of the queue.  Otherwise, it's the same as
+the other "enqueue()".
+*/
+
+{
+  emplace(std::move(elementToEnqueue));
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void DQueue<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" directly in a new node and enqueues it
+at the tail of the queue.  No temporary "T" is created.
+
+PRECONDITIONS:
+There must be enough memory for a new node.
+
+POSTCONDITIONS:
+The new element will be the last element to be dequeued.
+*/
+
+{
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  Node *const node = this->newNode(NULL, std::forward<Args>(arguments)...);
+
+  if (_last != NULL)
+    _last->setNext(node);
+  else
+    _first = node;
+
+  _last = node;
+  ++this->_numElements;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DQueue<T>::enqueue
+(
+  const T *const     elementsToEnqueue,          // the block of elements to enqueue
+  const unsigned int count                       // the no. of elements in the block
+)
+
+/*
+This method enqueues copies of the "count" elements in "elementsToEnqueue", in order, at the
+tail of the queue.
+
+The new nodes are linked to each other as they're created and the whole chain is then linked
+to the tail in one step.  If a node can't be created then the ones already created are
+destroyed, the exception is passed on and the queue is left as it was.
+
+PRECONDITIONS:
+There must be enough memory for "count" new nodes.
+
+POSTCONDITIONS:
+"elementsToEnqueue[0]" will be the first of the new elements to be dequeued and
+"elementsToEnqueue[count - 1]" will be the last.
+*/
+
+{
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  if (count == 0U)
+    return;
+
+  assert(elementsToEnqueue != NULL);
+
+  Node* chainFirst(this->newNode(NULL, elementsToEnqueue[0]));
+  Node* chainLast(chainFirst);
+
+  try
+  {
+    for (unsigned int i = 1U; i < count; ++i)
+    {
+      Node *const node = this->newNode(NULL, elementsToEnqueue[i]);
+
+      chainLast->setNext(node);
+      chainLast = node;
+    }
+  }
+  catch (...)
+  {
+    while (chainFirst != NULL)
+    {
+      Node *const nodeToRemove(chainFirst);
+
+      chainFirst = chainFirst->next();
+      this->deleteNode(nodeToRemove);
+    }
+
+    throw;
+  }
+
+  if (_last != NULL)
+    _last->setNext(chainFirst);
+  else
+    _first = chainFirst;
+
+  _last = chainLast;
+  this->_numElements += count;
+
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DQueue<T>::dequeue
+(
+  T& dequeuedElement                    // the variable to receive the dequeued element
+)
+
+/*
+This method dequeues the element at the head of the queue and moves it to "dequeuedElement"
+(refer to "LinearStructure<T>::moveElement()").
+
+PRECONDITIONS:
+The queue cannot be empty.
+
+POSTCONDITIONS:
+The next element to be dequeued is moved to "dequeuedElement" and removed from the queue.
+*/
+
+{
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  if (_first == NULL)
+    throw Empty(__FILE__, __LINE__);
+
+  Node *const nodeToRemove(_first);
+
+  try
+  {
+    this->moveElement(dequeuedElement, *(_first->element()));
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to remove an element from a DQueue.", __FILE__, __LINE__);
+  }
+
+  _first = _first->next();
+
+  if (_first == NULL)
+    _last = NULL;
+
+  this->deleteNode(nodeToRemove);
+  --this->_numElements;
+
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DQueue<T>::dequeue
+(
+  T *const           dequeuedElements,        // the block to receive the dequeued elements
+  const unsigned int count                    // the no. of elements to dequeue
+)
+
+/*
+This method dequeues "count" elements from the head of the queue and moves them, in order, to
+"dequeuedElements" (refer to "LinearStructure<T>::moveElement()").
+
+If moving an element fails then "OperationFailed" is thrown.  The elements that were already
+moved will have been dequeued; the one that couldn't be moved is still at the head.
+
+PRECONDITIONS:
+The queue must have at least "count" elements.
+
+POSTCONDITIONS:
+The next "count" elements to be dequeued are moved to "dequeuedElements[0]" through
+"dequeuedElements[count - 1]" and removed from the queue.
+*/
+
+{
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  if (count > this->_numElements)
+    throw Empty(__FILE__, __LINE__);
+
+  assert(count == 0U || dequeuedElements != NULL);
+
+  for (unsigned int i = 0U; i < count; ++i)
+  {
+    Node *const nodeToRemove(_first);
+
+    try
+    {
+      this->moveElement(dequeuedElements[i], *(_first->element()));
+    }
+    catch (...)
+    {
+      throw OperationFailed("Unable to remove an element from a DQueue.", __FILE__, __LINE__);
+    }
+
+    _first = _first->next();
+
+    if (_first == NULL)
+      _last = NULL;
+
+    this->deleteNode(nodeToRemove);
+    --this->_numElements;
+  }
+
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DQueue<T>::peek
+(
+  T& elementToBeDequeued             // the variable to receive the next element to be dequeued
+)
+const
+
+/*
+This method retrieves the element at the head of the queue (without dequeuing it) and copies
+it to "elementToBeDequeued".
+
+PRECONDITIONS:
+The queue cannot be empty.
+
+POSTCONDITIONS:
+The next element to be dequeued is copied to "elementToBeDequeued".
+*/
+
+{
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  if (_first == NULL)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    elementToBeDequeued = *(_first->element());
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to copy an element from a DQueue.", __FILE__, __LINE__);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DQueue<T>& DQueue<T>::operator=
+(
+  const DQueue<T>& source                                      // the source queue to copy from
+)
+
+/*
+This method is the same as the other "operator=()" -- it's only here because otherwise the
+compiler would generate a (memberwise) one for assigning one "DQueue" to another.
+*/
+
+{
+  return operator=(static_cast<const DataStructure<T>&>(source));
+}
+
+/*********************************************************************************************/
+
+template<class T> DQueue<T>& DQueue<T>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    this->empty();
+    this->concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> DQueue<T>& DQueue<T>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  this->concatenate(source);
+  return *this;
+}
+
+// ============================================================================================
+// MEANINGFUL OPERATORS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> DQueue<T> operator+
+(
+  const DQueue<T>&        lhs,                      // the source data structure to copy from
+  const DataStructure<T>& rhs                       // the source data structure to copy from
+)
+
+{
+  return DQueue<T>(lhs) += rhs;
+}
+
+#endif
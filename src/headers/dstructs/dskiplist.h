@@ -0,0 +1,1008 @@
+#ifndef DSTRUCTS_DSKIPLIST_H
+#define DSTRUCTS_DSKIPLIST_H
+
+// ============================================================================================
+//
+// dskiplist.h -- Dynamic Indexed Skip List Template Class
+//
+// ============================================================================================
+
+/*
+This class is an indexed skip list:  a list whose elements can be got at, inserted and removed
+by position in O(log n) expected time.  A "DSkipList" is a "LinearStructure".
+
+Positions work as they do for "DArray" -- "operator[]()", "insert(index, element)" and
+"remove(index)" -- but inserting or removing an element doesn't shift the ones after it, so
+neither takes time in proportion to the length of the list:
+
+  DSkipList<Line> document;
+
+  document.insert(0U, title);
+  document.insert(document.numElements(), line);
+  document.remove(17U);
+  document[41U] = replacement;
+
+A "DSkipList" also has the cursor interface of the "List" family (refer to "lists.h"):
+"findFirst()", "findLast()", "findNext()" and "findPrev()" move the cursor, "getCurrent()" and
+"index()" say where it is, "insert(element)" inserts before it, "append()" adds to the back and
+"delCurrent()" removes the element at it.  Stepping the cursor takes constant time.
+
+If the cursor is past either end (or the list is empty) then there's no current element:
+"getCurrent()" returns NULL and "index()" returns "numElements()".  Inserting or removing
+elements keeps the cursor on the same element (removing the current element moves it on to
+the next one).
+
+The element iterators are forward iterators over the whole list.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+A skip list is a sorted linked list with express lanes.  Every node is on level 0 and each node
+is also on each level above with probability 1/4, up to "MAX_HEIGHT" levels.  Each level is a
+singly-linked list of the nodes on it, so level "k" skips about 4^k nodes at a time.  Here the
+nodes aren't kept sorted by value but by position, and each link records its "width" -- how
+many level-0 steps it skips.  Finding position "i" walks each level from the top, taking every
+link that doesn't overshoot "i" before dropping a level, which takes O(log n) expected steps.
+The links that a search drops down from are the ones that an insertion or removal at that
+position has to relink or re-width, so both are a search followed by O(log n) link updates.
+
+  level 2  head ----------------------------------------> D ----------------------> NULL
+  level 1  head ---------------> B ---------------------> D ---------> E -------> NULL
+  level 0  head ----> A -------> B -------> C ----------> D ---------> E -------> NULL
+  position    0       1          2          3             4            5     (6 = past the end)
+
+Element "i" is at position "i + 1".  A link to NULL has the width that it would have to a node
+just past the end, so that it can be updated like any other link.
+
+The head's links are a member of the list object.  A node holds its element, a pointer to the
+previous node (so that "findPrev()" and "findLast()" take constant time) and its height,
+followed by that many links.  Nodes of each height come from a "NodePool" of their own, which
+is only created when the first node of that height is needed.  With a probability of 1/4, a
+node has 4/3 links on average.
+
+The heights come from a xorshift generator with a fixed seed, so a list built by the same
+sequence of operations always has the same shape.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include <sdp.h>
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/linearst.h>
+#else
+  #include <dstructs/linearstructure.h>
+#endif
+
+#include <dstructs/nodepool.h>
+
+// ============================================================================================
+// DSKIPLIST<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class DSkipList:
+  virtual public DataStructureExceptions,
+  virtual public LinearStructure<T>
+{
+  public:
+    static const unsigned int MAX_HEIGHT = 16U;           // enough for 4^16 elements
+
+  protected:
+    class Node;
+
+    struct Link
+    {
+      Node*        next;                                // the next node on this level, or NULL
+      unsigned int width;                               // the no. of level-0 steps to "next"
+    };
+
+    class Node
+    {
+      public:
+        T            element;
+        Node*        previous;                          // the previous node, or NULL
+        unsigned int height;                            // the no. of links after the node
+
+        template<class... Args>
+        Node(const unsigned int newHeight, Args&&... arguments):
+          element(std::forward<Args>(arguments)...), previous(NULL), height(newHeight)
+          {return;}
+
+        Link *const  links() noexcept
+                       {return reinterpret_cast<Link*>(reinterpret_cast<char*>(this) +
+                          LINKS_OFFSET);}
+    };
+
+  public:
+
+    // Element iterators
+
+    /*
+    "ElementIterator" and "ConstElementIterator" are standard forward iterators.  Incrementing
+    one follows a level-0 link.
+    */
+
+    template<class Element> class NodeIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                      NodeIterator(Node *const node = NULL) noexcept:
+                        _node(node) {return;}
+                      NodeIterator(const NodeIterator<T>& source) noexcept:
+                        _node(source._node) {return;}
+
+        Element&      operator*() const noexcept
+                        {return _node->element;}
+        Element*      operator->() const noexcept
+                        {return &_node->element;}
+        NodeIterator& operator++() noexcept
+                        {_node = _node->links()[0].next; return *this;}
+        NodeIterator  operator++(int) noexcept
+                        {const NodeIterator old(*this); ++*this; return old;}
+
+        const bool    operator==(const NodeIterator& rhs) const noexcept
+                        {return _node == rhs._node;}
+        const bool    operator!=(const NodeIterator& rhs) const noexcept
+                        {return _node != rhs._node;}
+
+      private:
+        Node* _node;                        // the current node, or NULL past the last element
+
+        friend class NodeIterator<const T>;
+    };
+
+    typedef NodeIterator<T>       ElementIterator;
+    typedef NodeIterator<const T> ConstElementIterator;
+
+                           DSkipList() noexcept;
+                           DSkipList(const DSkipList<T>&);
+                           DSkipList(const DataStructure<T>&);
+    virtual                ~DSkipList();
+
+    DSkipList<T>&          operator=(const DSkipList<T>&);
+    DSkipList<T>&          operator=(const DataStructure<T>&);
+    DSkipList<T>&          operator+=(const DataStructure<T>&);
+
+    ElementIterator        begin() noexcept
+                             {return ElementIterator(_head[0].next);}
+    ElementIterator        end() noexcept
+                             {return ElementIterator();}
+    ConstElementIterator   begin() const noexcept
+                             {return ConstElementIterator(_head[0].next);}
+    ConstElementIterator   end() const noexcept
+                             {return ConstElementIterator();}
+
+    // Positional access
+
+    T&                     operator[](const unsigned int&);
+    const T&               operator[](const unsigned int&) const;
+
+    void                   insert(const unsigned int index, const T& element)
+                             {emplace(index, element); return;}
+    void                   insert(const unsigned int index, T&& element)
+                             {emplace(index, std::move(element)); return;}
+
+    template<class... Args>
+    void                   emplace(const unsigned int, Args&&...);
+
+    void                   remove(const unsigned int);
+
+    // Cursor (List) methods
+
+    void                   findFirst() noexcept
+                             {_current = _head[0].next; _currentIndex = 0U; return;}
+    void                   findLast() noexcept;
+    void                   findNext();
+    void                   findPrev();
+    T *const               getCurrent() const noexcept
+                             {return _current != NULL ? &_current->element : NULL;}
+    const unsigned int     index() const noexcept
+                             {return _currentIndex;}
+
+    void                   insert(const T& element)
+                             {emplace(_currentIndex, element); findPrev(); return;}
+    void                   append(const T& element)
+                             {emplace(this->_numElements, element); findLast(); return;}
+    void                   delCurrent();
+
+    // Node pools
+
+    const unsigned int     nodesPerChunk() const noexcept
+                             {return _nodesPerChunk;}
+    void                   setNodesPerChunk(const unsigned int);
+
+    // DataStructure<T> methods
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    // LinearStructure<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+    static const size_t    LINK_ALIGNMENT = alignof(Node) > alignof(Link) ? alignof(Node) :
+                             alignof(Link);
+    static const size_t    LINKS_OFFSET   = (sizeof(Node) + alignof(Link) - 1U) /
+                             alignof(Link) * alignof(Link);
+
+    Link                   _head[MAX_HEIGHT];       // the head's links (valid up to "_height")
+    unsigned int           _height;                 // the no. of levels in use (at least 1)
+    Node*                  _last;                   // the last node, or NULL if empty
+    Node*                  _current;                // the cursor's node, or NULL
+    unsigned int           _currentIndex;           // the cursor's index
+    unsigned int           _random;                 // the xorshift generator's state
+    unsigned int           _nodesPerChunk;          // no. of nodes per chunk in each pool
+    NodePool*              _pools[MAX_HEIGHT];      // a pool for each height, or NULL
+
+    Node *const            nodeAt(const unsigned int) const noexcept;
+    void                   findPredecessors(const unsigned int, Link* (&)[MAX_HEIGHT],
+                             unsigned int (&)[MAX_HEIGHT]) noexcept;
+    const unsigned int     randomHeight() noexcept;
+
+    template<class... Args>
+    Node *const            newNode(const unsigned int, Args&&...);
+    void                   deleteNode(Node *const) noexcept;
+    void                   deletePools() noexcept;
+    void                   initHead() noexcept;
+};
+
+// ============================================================================================
+// DSKIPLIST<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> DSkipList<T>::DSkipList() noexcept:
+
+/*
+This constructor instanciates an empty list.  No pools are created until nodes are needed.
+*/
+
+  _random(2463534242U),
+  _nodesPerChunk(NodePool::DEFAULT_SLOTS_PER_CHUNK)
+
+{
+  for (unsigned int height = 0U; height < MAX_HEIGHT; ++height)
+    _pools[height] = NULL;
+
+  initHead();
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DSkipList<T>::DSkipList
+(
+  const DSkipList<T>& source                           // the list to copy
+):
+
+/*
+This constructor makes a deep copy of "source".  The copy gets its own (empty) pools with the
+same no. of nodes per chunk as "source's" pools.
+*/
+
+  _random(2463534242U),
+  _nodesPerChunk(source._nodesPerChunk)
+
+{
+  for (unsigned int height = 0U; height < MAX_HEIGHT; ++height)
+    _pools[height] = NULL;
+
+  initHead();
+
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    deletePools();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DSkipList<T>::DSkipList
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+):
+
+/*
+This constructor instanciates a list that holds copies of "source's" elements, in iterative
+order.
+*/
+
+  _random(2463534242U),
+  _nodesPerChunk(NodePool::DEFAULT_SLOTS_PER_CHUNK)
+
+{
+  for (unsigned int height = 0U; height < MAX_HEIGHT; ++height)
+    _pools[height] = NULL;
+
+  initHead();
+
+  try
+  {
+    concatenate(source);
+  }
+  catch (...)
+  {
+    empty();
+    deletePools();
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DSkipList<T>::~DSkipList()
+
+/*
+This destructor destroys the elements and then the pools.
+*/
+
+{
+  empty();
+  deletePools();
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> DSkipList<T>& DSkipList<T>::operator=
+(
+  const DSkipList<T>& source                           // the list to copy
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> DSkipList<T>& DSkipList<T>::operator=
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> DSkipList<T>& DSkipList<T>::operator+=
+(
+  const DataStructure<T>& source                       // the data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> T& DSkipList<T>::operator[]
+(
+  const unsigned int& index                                     // the element to get
+)
+
+/*
+This method returns element "index" in O(log n) expected time.  "OperationFailed" is thrown if
+there's no such element.
+*/
+
+{
+  if (index >= this->_numElements)
+    throw OperationFailed("The index is out of range.", __FILE__, __LINE__);
+
+  return nodeAt(index)->element;
+}
+
+/*********************************************************************************************/
+
+template<class T> const T& DSkipList<T>::operator[]
+(
+  const unsigned int& index                                     // the element to get
+)
+const
+
+{
+  if (index >= this->_numElements)
+    throw OperationFailed("The index is out of range.", __FILE__, __LINE__);
+
+  return nodeAt(index)->element;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void DSkipList<T>::emplace
+(
+  const unsigned int index,                    // where the new element goes
+  Args&&...          arguments                 // the arguments to construct the element from
+)
+
+/*
+This method constructs a new element in place from "arguments" -- passing an element copies it,
+passing an rvalue moves it and passing anything else calls the matching "T" constructor -- so
+that it becomes element "index".  The elements from "index" on move up one position.  "index"
+can be "numElements()", which adds the element to the back.
+
+"OperationFailed" is thrown if "index" is out of range or the element couldn't be constructed.
+"Full" is thrown if no memory could be allocated for its node.  The list is unchanged in any of
+those cases.
+*/
+
+{
+  if (index > this->_numElements)
+    throw OperationFailed("The index is out of range.", __FILE__, __LINE__);
+
+  const unsigned int height = randomHeight();
+  Node *const        node   = newNode(height, std::forward<Args>(arguments)...);
+  Link *const        links  = node->links();
+  Link*              predecessors[MAX_HEIGHT];
+  unsigned int       positions[MAX_HEIGHT];
+
+  /*
+  Levels that are coming into use start out with a link from the head to past the end.
+  */
+
+  for (; _height < height; ++_height)
+  {
+    _head[_height].next  = NULL;
+    _head[_height].width = this->_numElements + 1U;
+  }
+
+  findPredecessors(index, predecessors, positions);
+
+  for (unsigned int level = 0U; level < height; ++level)
+  {
+    Link& predecessor = predecessors[level][level];
+
+    links[level].next  = predecessor.next;
+    links[level].width = positions[level] + predecessor.width - index;
+    predecessor.next   = node;
+    predecessor.width  = index + 1U - positions[level];
+  }
+
+  for (unsigned int level = height; level < _height; ++level)
+    ++predecessors[level][level].width;
+
+  // Link up the level-0 back pointers.
+
+  node->previous = index > 0U ? reinterpret_cast<Node*>(reinterpret_cast<char*>(
+    predecessors[0]) - LINKS_OFFSET) : NULL;
+
+  if (links[0].next != NULL)
+    links[0].next->previous = node;
+  else
+    _last = node;
+
+  ++this->_numElements;
+
+  if (index <= _currentIndex)
+    ++_currentIndex;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::remove
+(
+  const unsigned int index                                      // the element to remove
+)
+
+/*
+This method removes element "index".  The elements after it move down one position.
+"OperationFailed" is thrown if there's no such element.
+*/
+
+{
+  if (index >= this->_numElements)
+    throw OperationFailed("The index is out of range.", __FILE__, __LINE__);
+
+  Link*        predecessors[MAX_HEIGHT];
+  unsigned int positions[MAX_HEIGHT];
+
+  findPredecessors(index, predecessors, positions);
+
+  Node *const node  = predecessors[0][0].next;
+  Link *const links = node->links();
+
+  for (unsigned int level = 0U; level < node->height; ++level)
+  {
+    Link& predecessor = predecessors[level][level];
+
+    predecessor.next   = links[level].next;
+    predecessor.width += links[level].width - 1U;
+  }
+
+  for (unsigned int level = node->height; level < _height; ++level)
+    --predecessors[level][level].width;
+
+  if (links[0].next != NULL)
+    links[0].next->previous = node->previous;
+  else
+    _last = node->previous;
+
+  while (_height > 1U && _head[_height - 1U].next == NULL)
+    --_height;
+
+  if (_current == node)
+    _current = links[0].next;
+  else if (index < _currentIndex)
+    --_currentIndex;
+
+  deleteNode(node);
+  --this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::findLast() noexcept
+
+/*
+This method moves the cursor to the last element (which leaves no current element if the list
+is empty).
+*/
+
+{
+  _current      = _last;
+  _currentIndex = _last != NULL ? this->_numElements - 1U : 0U;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::findNext()
+
+/*
+This method moves the cursor to the next element.  Moving past the last element leaves no
+current element.  "OperationFailed" is thrown if there's no current element.
+*/
+
+{
+  if (_current == NULL)
+    throw OperationFailed("There is no next element.", __FILE__, __LINE__);
+
+  _current = _current->links()[0].next;
+  ++_currentIndex;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::findPrev()
+
+/*
+This method moves the cursor to the previous element.  Moving before the first element leaves
+no current element.  If there's no current element then the cursor moves to the last element.
+"OperationFailed" is thrown if the list is empty.
+*/
+
+{
+  if (_last == NULL)
+    throw OperationFailed("There is no previous element.", __FILE__, __LINE__);
+
+  if (_current == NULL)
+    findLast();
+  else
+  {
+    _current = _current->previous;
+
+    if (_current != NULL)
+      --_currentIndex;
+    else
+      _currentIndex = this->_numElements;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::delCurrent()
+
+/*
+This method removes the current element.  The element after it (if any) becomes the current
+element.  "OperationFailed" is thrown if there's no current element.
+*/
+
+{
+  if (_current == NULL)
+    throw OperationFailed("There is no current element to delete.", __FILE__, __LINE__);
+
+  remove(_currentIndex);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::setNodesPerChunk
+(
+  const unsigned int nodesPerChunk      // no. of nodes to allocate from the heap at a time
+)
+
+/*
+This method changes how many nodes each of this list's pools allocates from the heap at a time.
+0 turns pooling off, so that every node is allocated from and returned to the heap
+individually.
+
+Any memory that the pools are holding onto is returned to the heap.
+
+PRECONDITIONS:
+The list must be empty.
+
+POSTCONDITIONS:
+Nodes will be allocated "nodesPerChunk" at a time.
+*/
+
+{
+  if (this->_numElements > 0U)
+  {
+    throw OperationFailed("The node pools of a non-empty DSkipList can't be changed.",
+      __FILE__, __LINE__);
+  }
+
+  _nodesPerChunk = nodesPerChunk;
+
+  for (unsigned int height = 0U; height < MAX_HEIGHT; ++height)
+  {
+    if (_pools[height] != NULL)
+      _pools[height]->reset(nodesPerChunk);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::empty() noexcept
+
+/*
+This method removes every element.  The pools keep their memory for later nodes.
+*/
+
+{
+  for (Node* node = _head[0].next; node != NULL; )
+  {
+    Node *const next = node->links()[0].next;
+
+    deleteNode(node);
+    node = next;
+  }
+
+  this->_numElements = 0U;
+  initHead();
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method appends copies of "source's" elements, in iterative order.  "source" can be this
+list, in which case its elements are appended once.
+
+If an exception is thrown then the list is unchanged.
+*/
+
+{
+  const unsigned int oldCount(this->_numElements);
+
+  try
+  {
+    bool           isReversed;
+    const T *const block = source.contiguousElements(isReversed);
+
+    if (block != NULL)
+    {
+      const unsigned int count(source.numElements());
+
+      for (unsigned int i = 0U; i < count; ++i)
+        emplace(this->_numElements, block[isReversed ? count - 1U - i : i]);
+    }
+    else if (&source == this)
+    {
+      ConstElementIterator element(begin());
+
+      for (unsigned int i = 0U; i < oldCount; ++i, ++element)
+        emplace(this->_numElements, *element);
+    }
+    else
+    {
+      const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+      for (; i->more(); i->next())
+        emplace(this->_numElements, *i->current());
+    }
+  }
+  catch (...)
+  {
+    while (this->_numElements > oldCount)
+      remove(this->_numElements - 1U);
+
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void DSkipList<T>::assertInvariants() const noexcept
+
+  {
+    assert(_height >= 1U && _height <= MAX_HEIGHT);
+    assert((this->_numElements == 0U) == (_head[0].next == NULL));
+    assert((_head[0].next == NULL) == (_last == NULL));
+    assert(_head[0].next == NULL || _head[0].next->previous == NULL);
+    assert(_last == NULL || _last->links()[0].next == NULL);
+    assert((_current == NULL) == (_currentIndex == this->_numElements));
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> typename DSkipList<T>::Node *const DSkipList<T>::nodeAt
+(
+  const unsigned int index                                      // the element to find
+)
+const noexcept
+
+/*
+This method returns the node of element "index", which must exist.
+*/
+
+{
+  const Link*  links = _head;
+  Node*        node(NULL);
+  unsigned int position(0U);
+
+  for (unsigned int level = _height; level-- > 0U; )
+  {
+    while (links[level].next != NULL && position + links[level].width <= index + 1U)
+    {
+      position += links[level].width;
+      node      = links[level].next;
+      links     = node->links();
+    }
+
+    if (position == index + 1U)
+      break;
+  }
+
+  assert(node != NULL && position == index + 1U);
+
+  return node;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::findPredecessors
+(
+  const unsigned int index,                         // the position to find
+  Link*              (&predecessors)[MAX_HEIGHT],   // gets the links to update on each level
+  unsigned int       (&positions)[MAX_HEIGHT]       // gets the positions of their owners
+)
+noexcept
+
+/*
+This method finds, on each level in use, the last node (or the head) whose position is no
+greater than "index" -- that is, the node whose link on that level passes over element
+"index".  "predecessors[level]" gets that node's links and "positions[level]" gets its
+position.
+*/
+
+{
+  Link*        links = _head;
+  unsigned int position(0U);
+  unsigned int level(_height);                        // there's always at least one level
+
+  do
+  {
+    --level;
+
+    while (links[level].next != NULL && position + links[level].width <= index)
+    {
+      position += links[level].width;
+      links     = links[level].next->links();
+    }
+
+    predecessors[level] = links;
+    positions[level]    = position;
+  }
+  while (level > 0U);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const unsigned int DSkipList<T>::randomHeight() noexcept
+
+/*
+This method returns a random height from 1 to "MAX_HEIGHT":  1 with probability 3/4, 2 with
+probability 3/16 and so on.  Each extra level takes two more bits of one xorshift number.
+*/
+
+{
+  _random ^= _random << 13;
+  _random ^= _random >> 17;
+  _random ^= _random << 5;
+
+  unsigned int height(1U);
+
+  for (unsigned int bits = _random; height < MAX_HEIGHT && (bits & 3U) == 0U; bits >>= 2)
+    ++height;
+
+  return height;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args>
+typename DSkipList<T>::Node *const DSkipList<T>::newNode
+(
+  const unsigned int height,                     // the no. of links that the node needs
+  Args&&...          arguments                   // the arguments to construct the element from
+)
+
+/*
+This method constructs a new node with "height" links in a slot from the pool for that height
+(creating the pool if it doesn't exist yet) and returns it.  "Full" is thrown if no memory
+could be allocated for the node (or the pool).  "OperationFailed" is thrown if the element
+couldn't be constructed -- the slot is returned to the pool in that case.
+*/
+
+{
+  NodePool*& pool = _pools[height - 1U];
+
+  if (pool == NULL)
+  {
+    pool = new(std::nothrow) NodePool(LINKS_OFFSET + height * sizeof(Link), LINK_ALIGNMENT,
+      _nodesPerChunk);
+
+    if (pool == NULL)
+      throw Full(__FILE__, __LINE__);
+  }
+
+  void *const slot = pool->allocate();
+
+  if (slot == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  try
+  {
+    return new(slot) Node(height, std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    pool->release(slot);
+    throw OperationFailed("Unable to copy an element into a new node.", __FILE__, __LINE__);
+  }
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::deleteNode
+(
+  Node *const node                              // a node that was created by "newNode()"
+)
+noexcept
+
+{
+  assert(node != NULL);
+
+  NodePool *const pool = _pools[node->height - 1U];
+
+  node->~Node();
+  pool->release(node);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::deletePools() noexcept
+
+/*
+This method returns every pool's memory to the heap.  The list must be empty.
+*/
+
+{
+  for (unsigned int height = 0U; height < MAX_HEIGHT; ++height)
+  {
+    delete _pools[height];
+    _pools[height] = NULL;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void DSkipList<T>::initHead() noexcept
+
+/*
+This method sets up the head, cursor & back pointer of an empty list.
+*/
+
+{
+  _head[0].next  = NULL;
+  _head[0].width = 1U;
+  _height        = 1U;
+  _last          = NULL;
+  _current       = NULL;
+  _currentIndex  = 0U;
+
+  return;
+}
+
+#endif
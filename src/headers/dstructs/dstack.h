@@ -22,13 +22,17 @@ Node 3           Node 2           Node 1           Node 0
        |
 _top ---
 
-When a new element is added to this structure, a "Node" object is created and set to point to
-the "Node" currently pointed to by "_top" (in this case, "Node 3"); "_top" is then set to point
-to the new "Node".
+When a new element is added to this structure, a "Node" object is created (in a slot from the
+stack's node pool) and set to point to the "Node" currently pointed to by "_top" (in this case,
+"Node 3"); "_top" is then set to point to the new "Node".
 
 Similarly, when an element is removed from this structure, "_top" is set to point to the "Node"
 pointed to by the "Node" that "_top" currently points to (in this case, "Node 2"); the element
-from the topmost "Node" (in this case, "Node 3") is then extracted and the "Node" is destroyed.
+from the topmost "Node" (in this case, "Node 3") is then extracted and the "Node" is destroyed
+(and its slot goes back to the node pool).
+
+Because destroyed nodes' slots are reused, a stack that keeps pushing and popping doesn't call
+the heap once it has reached its working size.  Refer to "DLinearStructure" for details.
 */
 
 // ============================================================================================
@@ -43,6 +47,8 @@ from the topmost "Node" (in this case, "Node 3") is then extracted and the "Node
 
 #include <dstructs/stack.h>
 
+#include <utility>
+
 // ============================================================================================
 // CLASS DECLARATION
 // ============================================================================================
@@ -55,18 +61,31 @@ template<class T> class DStack:
   public:
                  DStack()
                    {return;}
+                 DStack(const DStack<T>& source):
+                   DLinearStructure<T>(source) {return;}
                  DStack(const DataStructure<T>& source):
-                   DLinearStructure(source) {return;}
+                   DLinearStructure<T>(source) {return;}
                  DStack(const unsigned int, ...);
 
-    DStack<T>&   operator=(const DataStructure<T>&)  throw (Full, OperationFailed);
-    DStack<T>&   operator+=(const DataStructure<T>&) throw (Full, OperationFailed);
+    DStack<T>&   operator=(const DStack<T>&);
+    DStack<T>&   operator=(const DataStructure<T>&);
+    DStack<T>&   operator+=(const DataStructure<T>&);
 
     // Stack virtual methods
 
-    virtual void push(const T&) throw (Full, OperationFailed);
-    virtual void pop(T&)        throw (Empty, OperationFailed);
-    virtual void peek(T&) const throw (Empty, OperationFailed);
+    virtual void push(const T&);
+    virtual void push(T&&);
+    virtual void pop(T&);
+    virtual void peek(T&) const;
+
+    template<class... Args>
+    void         emplace(Args&&...);
+
+  protected:
+    typedef typename DLinearStructure<T>::Node Node;
+
+    using DLinearStructure<T>::_first;
+    using DLinearStructure<T>::_last;
 };
 
 // ============================================================================================
@@ -107,10 +126,16 @@ A new stack is created.  Its contents are copies of the elements passed in the p
   */
 
   va_start(argList, numElements);
-  initializeVariableArguments(numElements, argList);
+
+  for (unsigned int currentElement = 0U; currentElement < numElements; ++currentElement)
+    emplace(va_arg(argList, T));
+
   va_end(argList);
 
-  assertInvariants();
+  #ifndef NDEBUG
+    DLinearStructure<T>::assertInvariants();
+  #endif
+
   return;
 }
 
@@ -120,7 +145,6 @@ template<class T> void DStack<T>::push
 (
   const T& elementToPush                  // the element to be placed on the stack
 )
-throw (DataStructureExceptions::Full, DataStructureExceptions::OperationFailed)
 
 /*
 This method pushes a copy of "elementToPush" onto the stack.
@@ -134,30 +158,56 @@ to be popped off.
 */
 
 {
-  #ifndef NDEBUG
-    assertInvariants();
-  #endif
+  emplace(elementToPush);
+  return;
+}
 
-  Node* newNode;
+/*********************************************************************************************/
 
-  try
-  {
-    newNode = new Node(elementToPush, _first);
-  }
-  catch (...)
-  {
-    throw OperationFailed("Unable to add an element to a DStack.", __FILE__, __LINE__);
-  }
+template<class T> void DStack<T>::push
+(
+  T&& elementToPush                       // the element to be moved onto the stack
+)
 
-  if (newNode == NULL)
-    throw Full(__FILE__, __LINE__);
+/*
+This method moves "elementToPush" onto the stack.  Otherwise, it's the same as the other
+"push()".
+*/
 
-  _first = newNode;
+{
+  emplace(std::move(elementToPush));
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void DStack<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" directly in a new node and pushes it
+onto the stack.  No temporary "T" is created.
+
+PRECONDITIONS:
+There must be enough memory for a new node.
+
+POSTCONDITIONS:
+The new element will be at the top of the stack and will be the first element to be popped off.
+*/
+
+{
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  _first = this->newNode(_first, std::forward<Args>(arguments)...);
 
   if (_last == NULL)
-    _last = newNode;
+    _last = _first;
 
-  ++_numElements;
+  ++this->_numElements;
   return;
 }
 
@@ -167,22 +217,22 @@ template<class T> void DStack<T>::pop
 (
   T& poppedElement                      // the variable to receive the popped element
 )
-throw (DataStructureExceptions::Empty, DataStructureExceptions::OperationFailed)
 
 /*
-This method pops the topmost element off of the stack and copies it to "poppedElement".
+This method pops the topmost element off of the stack and moves it to "poppedElement" (refer to
+"LinearStructure<T>::moveElement()").
 
 PRECONDITIONS:
 The stack cannot be empty.
 
 POSTCONDITIONS:
-The next element to be popped off of the stack is copied to "poppedElement" and removed from
-the stack.
+The next element to be popped off of the stack is moved to "poppedElement" and removed from the
+stack.
 */
 
 {
   #ifndef NDEBUG
-    assertInvariants();
+    this->assertInvariants();
   #endif
 
   if (_first == NULL)
@@ -192,7 +242,7 @@ the stack.
 
   try
   {
-    poppedElement = *(_first->element());
+    this->moveElement(poppedElement, *(_first->element()));
   }
   catch (...)
   {
@@ -204,8 +254,8 @@ the stack.
   if (_first == NULL)
     _last = NULL;
 
-  delete nodeToRemove;
-  --_numElements;
+  this->deleteNode(nodeToRemove);
+  --this->_numElements;
 
   return;
 }
@@ -216,7 +266,7 @@ template<class T> void DStack<T>::peek
 (
   T& elementToBePopped                 // the variable to receive the next element to be popped
 )
-const throw (DataStructureExceptions::Empty, DataStructureExceptions::OperationFailed)
+const
 
 /*
 This method retrieves the topmost element from the stack (without popping it off) and copies it
@@ -231,7 +281,7 @@ The next element to be popped off of the stack is copied to "elementToBePopped".
 
 {
   #ifndef NDEBUG
-    assertInvariants();
+    this->assertInvariants();
   #endif
 
   if (_first == NULL)
@@ -251,15 +301,34 @@ The next element to be popped off of the stack is copied to "elementToBePopped".
 
 /*********************************************************************************************/
 
+template<class T> DStack<T>& DStack<T>::operator=
+(
+  const DStack<T>& source                                      // the source stack to copy from
+)
+
+/*
+This method is the same as the other "operator=()" -- it's only here because otherwise the
+compiler would generate a (memberwise) one for assigning one "DStack" to another.
+*/
+
+{
+  return operator=(static_cast<const DataStructure<T>&>(source));
+}
+
+/*********************************************************************************************/
+
 template<class T> DStack<T>& DStack<T>::operator=
 (
   const DataStructure<T>& source                      // the source data structure to copy from
 )
-throw (DataStructureExceptions::Full, DataStructureExceptions::OperationFailed)
 
 {
-  empty();
-  concatenate(source);
+  if (&source != this)
+  {
+    this->empty();
+    this->concatenate(source);
+  }
+
   return *this;
 }
 
@@ -269,10 +338,9 @@ template<class T> DStack<T>& DStack<T>::operator+=
 (
   const DataStructure<T>& source                      // the source data structure to copy from
 )
-throw (DataStructureExceptions::Full, DataStructureExceptions::OperationFailed)
 
 {
-  concatenate(source);
+  this->concatenate(source);
   return *this;
 }
 
@@ -287,7 +355,6 @@ template<class T> DStack<T>& operator+
   const DStack<T>& lhs,                             // the source data structure to copy from
   const DataStructure<T>& rhs                       // the source data structure to copy from
 )
-throw (DataStructureExceptions::Full, DataStructureExceptions::OperationFailed)
 
 {
   return DStack<T>(lhs) += rhs;
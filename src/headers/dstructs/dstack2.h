@@ -53,11 +53,11 @@ class DataStructure_
     virtual            ~DataStructure_()
                          {return;}
 
-    const unsigned int numElements() const throw ()
+    const unsigned int numElements() const noexcept
                          {return _numElements;}
-    const bool         isEmpty() const throw ()
+    const bool         isEmpty() const noexcept
                          {return _numElements == 0U;}
-    virtual const bool isFull() const throw () = 0;
+    virtual const bool isFull() const noexcept = 0;
 
   protected:
     unsigned int _numElements;              // no. of elements that the data structure contains
@@ -72,7 +72,7 @@ template<class T> class DataStructure:
   virtual public DataStructure_
 {
   public:
-    virtual void empty() throw () = 0;
+    virtual void empty() noexcept = 0;
 
   protected:
     class Iterator_
@@ -81,13 +81,13 @@ template<class T> class DataStructure:
         virtual                ~Iterator_()
                                  {return;}
 
-        virtual void           start()         throw () = 0;
-        virtual bool           more()    const throw () = 0;
-        virtual void           next()          throw () = 0;
-        virtual const T *const current() const throw () = 0;
+        virtual void           start()         noexcept = 0;
+        virtual bool           more()    const noexcept = 0;
+        virtual void           next()          noexcept = 0;
+        virtual const T *const current() const noexcept = 0;
     };
 
-    virtual Iterator_ *const iterator() const throw () = 0;
+    virtual Iterator_ *const iterator() const noexcept = 0;
 };
 
 // ============================================================================================
@@ -99,7 +99,7 @@ template<class T> class LinearStructure:
   virtual public DataStructure<T>
 {
   protected:
-    virtual void concatenate(const DataStructure<T>&) throw (Full, OperationFailed) = 0;
+    virtual void concatenate(const DataStructure<T>&) = 0;
 };
 
 // ============================================================================================
@@ -110,7 +110,7 @@ class DLinearStructure_:
   virtual public DataStructure_
 {
   public:
-    virtual const bool isFull() const throw ()
+    virtual const bool isFull() const noexcept
                          {return false;}
 
   protected:
@@ -122,9 +122,9 @@ class DLinearStructure_:
         virtual      ~Node_()
                        {return;}
 
-        Node_ *const next() const throw ()
+        Node_ *const next() const noexcept
                        {return _next;}
-        void         setNext(Node_ *const next) throw ()
+        void         setNext(Node_ *const next) noexcept
                        {_next = next; return;}
 
       private:
@@ -145,7 +145,7 @@ template<class T> class DLinearStructure:
                  DLinearStructure();
     virtual      ~DLinearStructure();
 
-    virtual void empty() throw ();
+    virtual void empty() noexcept;
 
   protected:
     class Node:
@@ -154,7 +154,7 @@ template<class T> class DLinearStructure:
       public:
                  Node(const T&, Node_ *const);
 
-        T *const element() const throw ()
+        T *const element() const noexcept
                    {return &_element;}
 
       private:
@@ -170,9 +170,9 @@ template<class T> class DLinearStructure:
       void assertInvariants() const;
     #endif
 
-    virtual void concatenate(const DataStructure<T>&) throw (Full, OperationFailed);
+    virtual void concatenate(const DataStructure<T>&);
 
-    virtual DataStructure<T>::Iterator_ *const iterator() const throw ();
+    virtual DataStructure<T>::Iterator_ *const iterator() const noexcept;
 
   private:
     class Iterator:
@@ -181,10 +181,10 @@ template<class T> class DLinearStructure:
       public:
                                Iterator(const Node *const);
 
-        virtual void           start()         throw ();
-        virtual bool           more()    const throw ();
-        virtual void           next()          throw ();
-        virtual const T *const current() const throw ();
+        virtual void           start()         noexcept;
+        virtual bool           more()    const noexcept;
+        virtual void           next()          noexcept;
+        virtual const T *const current() const noexcept;
 
       private:
         const Node *const _first;
@@ -208,9 +208,9 @@ template<class T> class Stack:
     that gets the next element to be popped off of the stack without actually popping it off.
     */
 
-    virtual void push(const T&) throw (Full, OperationFailed)  = 0;
-    virtual void pop(T&)        throw (Empty, OperationFailed) = 0;
-    virtual void peek(T&) const throw (Empty, OperationFailed) = 0;
+    virtual void push(const T&)  = 0;
+    virtual void pop(T&) = 0;
+    virtual void peek(T&) const = 0;
 };
 
 // ============================================================================================
@@ -226,9 +226,9 @@ template<class T> class DStack:
          DStack()
            {return;}
 
-    virtual void push(const T&) throw (Full, OperationFailed);
-    virtual void pop(T&)        throw (Empty, OperationFailed);
-    virtual void peek(T&) const throw (Empty, OperationFailed);
+    virtual void push(const T&);
+    virtual void pop(T&);
+    virtual void peek(T&) const;
 };
 
 #endif
\ No newline at end of file
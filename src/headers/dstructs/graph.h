@@ -0,0 +1,1153 @@
+#ifndef DSTRUCTS_GRAPH_H
+#define DSTRUCTS_GRAPH_H
+
+// ============================================================================================
+//
+// graph.h -- Compressed Sparse Row Graph Template Class
+//
+// ============================================================================================
+
+/*
+This class is a directed graph stored in compressed sparse row (CSR) form.  A "Graph" is a
+"DataStructure" of its vertices' data.
+
+Vertices are numbered from 0 to "numVertices() - 1".  Each vertex has a "VertexData" and each
+edge has an "EdgeData" (use an empty class if there's nothing to store).  An undirected graph
+is a directed graph with an edge each way.
+
+A "Graph" can't be changed once it's built.  It's built from a "Graph::Builder", which is an
+ordinary, changeable list of vertices and edges:
+
+  Graph<Module, Dependency>::Builder builder;
+  const unsigned int                 parser = builder.addVertex(Module("parser"));
+  const unsigned int                 lexer  = builder.addVertex(Module("lexer"));
+
+  builder.addEdge(parser, lexer, Dependency(Dependency::STATIC));
+
+  const Graph<Module, Dependency> graph(builder);
+
+A vertex's out-neighbours (and the data of the edges to them) come back as a "Span" -- a pair
+of pointers into one contiguous block -- so that a loop over them is a loop over an array:
+
+  for (const unsigned int neighbour : graph.neighbours(vertex))
+    ...
+
+The out-neighbours are in the order that their edges were added to the builder.  A vertex's
+in-neighbours are available the same way, through "inNeighbours()".
+
+"breadthFirstSearch()" finds how many edges away from a source vertex every vertex is, on as
+many threads as it's asked to.
+
+The element iterators and "iterator()" visit the vertices' data in vertex order.
+
+The no. of vertices and the no. of edges must each be less than "UNREACHED".
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+CSR keeps the graph in a handful of flat arrays instead of a list of edges per vertex:
+
+  _offsets    "numVertices() + 1" entries; vertex "v's" edges are entries "_offsets[v]" up to
+              (but not including) "_offsets[v + 1]" of the next two arrays
+  _targets    the vertex that each edge goes to
+  _edgeData   each edge's data, in the same order as "_targets"
+
+plus "_inOffsets" and "_sources", the same thing for the reversed graph (without the edge
+data).  The targets are kept apart from the edge data so that a traversal, which only needs the
+targets, reads 4 bytes per edge and nothing else.  Each array is aligned to a cache line.
+
+The builder's edges are sorted into CSR order with a counting sort:  count each vertex's edges,
+turn the counts into offsets with a running sum, then drop each edge into the next free entry
+of its vertex.  That's O(V + E) and keeps each vertex's edges in the order they were added.
+The edge data are then copy-constructed in order, so that a copy that fails leaves a known run
+of constructed elements to destroy; nothing is kept unless the whole graph is built.
+
+"breadthFirstSearch()" is level-synchronous:  every vertex at depth "d" is found before any at
+depth "d + 1".  Each level is one of two kinds of step, run on every thread at once:
+
+  top-down   each vertex in the frontier (the vertices found at the last level) checks its
+             out-neighbours and claims the unreached ones with a compare-and-swap on their
+             depths.  The work is proportional to the no. of edges out of the frontier.
+
+  bottom-up  each unreached vertex checks its in-neighbours against a bitmap of the frontier
+             and stops at the first one that's in it.  No atomic operations are needed,
+             because each vertex is only ever looked at by one thread.  The work is
+             proportional to the no. of edges into the unreached vertices -- but it stops
+             early so often that when the frontier is large it's much less than a top-down
+             step's.
+
+The search starts top-down, switches to bottom-up once the edges out of the frontier are more
+than 1/"ALPHA" of the edges into the unreached vertices, and switches back once the frontier is
+shrinking and holds less than 1/"BETA" of the vertices (Beamer, Asanovic & Patterson's
+direction-optimizing BFS).
+
+The threads take chunks of work from a shared atomic cursor, so a thread that gets a few
+high-degree vertices doesn't hold up the others.  Each thread keeps its own list of the
+vertices it finds, so the frontier is a list of lists; a bottom-up step also writes the next
+frontier's bitmap, one 64-vertex word per store, and since every word is written by the thread
+that owns that chunk of vertices there's no contention.  Switching to bottom-up turns the lists
+into a bitmap on one thread, which takes O(V / 64 + frontier) time but only happens once or
+twice per search.
+
+The threads meet at a barrier at the end of each level, where one of them adds up the counts,
+swaps the frontiers and picks the next step's direction.  The calling thread is one of the
+threads, so a search on one thread doesn't start any.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <limits.h>
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dstructs/darray.h>
+#include <dstructs/datastructure.h>
+
+// ============================================================================================
+// GRAPH<VERTEXDATA, EDGEDATA> CLASS DECLARATION
+// ============================================================================================
+
+template<class VertexData, class EdgeData> class Graph:
+  virtual public DataStructureExceptions,
+  virtual public DataStructure<VertexData>
+{
+  public:
+    static constexpr size_t       CACHE_LINE_SIZE = 64U;
+    static constexpr unsigned int UNREACHED       = UINT_MAX;   // an unreached vertex's depth
+
+    // Edges
+
+    class Edge
+    {
+      public:
+        unsigned int from;
+        unsigned int to;
+        EdgeData     data;
+
+        Edge(const unsigned int initialFrom = 0U, const unsigned int initialTo = 0U,
+          const EdgeData& initialData = EdgeData()):
+          from(initialFrom), to(initialTo), data(initialData) {return;}
+    };
+
+    // Builder
+
+    /*
+    A "Builder" collects vertices and edges in "DArrays".  An edge can only be added between
+    vertices that have already been added.
+    */
+
+    class Builder
+    {
+      public:
+                           Builder() noexcept
+                             {return;}
+                           Builder(const unsigned int);
+
+        const unsigned int numVertices() const noexcept
+                             {return _vertices.numElements();}
+        const unsigned int numEdges() const noexcept
+                             {return _edges.numElements();}
+
+        const unsigned int addVertex(const VertexData& = VertexData());
+        void               addEdge(const unsigned int, const unsigned int,
+                             const EdgeData& = EdgeData());
+        void               reserveEdges(const unsigned int numEdges)
+                             {_edges.reserve(numEdges); return;}
+
+        VertexData&        vertex(const unsigned int vertex)
+                             {return _vertices[vertex];}
+        const VertexData&  vertex(const unsigned int vertex) const
+                             {return _vertices[vertex];}
+
+        void               empty() noexcept
+                             {_vertices.empty(); _edges.empty(); return;}
+
+      private:
+        DArray<VertexData> _vertices;
+        DArray<Edge>       _edges;
+
+        friend class Graph<VertexData, EdgeData>;
+    };
+
+    // Spans
+
+    /*
+    A "Span" is a run of elements in one contiguous block.
+    */
+
+    template<class Element> class Span
+    {
+      public:
+                           Span(Element *const first, Element *const last) noexcept:
+                             _first(first), _last(last) {return;}
+
+        Element*           begin() const noexcept
+                             {return _first;}
+        Element*           end() const noexcept
+                             {return _last;}
+        const unsigned int size() const noexcept
+                             {return (unsigned int)(_last - _first);}
+        const bool         isEmpty() const noexcept
+                             {return _first == _last;}
+        Element&           operator[](const unsigned int index) const noexcept
+                             {assert(index < size()); return _first[index];}
+
+      private:
+        Element* _first;
+        Element* _last;
+    };
+
+                           Graph() noexcept;
+                           Graph(const Builder&);
+    virtual                ~Graph()
+                             {empty(); return;}
+
+    const unsigned int     numVertices() const noexcept
+                             {return this->_numElements;}
+    const unsigned int     numEdges() const noexcept
+                             {return _numEdges;}
+
+    const VertexData&      vertex(const unsigned int vertex) const noexcept
+                             {assert(vertex < numVertices()); return _vertices[vertex];}
+
+    Span<const unsigned int> neighbours(const unsigned int vertex) const noexcept
+                             {
+                               assert(vertex < numVertices());
+                               return Span<const unsigned int>(_targets + _offsets[vertex],
+                                 _targets + _offsets[vertex + 1U]);
+                             }
+    Span<const EdgeData>   edges(const unsigned int vertex) const noexcept
+                             {
+                               assert(vertex < numVertices());
+                               return Span<const EdgeData>(_edgeData + _offsets[vertex],
+                                 _edgeData + _offsets[vertex + 1U]);
+                             }
+    Span<const unsigned int> inNeighbours(const unsigned int vertex) const noexcept
+                             {
+                               assert(vertex < numVertices());
+                               return Span<const unsigned int>(_sources + _inOffsets[vertex],
+                                 _sources + _inOffsets[vertex + 1U]);
+                             }
+
+    const unsigned int     outDegree(const unsigned int vertex) const noexcept
+                             {return _offsets[vertex + 1U] - _offsets[vertex];}
+    const unsigned int     inDegree(const unsigned int vertex) const noexcept
+                             {return _inOffsets[vertex + 1U] - _inOffsets[vertex];}
+
+    const unsigned int     breadthFirstSearch(const unsigned int, unsigned int *const,
+                             const unsigned int = 0U) const;
+
+    // Element iterators
+
+    typedef const VertexData* ElementIterator;
+    typedef const VertexData* ConstElementIterator;
+
+    ConstElementIterator   begin() const noexcept
+                             {return _vertices;}
+    ConstElementIterator   end() const noexcept
+                             {return _vertices + this->_numElements;}
+
+    // DataStructure<VertexData> methods
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<VertexData>::Iterator_ *const iterator() const
+                             {return DataStructure<VertexData>::newIterator(*this);}
+
+    virtual const VertexData *const contiguousElements(bool& isReversed) const noexcept
+                             {
+                               isReversed = false;
+                               return this->_numElements > 0U ? _vertices : NULL;
+                             }
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+    static const unsigned int ALPHA                   = 14U;
+    static const unsigned int BETA                    = 24U;
+    static const unsigned int TOP_DOWN_CHUNK          = 64U;      // vertices per claim
+    static const unsigned int BOTTOM_UP_CHUNK         = 16U;      // bitmap words per claim
+    static const unsigned int MIN_VERTICES_PER_THREAD = 4096U;
+
+    class Search;
+
+    VertexData*    _vertices;
+    unsigned int*  _offsets;                    // "numVertices() + 1" offsets into "_targets"
+    unsigned int*  _targets;
+    EdgeData*      _edgeData;
+    unsigned int*  _inOffsets;                  // "numVertices() + 1" offsets into "_sources"
+    unsigned int*  _sources;
+    unsigned int   _numEdges;
+
+    template<class Element>
+    static Element *const allocate(const size_t);
+    template<class Element>
+    static void    deallocate(Element *const) noexcept;
+
+    Graph(const Graph<VertexData, EdgeData>&);                              // not implemented
+    Graph<VertexData, EdgeData>& operator=(const Graph<VertexData, EdgeData>&);
+                                                                             // not implemented
+};
+
+// ============================================================================================
+// GRAPH<VERTEXDATA, EDGEDATA>::SEARCH CLASS DECLARATION
+// ============================================================================================
+
+/*
+A "Search" is the state of one "breadthFirstSearch()" that all of its threads share.  Each
+thread calls "run()" with its own no.; thread 0 is the calling thread and does the
+bookkeeping between levels.
+*/
+
+template<class VertexData, class EdgeData> class Graph<VertexData, EdgeData>::Search
+{
+  public:
+                 Search(const Graph<VertexData, EdgeData>&, const unsigned int,
+                   const unsigned int);
+
+    void         start(const unsigned int) noexcept;
+    void         run(const unsigned int) noexcept;
+
+    const bool   hasFailed() const noexcept
+                   {return _hasFailed.load(std::memory_order_relaxed);}
+    const unsigned int numReached() const noexcept
+                   {return _numReached;}
+    const unsigned int depth(const unsigned int vertex) const noexcept
+                   {return _depths[vertex].load(std::memory_order_relaxed);}
+
+  private:
+
+    /*
+    A "Barrier" holds each thread that calls "wait()" until all of them have.
+    */
+
+    class Barrier
+    {
+      public:
+                   Barrier():
+                     _count(0U), _numWaiting(0U), _generation(0U) {return;}
+
+        void       setCount(const unsigned int count) noexcept
+                     {_count = count; return;}
+        void       wait();
+
+      private:
+        std::mutex              _mutex;
+        std::condition_variable _condition;
+        unsigned int            _count;                // the no. of threads that must wait
+        unsigned int            _numWaiting;
+        unsigned int            _generation;           // bumped each time they're released
+    };
+
+    /*
+    Each thread's list of the vertices it found, and what it's counted about them.  Each is
+    on its own cache lines so that the threads' counters don't share a line.
+    */
+
+    class alignas(CACHE_LINE_SIZE) ThreadState
+    {
+      public:
+        std::vector<unsigned int> frontier;     // this thread's share of the frontier
+        std::vector<unsigned int> next;         // the vertices it's found on this level
+        unsigned long long        outEdges;     // the out-degrees of "next" added up
+        unsigned long long        inEdges;      // the in-degrees of "next" added up
+    };
+
+    const Graph<VertexData, EdgeData>&      _graph;
+    const unsigned int                      _source;
+    const unsigned int                      _numWords;         // 64-bit words in a bitmap
+    unsigned int                            _numThreads;
+    std::vector<std::atomic<unsigned int> > _depths;
+    std::vector<unsigned long long>         _frontierBits;     // valid when "_isBottomUp"
+    std::vector<unsigned long long>         _nextBits;
+    std::vector<ThreadState>                _threads;
+    std::vector<unsigned int>               _frontierStarts;   // running sums of the lists
+    std::atomic<unsigned int>               _cursor;           // the next chunk to claim
+    std::atomic<bool>                       _hasFailed;
+    Barrier                                 _barrier;
+    std::mutex                              _startMutex;
+    std::condition_variable                 _startCondition;
+    bool                                    _isStarted;
+    bool                                    _isBottomUp;
+    bool                                    _isDone;
+    unsigned int                            _level;
+    unsigned int                            _frontierSize;
+    unsigned int                            _numReached;
+    unsigned long long                      _unreachedEdges;   // edges into unreached vertices
+
+    void         topDownStep(ThreadState&) noexcept;
+    void         bottomUpStep(ThreadState&) noexcept;
+    void         finishLevel() noexcept;
+    void         makeFrontierBits() noexcept;
+
+    const unsigned int sliceStart(const unsigned int thread) const noexcept
+                   {return (unsigned int)((unsigned long long)_graph.numVertices() * thread /
+                      _numThreads);}
+};
+
+// ============================================================================================
+// GRAPH<VERTEXDATA, EDGEDATA>::BUILDER METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData> Graph<VertexData, EdgeData>::Builder::Builder
+(
+  const unsigned int numVertices                      // the no. of vertices to start with
+)
+
+/*
+This constructor instanciates a builder with "numVertices" vertices, numbered from 0, each with
+default-constructed data, and no edges.
+*/
+
+{
+  _vertices.reserve(numVertices);
+
+  while (_vertices.numElements() < numVertices)
+    _vertices.emplace();
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+const unsigned int Graph<VertexData, EdgeData>::Builder::addVertex
+(
+  const VertexData& data                              // the new vertex's data
+)
+
+/*
+This method adds a vertex and returns its no.
+*/
+
+{
+  if (_vertices.numElements() == UNREACHED - 1U)
+    throw Full(__FILE__, __LINE__);
+
+  _vertices.append(data);
+  return _vertices.numElements() - 1U;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData> void Graph<VertexData, EdgeData>::Builder::addEdge
+(
+  const unsigned int from,                            // the vertex that the edge leaves
+  const unsigned int to,                              // the vertex that the edge goes to
+  const EdgeData&    data                             // the edge's data
+)
+
+/*
+This method adds an edge from vertex "from" to vertex "to".  Both must already have been added
+-- otherwise, "OperationFailed" is thrown.
+*/
+
+{
+  if (from >= _vertices.numElements() || to >= _vertices.numElements())
+    throw OperationFailed("There's no such vertex in the graph.", __FILE__, __LINE__);
+
+  if (_edges.numElements() == UNREACHED - 1U)
+    throw Full(__FILE__, __LINE__);
+
+  _edges.emplace(from, to, data);
+  return;
+}
+
+// ============================================================================================
+// GRAPH<VERTEXDATA, EDGEDATA> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData> Graph<VertexData, EdgeData>::Graph() noexcept:
+
+/*
+This constructor instanciates a graph with no vertices.
+*/
+
+  _vertices(NULL),
+  _offsets(NULL),
+  _targets(NULL),
+  _edgeData(NULL),
+  _inOffsets(NULL),
+  _sources(NULL),
+  _numEdges(0U)
+
+{
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData> Graph<VertexData, EdgeData>::Graph
+(
+  const Builder& builder                              // the vertices and edges
+):
+
+/*
+This constructor builds a graph from "builder's" vertices and edges in O(V + E) time.  The
+builder isn't changed, so it can be changed further and built again.
+
+PRECONDITIONS:
+There must be enough memory for the graph -- otherwise, "Full" will be thrown.  If a vertex's
+or an edge's data can't be copied then "OperationFailed" will be thrown.
+
+POSTCONDITIONS:
+The graph holds copies of "builder's" vertices and edges.
+*/
+
+  _vertices(NULL),
+  _offsets(NULL),
+  _targets(NULL),
+  _edgeData(NULL),
+  _inOffsets(NULL),
+  _sources(NULL),
+  _numEdges(0U)
+
+{
+  const unsigned int  numVertices = builder._vertices.numElements();
+  const unsigned int  numEdges    = builder._edges.numElements();
+  const Edge *const   edges       = builder._edges.begin();
+  unsigned int*       order(NULL);                 // the builder's edges in CSR order
+  bool                isAllocated(false);
+  unsigned int        numVerticesMade(0U);
+  unsigned int        numEdgesMade(0U);
+
+  try
+  {
+    _offsets   = allocate<unsigned int>(numVertices + 1U);
+    _inOffsets = allocate<unsigned int>(numVertices + 1U);
+    _targets   = allocate<unsigned int>(numEdges);
+    _sources   = allocate<unsigned int>(numEdges);
+    _edgeData  = allocate<EdgeData>(numEdges);
+    _vertices  = allocate<VertexData>(numVertices);
+    order      = allocate<unsigned int>(numEdges);
+    isAllocated = true;
+
+    /*
+    The counting sort:  count, then a running sum (shifted by one so that "_offsets[v]" ends
+    up as the first free entry of vertex "v"), then place, which leaves "_offsets[v]" at the
+    end of vertex "v" -- where vertex "v + 1" starts -- so it's shifted back.
+    */
+
+    std::fill(_offsets, _offsets + numVertices + 1U, 0U);
+    std::fill(_inOffsets, _inOffsets + numVertices + 1U, 0U);
+
+    for (unsigned int edge = 0U; edge < numEdges; ++edge)
+    {
+      ++_offsets[edges[edge].from + 1U];
+      ++_inOffsets[edges[edge].to + 1U];
+    }
+
+    for (unsigned int vertex = 1U; vertex <= numVertices; ++vertex)
+    {
+      _offsets[vertex]   += _offsets[vertex - 1U];
+      _inOffsets[vertex] += _inOffsets[vertex - 1U];
+    }
+
+    for (unsigned int edge = 0U; edge < numEdges; ++edge)
+    {
+      const unsigned int position = _offsets[edges[edge].from]++;
+
+      _targets[position] = edges[edge].to;
+      order[position]    = edge;
+      _sources[_inOffsets[edges[edge].to]++] = edges[edge].from;
+    }
+
+    for (unsigned int vertex = numVertices; vertex > 0U; --vertex)
+    {
+      _offsets[vertex]   = _offsets[vertex - 1U];
+      _inOffsets[vertex] = _inOffsets[vertex - 1U];
+    }
+
+    _offsets[0]   = 0U;
+    _inOffsets[0] = 0U;
+
+    for (; numEdgesMade < numEdges; ++numEdgesMade)
+      new(_edgeData + numEdgesMade) EdgeData(edges[order[numEdgesMade]].data);
+
+    for (; numVerticesMade < numVertices; ++numVerticesMade)
+      new(_vertices + numVerticesMade) VertexData(builder._vertices[numVerticesMade]);
+  }
+  catch (...)
+  {
+    for (unsigned int i = 0U; i < numEdgesMade; ++i)
+      _edgeData[i].~EdgeData();
+
+    for (unsigned int i = 0U; i < numVerticesMade; ++i)
+      _vertices[i].~VertexData();
+
+    deallocate(order);
+    deallocate(_vertices);
+    deallocate(_edgeData);
+    deallocate(_sources);
+    deallocate(_targets);
+    deallocate(_inOffsets);
+    deallocate(_offsets);
+
+    if (!isAllocated)
+      throw Full(__FILE__, __LINE__);
+
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  deallocate(order);
+
+  _numEdges          = numEdges;
+  this->_numElements = numVertices;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+const unsigned int Graph<VertexData, EdgeData>::breadthFirstSearch
+(
+  const unsigned int  source,                         // the vertex to search from
+  unsigned int *const depths,                         // gets each vertex's depth
+  const unsigned int  numThreads                      // 0 to use every hardware thread
+)
+const
+
+/*
+This method sets "depths[v]" to the fewest edges on a path from "source" to each vertex "v", or
+to "UNREACHED" if there's no such path, and returns the no. of vertices reached (including
+"source").
+
+The search runs on up to "numThreads" threads -- the calling thread and "numThreads - 1" more
+-- or on as many as the hardware has if "numThreads" is 0.  No more than one thread per
+"MIN_VERTICES_PER_THREAD" vertices is used, since below that a thread costs more to start
+than it saves.  If a thread can't be started then the search goes ahead on the ones that were.
+
+PRECONDITIONS:
+"source" must be a vertex in the graph -- otherwise, "OperationFailed" will be thrown.
+"depths" must have room for "numVertices()" elements.  There must be enough memory for the
+search's working storage (4 bytes per vertex, plus 4 for each vertex in the two largest levels)
+-- otherwise, "Full" will be thrown.
+
+POSTCONDITIONS:
+"depths" holds every vertex's depth.
+*/
+
+{
+  if (source >= numVertices())
+    throw OperationFailed("There's no such vertex in the graph.", __FILE__, __LINE__);
+
+  assert(depths != NULL);
+
+  unsigned int maxThreads = numThreads > 0U ? numThreads : std::thread::hardware_concurrency();
+
+  maxThreads = std::max(1U, std::min(maxThreads, numVertices() / MIN_VERTICES_PER_THREAD));
+
+  try
+  {
+    Search                   search(*this, source, maxThreads);
+    std::vector<std::thread> threads;
+
+    threads.reserve(maxThreads - 1U);
+
+    try
+    {
+      while (threads.size() + 1U < maxThreads)
+        threads.emplace_back(&Search::run, &search, (unsigned int)threads.size() + 1U);
+    }
+    catch (const std::system_error&)
+    {
+    }
+
+    search.start((unsigned int)threads.size() + 1U);
+    search.run(0U);
+
+    for (unsigned int i = 0U; i < threads.size(); ++i)
+      threads[i].join();
+
+    if (search.hasFailed())
+      throw Full(__FILE__, __LINE__);
+
+    for (unsigned int vertex = 0U; vertex < numVertices(); ++vertex)
+      depths[vertex] = search.depth(vertex);
+
+    return search.numReached();
+  }
+  catch (const std::bad_alloc&)
+  {
+    throw Full(__FILE__, __LINE__);
+  }
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData> void Graph<VertexData, EdgeData>::empty() noexcept
+
+/*
+This method removes every vertex and edge.
+*/
+
+{
+  if constexpr (!std::is_trivially_destructible<EdgeData>::value)
+  {
+    for (unsigned int edge = 0U; edge < _numEdges; ++edge)
+      _edgeData[edge].~EdgeData();
+  }
+
+  if constexpr (!std::is_trivially_destructible<VertexData>::value)
+  {
+    for (unsigned int vertex = 0U; vertex < this->_numElements; ++vertex)
+      _vertices[vertex].~VertexData();
+  }
+
+  deallocate(_vertices);
+  deallocate(_edgeData);
+  deallocate(_sources);
+  deallocate(_targets);
+  deallocate(_inOffsets);
+  deallocate(_offsets);
+
+  _vertices          = NULL;
+  _offsets           = NULL;
+  _targets           = NULL;
+  _edgeData          = NULL;
+  _inOffsets         = NULL;
+  _sources           = NULL;
+  _numEdges          = 0U;
+  this->_numElements = 0U;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class VertexData, class EdgeData>
+  void Graph<VertexData, EdgeData>::assertInvariants() const noexcept
+
+  {
+    assert((_offsets == NULL) == (_inOffsets == NULL));
+    assert(_offsets == NULL || _offsets[this->_numElements] == _numEdges);
+    assert(_inOffsets == NULL || _inOffsets[this->_numElements] == _numEdges);
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData> template<class Element>
+Element *const Graph<VertexData, EdgeData>::allocate
+(
+  const size_t count                                  // the no. of elements
+)
+
+/*
+This function returns uninitialized, cache-line-aligned storage for "count" elements, or NULL
+if "count" is 0.  "Full" is thrown if there isn't enough memory.
+*/
+
+{
+  if (count == 0U)
+    return NULL;
+
+  const size_t alignment = (alignof(Element) > CACHE_LINE_SIZE ? alignof(Element) :
+                            CACHE_LINE_SIZE);
+  void *const  block     = ::operator new(sizeof(Element) * count, std::align_val_t(alignment),
+                                          std::nothrow);
+
+  if (block == NULL)
+    throw Full(__FILE__, __LINE__);
+
+  return static_cast<Element*>(block);
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData> template<class Element>
+inline void Graph<VertexData, EdgeData>::deallocate
+(
+  Element *const block                                // a block from "allocate()", or NULL
+)
+noexcept
+
+{
+  if (block != NULL)
+    ::operator delete(block, std::align_val_t(alignof(Element) > CACHE_LINE_SIZE ?
+      alignof(Element) : CACHE_LINE_SIZE));
+
+  return;
+}
+
+// ============================================================================================
+// GRAPH<VERTEXDATA, EDGEDATA>::SEARCH METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData> Graph<VertexData, EdgeData>::Search::Search
+(
+  const Graph<VertexData, EdgeData>& graph,           // the graph to search
+  const unsigned int                 source,          // the vertex to search from
+  const unsigned int                 maxThreads       // the most threads that will run
+):
+
+/*
+This constructor allocates the working storage.  "std::bad_alloc" is passed on if there isn't
+enough memory.
+*/
+
+  _graph(graph),
+  _source(source),
+  _numWords((graph.numVertices() + 63U) / 64U),
+  _numThreads(maxThreads),
+  _depths(graph.numVertices()),
+  _frontierBits(_numWords),
+  _nextBits(_numWords),
+  _threads(maxThreads),
+  _frontierStarts(maxThreads + 1U),
+  _cursor(0U),
+  _hasFailed(false),
+  _isStarted(false),
+  _isBottomUp(false),
+  _isDone(false),
+  _level(0U),
+  _frontierSize(1U),
+  _numReached(1U),
+  _unreachedEdges(graph.numEdges() - graph.inDegree(source))
+
+{
+  _threads[0].frontier.push_back(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+void Graph<VertexData, EdgeData>::Search::start
+(
+  const unsigned int numThreads                       // the no. of threads that will run
+)
+noexcept
+
+/*
+This method lets the threads that are waiting in "run()" go, once it's known how many of them
+were started.
+*/
+
+{
+  {
+    const std::lock_guard<std::mutex> lock(_startMutex);
+
+    _numThreads = numThreads;
+    _barrier.setCount(numThreads);
+
+    _frontierStarts[0] = 0U;
+    std::fill(_frontierStarts.begin() + 1, _frontierStarts.begin() + numThreads + 1U, 1U);
+
+    _isStarted = true;
+  }
+
+  _startCondition.notify_all();
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+void Graph<VertexData, EdgeData>::Search::run
+(
+  const unsigned int thread                           // this thread's no.
+)
+noexcept
+
+/*
+This method is one thread's part of the search.  Each thread first initializes its slice of
+the depths; after that, every level is a step on every thread, then bookkeeping on thread 0.
+*/
+
+{
+  {
+    std::unique_lock<std::mutex> lock(_startMutex);
+
+    _startCondition.wait(lock, [this]{return _isStarted;});
+  }
+
+  for (unsigned int vertex = sliceStart(thread); vertex < sliceStart(thread + 1U); ++vertex)
+    _depths[vertex].store(vertex == _source ? 0U : UNREACHED, std::memory_order_relaxed);
+
+  _barrier.wait();
+
+  while (!_isDone)
+  {
+    ThreadState& state = _threads[thread];
+
+    state.next.clear();
+    state.outEdges = 0U;
+    state.inEdges  = 0U;
+
+    if (_isBottomUp)
+      bottomUpStep(state);
+    else
+      topDownStep(state);
+
+    _barrier.wait();
+
+    if (thread == 0U)
+      finishLevel();
+
+    _barrier.wait();
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+void Graph<VertexData, EdgeData>::Search::topDownStep
+(
+  ThreadState& state                                  // this thread's state
+)
+noexcept
+
+/*
+This method claims chunks of the frontier (which is every thread's list, end to end) and
+claims each unreached out-neighbour of each vertex in them.
+*/
+
+{
+  const unsigned int nextDepth = _level + 1U;
+  const unsigned int total     = _frontierStarts[_numThreads];
+
+  try
+  {
+    for (;;)
+    {
+      const unsigned int first = _cursor.fetch_add(TOP_DOWN_CHUNK, std::memory_order_relaxed);
+
+      if (first >= total)
+        break;
+
+      const unsigned int last = std::min(first + TOP_DOWN_CHUNK, total);
+      unsigned int       list(0U);
+
+      for (unsigned int i = first; i < last; ++i)
+      {
+        while (i >= _frontierStarts[list + 1U])
+          ++list;
+
+        const unsigned int vertex = _threads[list].frontier[i - _frontierStarts[list]];
+
+        for (const unsigned int neighbour : _graph.neighbours(vertex))
+        {
+          unsigned int expected = _depths[neighbour].load(std::memory_order_relaxed);
+
+          if (expected == UNREACHED && _depths[neighbour].compare_exchange_strong(expected,
+            nextDepth, std::memory_order_relaxed))
+          {
+            state.next.push_back(neighbour);
+            state.outEdges += _graph.outDegree(neighbour);
+            state.inEdges  += _graph.inDegree(neighbour);
+          }
+        }
+      }
+    }
+  }
+  catch (...)
+  {
+    _hasFailed.store(true, std::memory_order_relaxed);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+void Graph<VertexData, EdgeData>::Search::bottomUpStep
+(
+  ThreadState& state                                  // this thread's state
+)
+noexcept
+
+/*
+This method claims chunks of the bitmap words and, for each unreached vertex in them, looks for
+an in-neighbour in the frontier.  It writes every word of the next frontier's bitmap in the
+chunks that it claims.
+*/
+
+{
+  const unsigned int nextDepth   = _level + 1U;
+  const unsigned int numVertices = _graph.numVertices();
+
+  try
+  {
+    for (;;)
+    {
+      const unsigned int first = _cursor.fetch_add(BOTTOM_UP_CHUNK, std::memory_order_relaxed);
+
+      if (first >= _numWords)
+        break;
+
+      const unsigned int last = std::min(first + BOTTOM_UP_CHUNK, _numWords);
+
+      for (unsigned int word = first; word < last; ++word)
+      {
+        const unsigned int end = std::min(64U * word + 64U, numVertices);
+        unsigned long long bits(0U);
+
+        for (unsigned int vertex = 64U * word; vertex < end; ++vertex)
+        {
+          if (_depths[vertex].load(std::memory_order_relaxed) != UNREACHED)
+            continue;
+
+          for (const unsigned int neighbour : _graph.inNeighbours(vertex))
+          {
+            if ((_frontierBits[neighbour / 64U] >> (neighbour % 64U)) & 1U)
+            {
+              _depths[vertex].store(nextDepth, std::memory_order_relaxed);
+              bits |= 1ULL << (vertex % 64U);
+              state.next.push_back(vertex);
+              state.outEdges += _graph.outDegree(vertex);
+              state.inEdges  += _graph.inDegree(vertex);
+              break;
+            }
+          }
+        }
+
+        _nextBits[word] = bits;
+      }
+    }
+  }
+  catch (...)
+  {
+    _hasFailed.store(true, std::memory_order_relaxed);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+void Graph<VertexData, EdgeData>::Search::finishLevel() noexcept
+
+/*
+This method (run on thread 0 while the others wait) adds up what the threads found, makes the
+vertices they found the new frontier and picks the direction of the next step.
+*/
+
+{
+  unsigned int       frontierSize(0U);
+  unsigned long long frontierEdges(0U);
+
+  for (unsigned int thread = 0U; thread < _numThreads; ++thread)
+  {
+    ThreadState& state = _threads[thread];
+
+    _frontierStarts[thread] = frontierSize;
+    frontierSize           += (unsigned int)state.next.size();
+    frontierEdges          += state.outEdges;
+    _unreachedEdges        -= state.inEdges;
+
+    state.frontier.swap(state.next);
+  }
+
+  _frontierStarts[_numThreads] = frontierSize;
+
+  if (_isBottomUp)
+    _frontierBits.swap(_nextBits);
+
+  ++_level;
+  _numReached += frontierSize;
+  _cursor.store(0U, std::memory_order_relaxed);
+
+  if (frontierSize == 0U || hasFailed())
+  {
+    _isDone = true;
+    return;
+  }
+
+  if (!_isBottomUp)
+  {
+    if (frontierEdges > _unreachedEdges / ALPHA)
+    {
+      makeFrontierBits();
+      _isBottomUp = true;
+    }
+  }
+  else if (frontierSize < _frontierSize && frontierSize < _graph.numVertices() / BETA)
+    _isBottomUp = false;
+
+  _frontierSize = frontierSize;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+void Graph<VertexData, EdgeData>::Search::makeFrontierBits() noexcept
+
+/*
+This method sets the frontier's bitmap from the threads' lists.
+*/
+
+{
+  std::fill(_frontierBits.begin(), _frontierBits.end(), 0U);
+
+  for (unsigned int thread = 0U; thread < _numThreads; ++thread)
+  {
+    const std::vector<unsigned int>& frontier = _threads[thread].frontier;
+
+    for (unsigned int i = 0U; i < frontier.size(); ++i)
+      _frontierBits[frontier[i] / 64U] |= 1ULL << (frontier[i] % 64U);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class VertexData, class EdgeData>
+void Graph<VertexData, EdgeData>::Search::Barrier::wait()
+
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  const unsigned int           generation = _generation;
+
+  if (++_numWaiting == _count)
+  {
+    _numWaiting = 0U;
+    ++_generation;
+    _condition.notify_all();
+  }
+  else
+    _condition.wait(lock, [this, generation]{return _generation != generation;});
+
+  return;
+}
+
+#endif
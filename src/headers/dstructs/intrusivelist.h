@@ -0,0 +1,575 @@
+#ifndef DSTRUCTS_INTRUSIVELIST_H
+#define DSTRUCTS_INTRUSIVELIST_H
+
+// ============================================================================================
+//
+// intrusivelist.h -- Intrusive Doubly-Linked List Template Class
+//
+// ============================================================================================
+
+/*
+This class is an intrusive doubly-linked list:  a list of objects that already exist somewhere
+else, linked through a "ListHook" that each object carries.  An "IntrusiveList" is a
+"DataStructure".
+
+Every other list in this library copies its elements into nodes of its own.  An
+"IntrusiveList" doesn't -- the links are in the objects themselves, so adding an object to a
+list, removing it and moving it between lists never allocate, copy or destroy anything and
+can't fail.  The list doesn't own its objects:  it only links and unlinks them, and it's up to
+the caller to keep each object alive (and unmoved) for as long as it's in a list.
+
+A class is made listable by deriving it from "ListHook<Tag>" once for each list that its
+objects can be in at the same time.  "Tag" is any type (it doesn't even have to be defined)
+that tells the hooks apart:
+
+  struct ByAge;
+  struct ByHost;
+
+  class Connection:
+    public ListHook<ByAge>,
+    public ListHook<ByHost>
+  {
+    ...
+  };
+
+  IntrusiveList<Connection, ByAge>  connectionsByAge;
+  IntrusiveList<Connection, ByHost> connectionsOnHost;
+
+  connectionsByAge.pushBack(connection);
+  connectionsOnHost.pushBack(connection);
+  ...
+  connectionsByAge.remove(connection);               // no search, no deallocation
+
+An object is in at most one list per tag -- "ListHook<Tag>::isLinked()" tells whether it's in
+one.  Since an object knows where it is in its list, "remove()", "moveToFront()" and
+"moveToBack()" take the object itself, and "iteratorTo()" gives an iterator at it.
+
+Copying an object doesn't copy its list memberships:  a copy's hooks start out unlinked, and
+assigning an object leaves the destination's memberships as they were.  In a debug build, a
+"ListHook" asserts that it isn't linked when it's destroyed, which catches objects that are
+destroyed while still in a list.
+
+An "IntrusiveList" can't be copied or assigned (its objects can't be in two lists through the
+same hook).  Destroying or emptying it unlinks its objects but leaves them alone otherwise.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+The list is circular around a sentinel hook in the list object, as in "DDoublyLinkedList", so
+linking and unlinking never check for the ends of the list.
+
+A hook is a base class rather than a data member so that getting from a hook back to its
+object is a "static_cast" (which the compiler knows the offset for), with no pointer arithmetic
+on member offsets.  Deriving from several "ListHook"s with different tags puts several pairs of
+links in the object, one for each list.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <iterator>
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/datastru.h>
+#else
+  #include <dstructs/datastructure.h>
+#endif
+
+// ============================================================================================
+// LISTHOOK<TAG> CLASS DECLARATION
+// ============================================================================================
+
+template<class Tag = void> class ListHook
+{
+  public:
+                   ListHook() noexcept:
+                     _previous(NULL), _next(NULL) {return;}
+                   ListHook(const ListHook<Tag>&) noexcept:
+                     _previous(NULL), _next(NULL) {return;}
+                   ~ListHook() noexcept
+                     {assert(!isLinked()); return;}
+
+    ListHook<Tag>& operator=(const ListHook<Tag>&) noexcept
+                     {return *this;}
+
+    const bool     isLinked() const noexcept
+                     {return _next != NULL;}
+
+  private:
+    ListHook<Tag>* _previous;                  // the previous hook, or NULL if not in a list
+    ListHook<Tag>* _next;                      // the next hook, or NULL if not in a list
+
+    template<class T, class ListTag> friend class IntrusiveList;
+};
+
+// ============================================================================================
+// INTRUSIVELIST<T, TAG> CLASS DECLARATION
+// ============================================================================================
+
+template<class T, class Tag = void> class IntrusiveList:
+  virtual public DataStructureExceptions,
+  virtual public DataStructure<T>
+{
+  protected:
+    typedef ListHook<Tag> Hook;
+
+    static T *const      objectOf(Hook *const hook) noexcept
+                           {return static_cast<T*>(hook);}
+
+  public:
+
+    // Element iterators
+
+    /*
+    "ElementIterator" and "ConstElementIterator" are standard bidirectional iterators.  An
+    "ElementIterator" converts to a "ConstElementIterator", so either can be passed as a
+    position.
+    */
+
+    template<class Element> class HookIterator
+    {
+      public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T                               value_type;
+        typedef ptrdiff_t                       difference_type;
+        typedef Element*                        pointer;
+        typedef Element&                        reference;
+
+                      HookIterator(Hook *const hook = NULL) noexcept:
+                        _hook(hook) {return;}
+                      HookIterator(const HookIterator<T>& source) noexcept:
+                        _hook(source._hook) {return;}
+
+        Element&      operator*() const noexcept
+                        {return *objectOf(_hook);}
+        Element*      operator->() const noexcept
+                        {return objectOf(_hook);}
+        HookIterator& operator++() noexcept
+                        {_hook = _hook->_next; return *this;}
+        HookIterator  operator++(int) noexcept
+                        {const HookIterator old(*this); _hook = _hook->_next; return old;}
+        HookIterator& operator--() noexcept
+                        {_hook = _hook->_previous; return *this;}
+        HookIterator  operator--(int) noexcept
+                        {const HookIterator old(*this); _hook = _hook->_previous; return old;}
+
+        const bool    operator==(const HookIterator& rhs) const noexcept
+                        {return _hook == rhs._hook;}
+        const bool    operator!=(const HookIterator& rhs) const noexcept
+                        {return _hook != rhs._hook;}
+
+      private:
+        Hook* _hook;                              // the current object's hook, or the sentinel
+
+        friend class HookIterator<const T>;
+        friend class IntrusiveList<T, Tag>;
+    };
+
+    typedef HookIterator<T>       ElementIterator;
+    typedef HookIterator<const T> ConstElementIterator;
+
+                         IntrusiveList() noexcept;
+    virtual              ~IntrusiveList();
+
+    ElementIterator      begin() noexcept
+                           {return ElementIterator(_sentinel._next);}
+    ElementIterator      end() noexcept
+                           {return ElementIterator(&_sentinel);}
+    ConstElementIterator begin() const noexcept
+                           {return ConstElementIterator(_sentinel._next);}
+    ConstElementIterator end() const noexcept
+                           {return ConstElementIterator(const_cast<Hook*>(&_sentinel));}
+
+    ElementIterator      iteratorTo(T& object) noexcept
+                           {return ElementIterator(&hookOf(object));}
+    ConstElementIterator iteratorTo(const T& object) const noexcept
+                           {return ConstElementIterator(const_cast<Hook*>(&hookOf(object)));}
+
+    // Linking & unlinking objects
+
+    void                 pushFront(T& object) noexcept
+                           {insert(begin(), object); return;}
+    void                 pushBack(T& object) noexcept
+                           {insert(end(), object); return;}
+    T&                   popFront();
+    T&                   popBack();
+
+    ElementIterator      insert(const ConstElementIterator, T&) noexcept;
+    ElementIterator      remove(const ConstElementIterator) noexcept;
+    void                 remove(T& object) noexcept
+                           {remove(iteratorTo(object)); return;}
+
+    // Moving objects
+
+    void                 moveBefore(const ConstElementIterator, T&) noexcept;
+    void                 moveToFront(T& object) noexcept
+                           {moveBefore(begin(), object); return;}
+    void                 moveToBack(T& object) noexcept
+                           {moveBefore(end(), object); return;}
+    void                 splice(const ConstElementIterator, IntrusiveList<T, Tag>&, T&)
+                           noexcept;
+    void                 splice(const ConstElementIterator, IntrusiveList<T, Tag>&) noexcept;
+
+    // DataStructure<T> methods
+
+    virtual void         empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                           {return DataStructure<T>::newIterator(*this);}
+
+  protected:
+    #ifndef NDEBUG
+      virtual void       assertInvariants() const noexcept;
+    #endif
+
+  private:
+    Hook                 _sentinel;              // the links to the first & last objects
+
+    static Hook&         hookOf(T& object) noexcept
+                           {return static_cast<Hook&>(object);}
+    static const Hook&   hookOf(const T& object) noexcept
+                           {return static_cast<const Hook&>(object);}
+    static void          linkBefore(Hook *const, Hook *const) noexcept;
+    static void          unlink(Hook *const) noexcept;
+
+    IntrusiveList(const IntrusiveList<T, Tag>&);                       // not implemented
+    IntrusiveList<T, Tag>& operator=(const IntrusiveList<T, Tag>&);    // not implemented
+};
+
+// ============================================================================================
+// INTRUSIVELIST<T, TAG> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Tag> IntrusiveList<T, Tag>::IntrusiveList() noexcept
+
+/*
+This constructor instanciates an empty list.
+*/
+
+{
+  _sentinel._previous = &_sentinel;
+  _sentinel._next     = &_sentinel;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag> IntrusiveList<T, Tag>::~IntrusiveList()
+
+/*
+This destructor unlinks every object (refer to "empty()").  The sentinel is unlinked too, so
+that its own destructor doesn't think that it's still in a list.
+*/
+
+{
+  empty();
+
+  _sentinel._previous = NULL;
+  _sentinel._next     = NULL;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag> T& IntrusiveList<T, Tag>::popFront()
+
+/*
+This method unlinks the first object and returns it.
+
+PRECONDITIONS:
+The list cannot be empty.
+*/
+
+{
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  T& object = *objectOf(_sentinel._next);
+
+  remove(begin());
+  return object;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag> T& IntrusiveList<T, Tag>::popBack()
+
+/*
+This method unlinks the last object and returns it.
+
+PRECONDITIONS:
+The list cannot be empty.
+*/
+
+{
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  T& object = *objectOf(_sentinel._previous);
+
+  remove(--end());
+  return object;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag>
+typename IntrusiveList<T, Tag>::ElementIterator IntrusiveList<T, Tag>::insert
+(
+  const ConstElementIterator position,         // the object to link the new one before
+  T&                         object            // the object to link in
+)
+noexcept
+
+/*
+This method links "object" in before "position" ("end()" links it in at the back) and returns
+an iterator at it.
+
+PRECONDITIONS:
+"object" mustn't be in a list through this list's hook.
+*/
+
+{
+  Hook *const hook = &hookOf(object);
+
+  assert(!hook->isLinked());
+
+  linkBefore(position._hook, hook);
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return ElementIterator(hook);
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag>
+typename IntrusiveList<T, Tag>::ElementIterator IntrusiveList<T, Tag>::remove
+(
+  const ConstElementIterator position                  // the object to unlink
+)
+noexcept
+
+/*
+This method unlinks the object at "position" and returns an iterator at the object that
+followed it.  The object itself isn't touched (apart from its hook).
+
+PRECONDITIONS:
+"position" must be at an object in this list (not at "end()").  For "remove(object)", "object"
+must be in this list.
+*/
+
+{
+  assert(position._hook != &_sentinel && position._hook->isLinked());
+
+  Hook *const next = position._hook->_next;
+
+  unlink(position._hook);
+  --this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return ElementIterator(next);
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag> void IntrusiveList<T, Tag>::moveBefore
+(
+  const ConstElementIterator position,         // the object to move the other before
+  T&                         object            // the object to move
+)
+noexcept
+
+/*
+This method moves "object" to before "position" ("end()" moves it to the back).
+
+PRECONDITIONS:
+"object" must be in this list.
+*/
+
+{
+  Hook *const hook = &hookOf(object);
+
+  assert(hook->isLinked());
+
+  if (position._hook != hook && position._hook != hook->_next)
+  {
+    unlink(hook);
+    linkBefore(position._hook, hook);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag> void IntrusiveList<T, Tag>::splice
+(
+  const ConstElementIterator position,         // the object to move the other before
+  IntrusiveList<T, Tag>&     source,           // the list that "object" is in
+  T&                         object            // the object to move
+)
+noexcept
+
+/*
+This method moves "object" from "source" to before "position".  "source" can be this list.
+
+PRECONDITIONS:
+"object" must be in "source".
+*/
+
+{
+  moveBefore(position, object);
+
+  --source._numElements;
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+    source.assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag> void IntrusiveList<T, Tag>::splice
+(
+  const ConstElementIterator position,         // the object to move the others before
+  IntrusiveList<T, Tag>&     source            // the list to move every object from
+)
+noexcept
+
+/*
+This method moves all of "source's" objects to before "position", in order, and leaves
+"source" empty.  It takes constant time.
+
+PRECONDITIONS:
+"source" mustn't be this list.
+*/
+
+{
+  assert(&source != this);
+
+  if (source._numElements > 0U)
+  {
+    Hook *const first = source._sentinel._next;
+    Hook *const last  = source._sentinel._previous;
+
+    first->_previous                 = position._hook->_previous;
+    last->_next                      = position._hook;
+    position._hook->_previous->_next = first;
+    position._hook->_previous        = last;
+    source._sentinel._previous       = &source._sentinel;
+    source._sentinel._next           = &source._sentinel;
+
+    this->_numElements  += source._numElements;
+    source._numElements  = 0U;
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+    source.assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag> void IntrusiveList<T, Tag>::empty() noexcept
+
+/*
+This method unlinks every object.  The objects themselves aren't touched (apart from their
+hooks).
+*/
+
+{
+  for (Hook* hook = _sentinel._next; hook != &_sentinel; )
+  {
+    Hook *const next = hook->_next;
+
+    hook->_previous = NULL;
+    hook->_next     = NULL;
+    hook            = next;
+  }
+
+  _sentinel._previous = &_sentinel;
+  _sentinel._next     = &_sentinel;
+  this->_numElements  = 0U;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T, class Tag> void IntrusiveList<T, Tag>::assertInvariants() const noexcept
+
+  {
+    assert(_sentinel._next->_previous == &_sentinel);
+    assert(_sentinel._previous->_next == &_sentinel);
+    assert((this->_numElements == 0U) == (_sentinel._next == &_sentinel));
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T, class Tag> void IntrusiveList<T, Tag>::linkBefore
+(
+  Hook *const position,                     // the hook to link the other before
+  Hook *const hook                          // the hook to link in
+)
+noexcept
+
+{
+  hook->_previous            = position->_previous;
+  hook->_next                = position;
+  position->_previous->_next = hook;
+  position->_previous        = hook;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Tag> void IntrusiveList<T, Tag>::unlink
+(
+  Hook *const hook                          // the hook to take out of its list
+)
+noexcept
+
+/*
+This function unlinks "hook" from its list and marks it as not linked.
+*/
+
+{
+  hook->_previous->_next = hook->_next;
+  hook->_next->_previous = hook->_previous;
+  hook->_previous        = NULL;
+  hook->_next            = NULL;
+
+  return;
+}
+
+#endif
@@ -10,7 +10,8 @@
 /*
 This class is an abstract data type base class for all linear data structures.
 
-It's completely abstract -- there are no methods and no members.
+It has no data members.  Its one helper, "moveElement()", is shared by the descendents that
+remove elements into a caller's variable, such as stacks and rings.
 */
 
 // ============================================================================================
@@ -19,6 +20,9 @@ It's completely abstract -- there are no methods and no members.
 
 #include <assert.h>
 
+#include <type_traits>
+#include <utility>
+
 #ifdef FAT_FILENAMES
   #include <dstructs/datastru.h>
 #else
@@ -37,6 +41,9 @@ template<class T> class LinearStructure:
 
     LinearStructure<T>& operator=(const DataStructure<T>&);
     LinearStructure<T>& operator+=(const DataStructure<T>&);
+
+  protected:
+    static inline void  moveElement(T&, T&);
 };
 
 // ============================================================================================
@@ -49,7 +56,7 @@ template<class T> LinearStructure<T>& LinearStructure<T>::operator=
 )
 
 {
-  empty();
+  this->empty();
   concatenate(source);
   return *this;
 }
@@ -66,4 +73,34 @@ template<class T> LinearStructure<T>& LinearStructure<T>::operator+=
   return *this;
 }
 
+/*********************************************************************************************/
+
+template<class T> inline void LinearStructure<T>::moveElement
+(
+  T& destination,                                  // the variable to move the element into
+  T& source                                        // the element that's being removed
+)
+
+/*
+This function moves "source" into "destination" if "T's" move assignment operator can't throw
+or if "T" can't be copy-assigned at all; otherwise, it copies "source" into "destination".
+
+Methods that remove an element into a caller's variable (such as "Stack<T>::pop()") use this
+so that removing a heavy "T" doesn't make a deep copy, while still leaving the structure
+unchanged (as far as the caller is concerned) if an exception is thrown -- a move that throws
+halfway through could leave the element half-moved.  The choice is made at compile time, so
+a move-only "T" only needs its move assignment operator (and gets moved even if that can
+throw, since there's nothing else to fall back on).
+*/
+
+{
+  if constexpr (!std::is_copy_assignable<T>::value ||
+    std::is_nothrow_move_assignable<T>::value)
+    destination = std::move(source);
+  else
+    destination = static_cast<const T&>(source);
+
+  return;
+}
+
 #endif
\ No newline at end of file
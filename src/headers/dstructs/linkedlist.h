@@ -24,13 +24,13 @@ template <class T> class LinkedList:
     LinkedList<T>&     operator=(const DataStructure<T>&);
     LinkedList<T>&     operator+=(const DataStructure<T>&);
 
-    virtual void       findFirst() throw (Empty) = 0;
-    virtual void       findNext() throw (Empty, OperationFailed) = 0;
-    virtual T *const   retrieve() throw (Empty) = 0;
-    virtual void       insert(const T&);
-    virtual void       append(const T&);
+    virtual void       findFirst() = 0;
+    virtual void       findNext() = 0;
+    virtual T *const   retrieve() = 0;
+    virtual void       insert(const T&) = 0;
+    virtual void       append(const T&) = 0;
     virtual void       remove() = 0;
-    virtual const bool isLast() const throw (Empty) = 0;
+    virtual const bool isLast() const = 0;
 };
 
 // ============================================================================================
@@ -44,8 +44,12 @@ template<class T> LinkedList<T>& LinkedList<T>::operator=
 )
 
 {
-  empty();
-  concatenate(source);
+  if (&source != this)
+  {
+    this->empty();
+    this->concatenate(source);
+  }
+
   return *this;
 }
 
@@ -57,7 +61,7 @@ template<class T> LinkedList<T>& LinkedList<T>::operator+=
 )
 
 {
-  concatenate(source);
+  this->concatenate(source);
   return *this;
 }
 
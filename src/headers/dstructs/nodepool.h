@@ -0,0 +1,315 @@
+#ifndef DSTRUCTS_NODEPOOL_H
+#define DSTRUCTS_NODEPOOL_H
+
+// ============================================================================================
+//
+// nodepool.h -- Slab Pool for Fixed-Size Nodes
+//
+// ============================================================================================
+
+/*
+A "NodePool" hands out fixed-size blocks of memory ("slots") that dynamicly-allocated data
+structures construct their nodes in.  Slots are carved out of larger blocks of memory
+("chunks"), each of which holds a configurable number of slots.
+
+Released slots aren't returned to the heap.  Instead, they're threaded onto an intrusive free
+list -- the first bytes of a free slot hold a pointer to the next free slot -- and they're
+handed out again before any new chunk is allocated.  Thus, once a data structure has grown to
+its working size, allocating and releasing a node costs a couple of pointer assignments and no
+heap calls at all.
+
+Chunks are only returned to the heap when the pool is destroyed or reset.
+
+A "NodePool" with 0 slots per chunk doesn't pool at all -- every slot is allocated from and
+released to the heap.  That's mainly useful for comparing the pooled and unpooled paths.
+
+A "NodePool" isn't thread-safe.  Each data structure is expected to own its own pool.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <new>
+
+// ============================================================================================
+// NODEPOOL CLASS DECLARATION
+// ============================================================================================
+
+class NodePool
+{
+  public:
+    static const unsigned int DEFAULT_SLOTS_PER_CHUNK = 64U;
+
+                       NodePool(const size_t, const size_t,
+                         const unsigned int = DEFAULT_SLOTS_PER_CHUNK) noexcept;
+                       NodePool(const NodePool&) noexcept;
+                       ~NodePool() noexcept
+                         {freeChunks(); return;}
+
+    const unsigned int slotsPerChunk() const noexcept
+                         {return _slotsPerChunk;}
+    void               reset(const unsigned int) noexcept;
+
+    inline void*       allocate() noexcept;
+    inline void        release(void *const) noexcept;
+
+  private:
+    struct FreeSlot
+    {
+      FreeSlot* next;                                           // next free slot, or NULL
+    };
+
+    struct Chunk
+    {
+      Chunk* next;                                              // next chunk, or NULL
+    };
+
+    size_t       _slotSize;                              // size of each slot, in bytes
+    size_t       _headerSize;                            // size of a chunk header, in bytes
+    unsigned int _slotsPerChunk;                         // no. of slots in each new chunk
+    FreeSlot*    _freeSlots;                             // free list of released slots
+    Chunk*       _chunks;                                // every chunk owned by this pool
+    char*        _unused;                             // next never-used slot in newest chunk
+    char*        _unusedEnd;                             // end of the newest chunk
+
+    #ifndef NDEBUG
+      unsigned int _numOutstanding;                  // no. of slots allocated but not released
+    #endif
+
+    void*              allocateFromNewChunk() noexcept;
+    void               freeChunks() noexcept;
+
+    static const size_t roundUp(const size_t value, const size_t multiple) noexcept
+                          {return (value + multiple - 1U) / multiple * multiple;}
+
+    NodePool& operator=(const NodePool&);                // not implemented
+};
+
+// ============================================================================================
+// NODEPOOL METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+inline NodePool::NodePool
+(
+  const size_t       nodeSize,                            // size of each node, in bytes
+  const size_t       nodeAlignment,                       // alignment that each node needs
+  const unsigned int slotsPerChunk                        // no. of slots in each chunk
+)
+noexcept:
+
+/*
+This constructor creates an empty pool for nodes that are "nodeSize" bytes long and must be
+aligned on an "nodeAlignment"-byte boundary.  No memory is allocated until the first slot is.
+
+PRECONDITIONS:
+"nodeAlignment" must be a power of two no greater than the alignment that "::operator new()"
+guarantees.
+
+POSTCONDITIONS:
+An empty pool is created.
+*/
+
+  _slotSize(roundUp(nodeSize < sizeof(FreeSlot) ? sizeof(FreeSlot) : nodeSize,
+    nodeAlignment < sizeof(FreeSlot*) ? sizeof(FreeSlot*) : nodeAlignment)),
+  _headerSize(roundUp(sizeof(Chunk), nodeAlignment < sizeof(Chunk*) ? sizeof(Chunk*) :
+    nodeAlignment)),
+  _slotsPerChunk(slotsPerChunk),
+  _freeSlots(NULL),
+  _chunks(NULL),
+  _unused(NULL),
+  _unusedEnd(NULL)
+
+  #ifndef NDEBUG
+    , _numOutstanding(0U)
+  #endif
+
+{
+  assert((nodeAlignment & (nodeAlignment - 1U)) == 0U);
+  assert(nodeAlignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+inline NodePool::NodePool
+(
+  const NodePool& source                                      // the pool to copy settings from
+)
+noexcept:
+
+/*
+This constructor creates an empty pool with the same slot size and chunk size as "source".
+Slots are never shared between pools, so none of "source's" memory is copied.
+*/
+
+  _slotSize(source._slotSize),
+  _headerSize(source._headerSize),
+  _slotsPerChunk(source._slotsPerChunk),
+  _freeSlots(NULL),
+  _chunks(NULL),
+  _unused(NULL),
+  _unusedEnd(NULL)
+
+  #ifndef NDEBUG
+    , _numOutstanding(0U)
+  #endif
+
+{
+  return;
+}
+
+/*********************************************************************************************/
+
+inline void NodePool::reset
+(
+  const unsigned int slotsPerChunk                    // no. of slots in each chunk from now on
+)
+noexcept
+
+/*
+This method returns every chunk to the heap and changes the number of slots that each new chunk
+will hold.  0 turns pooling off.
+
+PRECONDITIONS:
+No slot may be outstanding -- that is, every slot that was allocated must have been released.
+
+POSTCONDITIONS:
+The pool owns no memory and new chunks will hold "slotsPerChunk" slots.
+*/
+
+{
+  assert(_numOutstanding == 0U);
+
+  freeChunks();
+  _slotsPerChunk = slotsPerChunk;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+inline void* NodePool::allocate() noexcept
+
+/*
+This method returns an uninitialized slot, or NULL if no memory could be allocated.
+
+Freed slots are reused first, then the unused tail of the newest chunk and only then is a new
+chunk allocated.
+*/
+
+{
+  void* slot;
+
+  if (_freeSlots != NULL)
+  {
+    slot       = _freeSlots;
+    _freeSlots = _freeSlots->next;
+  }
+  else if (_unused != _unusedEnd)
+  {
+    slot     = _unused;
+    _unused += _slotSize;
+  }
+  else if (_slotsPerChunk > 0U)
+    slot = allocateFromNewChunk();
+  else
+    slot = ::operator new(_slotSize, std::nothrow);
+
+  #ifndef NDEBUG
+    if (slot != NULL)
+      ++_numOutstanding;
+  #endif
+
+  return slot;
+}
+
+/*********************************************************************************************/
+
+inline void NodePool::release
+(
+  void *const slot                       // a slot obtained from "allocate()" on this same pool
+)
+noexcept
+
+/*
+This method puts "slot" back on the free list (or back on the heap if pooling is turned off).
+Whatever was constructed in "slot" must already have been destroyed.
+*/
+
+{
+  assert(slot != NULL);
+
+  #ifndef NDEBUG
+    assert(_numOutstanding > 0U);
+    --_numOutstanding;
+  #endif
+
+  if (_slotsPerChunk > 0U)
+  {
+    FreeSlot *const freeSlot = static_cast<FreeSlot*>(slot);
+
+    freeSlot->next = _freeSlots;
+    _freeSlots     = freeSlot;
+  }
+  else
+    ::operator delete(slot);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+inline void* NodePool::allocateFromNewChunk() noexcept
+
+/*
+This method allocates a new chunk, links it into the chunk list and returns its first slot.
+The rest of the chunk's slots are handed out (in order) by subsequent calls to "allocate()".
+*/
+
+{
+  assert(_slotsPerChunk > 0U && _unused == _unusedEnd);
+
+  char *const memory = static_cast<char*>(::operator new(_headerSize + _slotSize *
+    _slotsPerChunk, std::nothrow));
+
+  if (memory == NULL)
+    return NULL;
+
+  Chunk *const chunk = reinterpret_cast<Chunk*>(memory);
+
+  chunk->next = _chunks;
+  _chunks     = chunk;
+
+  _unused    = memory + _headerSize + _slotSize;
+  _unusedEnd = memory + _headerSize + _slotSize * _slotsPerChunk;
+
+  return memory + _headerSize;
+}
+
+/*********************************************************************************************/
+
+inline void NodePool::freeChunks() noexcept
+{
+  while (_chunks != NULL)
+  {
+    Chunk *const chunk = _chunks;
+
+    _chunks = _chunks->next;
+    ::operator delete(chunk);
+  }
+
+  _freeSlots = NULL;
+  _unused    = NULL;
+  _unusedEnd = NULL;
+
+  return;
+}
+
+#endif
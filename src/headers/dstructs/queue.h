@@ -0,0 +1,147 @@
+#ifndef DSTRUCTS_QUEUE_H
+#define DSTRUCTS_QUEUE_H
+
+// ============================================================================================
+//
+// queue.h -- Queue Base Class
+//
+// ============================================================================================
+
+/*
+This class is a base class for queue implementations.  A "Queue" is a "LinearStructure".
+
+Elements are enqueued at one end of a queue (the tail) and dequeued from the other end (the
+head), so they come out in the order that they went in.  For iterations, the element at the
+head -- the next one to be dequeued -- is considered to be the first element in the iteration.
+
+A queue has the same exception contract as a stack:  "enqueue()" throws "Full" if there's no
+room for another element, "dequeue()" and "peek()" throw "Empty" if there are no elements and
+all three throw "OperationFailed" if an element couldn't be copied or moved.
+
+Elements can also be enqueued and dequeued "count" at a time.  The bulk "enqueue()" either
+enqueues all of the elements in a block or none of them; the bulk "dequeue()" dequeues exactly
+"count" elements into a block or throws "Empty" without dequeuing any.  Implementations do
+one capacity check (or one allocation run) and one update of their head or tail for the whole
+block instead of one per element.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <utility>
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/linearst.h>
+#else
+  #include <dstructs/linearstructure.h>
+#endif
+
+// ============================================================================================
+// CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class Queue:
+  virtual public DataStructureExceptions,
+  virtual public LinearStructure<T>
+{
+  public:
+
+    /*
+    There are six public virtual methods:  three "enqueue()" methods, two "dequeue()" methods
+    and "peek()".  "enqueue()" must add elements at the tail and "dequeue()" must remove
+    elements from the head.  "dequeue()" should move the elements out with
+    "LinearStructure<T>::moveElement()" (for the same reasons as a stack's "pop()").  "peek()"
+    must get the next element to be dequeued without dequeuing it.
+
+    As with "Stack<T>", the "emplace()" here constructs a temporary and moves it onto the
+    queue; descendents should hide it with a version that constructs the element in place.
+    */
+
+    virtual void     enqueue(const T&)  = 0;
+    virtual void     enqueue(T&&)  = 0;
+    virtual void     enqueue(const T *const, const unsigned int)  = 0;
+    virtual void     dequeue(T&) = 0;
+    virtual void     dequeue(T *const, const unsigned int) = 0;
+    virtual void     peek(T&) const = 0;
+
+    template<class... Args>
+    inline void      emplace(Args&&...);
+
+    inline Queue<T>& operator<<(const T&);
+    inline Queue<T>& operator<<(T&&);
+    inline Queue<T>& operator>>(T&);
+};
+
+// ============================================================================================
+// METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> inline void Queue<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" and enqueues it by moving a temporary
+with "enqueue(T&&)".
+*/
+
+{
+  enqueue(T(std::forward<Args>(arguments)...));
+  return;
+}
+
+// ============================================================================================
+// CONVENIENCE OPERATORS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> inline Queue<T>& Queue<T>::operator<<
+(
+  const T& elementToEnqueue
+)
+
+/*
+This function makes the shift-in operator work like a "Queue<T>'s" "enqueue()" method (refer
+to "Stack<T>::operator<<()").
+*/
+
+{
+  enqueue(elementToEnqueue);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline Queue<T>& Queue<T>::operator<<
+(
+  T&& elementToEnqueue
+)
+
+{
+  enqueue(std::move(elementToEnqueue));
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline Queue<T>& Queue<T>::operator>>
+(
+  T& dequeuedElement
+)
+
+/*
+This function makes the shift-out operator work like a "Queue<T>'s" "dequeue()" method (refer
+to "Stack<T>::operator>>()").
+*/
+
+{
+  dequeue(dequeuedElement);
+  return *this;
+}
+
+#endif
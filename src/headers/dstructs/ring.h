@@ -0,0 +1,139 @@
+#ifndef DSTRUCTS_RING_H
+#define DSTRUCTS_RING_H
+
+// ============================================================================================
+//
+// ring.h -- Ring Base Class
+//
+// ============================================================================================
+
+/*
+This class is a base class for ring implementations.  A "Ring" is a "LinearStructure".
+
+Elements are pushed in at one end of a ring (the tail) and popped off of the other end (the
+head), so they come out in the order that they went in.  For iterations, the element at the
+head -- the next one to be popped -- is considered to be the first element in the iteration.
+
+As with "Stack", elements can be moved as well as copied onto and off of a ring:  "push(T&&)"
+moves its argument onto the ring, "emplace()" constructs an element on the ring from its
+arguments, and "pop()" moves the popped element into the caller's variable.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <utility>
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/linearst.h>
+#else
+  #include <dstructs/linearstructure.h>
+#endif
+
+// ============================================================================================
+// CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class Ring:
+  virtual public DataStructureExceptions,
+  virtual public LinearStructure<T>
+{
+  public:
+
+    /*
+    There are four public virtual methods:  two "push()" methods, "pop()" and "peek()".
+    "push()" must add an element at the tail and "pop()" must remove the element at the head.
+    "pop()" should move the element out with "LinearStructure<T>::moveElement()" (for the same
+    reasons as a stack's "pop()").  "peek()" must get the next element to be popped without
+    popping it.
+
+    As with "Stack<T>", the "emplace()" here constructs a temporary and moves it onto the ring;
+    descendents should hide it with a version that constructs the element in place.
+    */
+
+    virtual void    push(const T&)  = 0;
+    virtual void    push(T&&)  = 0;
+    virtual void    pop(T&) = 0;
+    virtual void    peek(T&) const = 0;
+
+    template<class... Args>
+    inline void     emplace(Args&&...);
+
+    inline Ring<T>& operator<<(const T&);
+    inline Ring<T>& operator<<(T&&);
+    inline Ring<T>& operator>>(T&);
+};
+
+// ============================================================================================
+// METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> inline void Ring<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" and pushes it onto the tail of the ring
+by moving a temporary with "push(T&&)".
+*/
+
+{
+  push(T(std::forward<Args>(arguments)...));
+  return;
+}
+
+// ============================================================================================
+// CONVENIENCE OPERATORS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> inline Ring<T>& Ring<T>::operator<<
+(
+  const T& elementToPush
+)
+
+/*
+This function makes the shift-in operator work like a "Ring<T>'s" "push()" method (refer to
+"Stack<T>::operator<<()").
+*/
+
+{
+  push(elementToPush);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline Ring<T>& Ring<T>::operator<<
+(
+  T&& elementToPush
+)
+
+{
+  push(std::move(elementToPush));
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline Ring<T>& Ring<T>::operator>>
+(
+  T& poppedElement
+)
+
+/*
+This function makes the shift-out operator work like a "Ring<T>'s" "pop()" method (refer to
+"Stack<T>::operator>>()").
+*/
+
+{
+  pop(poppedElement);
+  return *this;
+}
+
+#endif
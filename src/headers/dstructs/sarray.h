@@ -7,6 +7,23 @@
 //
 // ============================================================================================
 
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+The elements are kept in "SDataStructure's" raw storage.  Every element of an "SArray" exists
+for as long as the "SArray" does, so all of them are constructed by the constructors -- but
+elements that are copied from a source are copy-constructed directly rather than
+default-constructed and then assigned to, and the remaining elements are default-initialized
+the way "new T[size]" would do it (which, for a type like "int", costs nothing at all).
+
+The elements are contiguous and iterated from element 0 up, so "SArray" overrides
+"contiguousElements()" and copies from other contiguous structures a block at a time.  For
+the same reason, its "begin()" and "end()" iterators are plain pointers, and "iterator()" is an
+"IteratorAdaptor" around them -- the array keeps no iteration state of its own.
+*/
+
 // ============================================================================================
 // INCLUDE FILES
 // ============================================================================================
@@ -14,27 +31,34 @@
 #include <assert.h>
 #include <stdarg.h>
 
+#include <algorithm>
+
 #include <sdp.h>
 #include <dstructs/array.h>
+#include <dstructs/sdatastructure.h>
 
 // ============================================================================================
 // CLASS DECLARATIONS
 // ============================================================================================
 
 template <class T> class SArray:
+  virtual public DataStructureExceptions,
+  virtual public SDataStructure<T>,
   virtual public Array<T, unsigned int>
 {
   public:
                            SArray(const unsigned int);
-  	                   SArray(const unsigned int, const LinearStruct<T>&);
+  	                   SArray(const unsigned int, const DataStructure<T>&);
 	                   SArray(const unsigned int, const T *const, const unsigned int);
                            SArray(const unsigned int, const unsigned int, ...);
+    virtual                ~SArray()
+                             {this->destroy(0U, this->_numElements); return;}
 
-    // LinearStruct virtual methods
+    // DataStructure<T> methods
 
-    virtual const bool     isEmpty() const throw ()
+    virtual const bool     isEmpty() const noexcept
                              {return false;}
-    virtual const bool     isFull() const throw ()
+    virtual const bool     isFull() const noexcept
                              {return false;}
     virtual void           empty()
                            {
@@ -43,22 +67,45 @@ template <class T> class SArray:
                              return;
                            }
 
-    virtual void           iterStart() const throw ();
-    virtual const bool     iterMore() const throw ();
-    virtual void           iterNext() const throw (OperationFailed);
-    virtual const T *const iterCurrent() const throw (OperationFailed);
+    // LinearStructure<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&)
+                           {
+                             throw OperationFailed("An SArray can't grow.", __FILE__,
+                               __LINE__);
+                             return;
+                           }
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    virtual const T *const contiguousElements(bool& isReversed) const noexcept
+                             {
+                               isReversed = false;
+                               return this->_numElements > 0U ? this->elements() : NULL;
+                             }
+
+    // Element iterators
+
+    typedef T*             ElementIterator;
+    typedef const T*       ConstElementIterator;
+
+    ElementIterator        begin() noexcept
+                             {return this->elements();}
+    ElementIterator        end() noexcept
+                             {return this->elements() + this->_numElements;}
+    ConstElementIterator   begin() const noexcept
+                             {return this->elements();}
+    ConstElementIterator   end() const noexcept
+                             {return this->elements() + this->_numElements;}
 
     // Array virtual methods
 
-    virtual T&             operator[](const unsigned int);
+    virtual T&             operator[](const unsigned int&);
 
     // Meaningful operators
 
-    SArray<T>&             operator=(const LinearStruct<T>& source);
-
-  private:
-    const SDAP<T>           _elements;                 // array of elements
-    const SDP<unsigned int> _iterCurrent;              // index of current element in iteration
+    SArray<T>&             operator=(const DataStructure<T>& source);
 };
 
 // ============================================================================================
@@ -84,15 +131,12 @@ An array with room for "size" elements is created.  If "T" doesn't have a define
 constructor then the array should be considered to be uninitialized.
 */
 
-  LinearStruct(),
-  _elements((size > 0U) ? new T[size] : NULL),
-  _iterCurrent(new unsigned int)
+  SDataStructure<T>(size)
 
 {
-  if ((_elements == NULL) || (_iterCurrent == NULL))
-    throw ExceptionErrno(ENOMEM, NULL, __FILE__, __LINE__);
+  this->constructDefault(0U, size);
 
-  _numElements = size;
+  this->_numElements = size;
   return;
 }
 
@@ -101,7 +145,7 @@ constructor then the array should be considered to be uninitialized.
 template <class T> SArray<T>::SArray
 (
   const unsigned int   size,      // the number of elements that the array must be able to hold
-  const LinearStruct<T>& source   // linear structure from which elements will be copied
+  const DataStructure<T>& source  // the data structure from which elements will be copied
 ):
 
 /*
@@ -123,23 +167,46 @@ If "T" doesn't have a defined default constructor then the remaining elements sh
 considered to be uninitialized.
 */
 
-  LinearStruct(),
-  _elements((size > 0U) ? new T[size] : NULL),
-  _iterCurrent(new unsigned int)
+  SDataStructure<T>(size)
 
 {
-  if ((_elements == NULL) || (_iterCurrent == NULL))
-    throw ExceptionErrno(ENOMEM, NULL, __FILE__, __LINE__);
-
   if (size < source.numElements())
   {
-    throw ExceptionErrno(EINVAL, "\"size\" can't be less than \"source.numElements()\".",
-      __FILE__, __LINE__);
+    throw OperationFailed("\"size\" can't be less than \"source.numElements()\".", __FILE__,
+      __LINE__);
   }
 
-  _numElements = size;
-  operator=(source);
+  unsigned int   index(0U);                          // index of the next element to construct
+  bool           isReversed;
+  const T *const block = source.contiguousElements(isReversed);
 
+  try
+  {
+    if (block != NULL)
+    {
+      this->constructCopies(0U, block, source.numElements(), isReversed);
+      index = source.numElements();
+    }
+    else
+    {
+      const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+      for (; i->more(); i->next())
+      {
+        this->construct(index, *i->current());
+        ++index;
+      }
+    }
+
+    this->constructDefault(index, size - index);
+  }
+  catch (...)
+  {
+    this->destroy(0U, index);
+    throw;
+  }
+
+  this->_numElements = size;
   return;
 }
 
@@ -171,25 +238,30 @@ If "T" doesn't have a defined default constructor then the remaining elements sh
 considered to be uninitialized.
 */
 
-  LinearStruct(),
-  _elements((size > 0U) ? new T[size] : NULL),
-  _iterCurrent(new unsigned int)
+  SDataStructure<T>(size)
 
 {
-  if ((_elements == NULL) || (_iterCurrent == NULL))
-    throw ExceptionErrno(ENOMEM, NULL, __FILE__, __LINE__);
-
-  if (size < source.numElements())
+  if (size < sourceSize)
   {
-    throw ExceptionErrno(EINVAL, "\"size\" can't be less than \"sourceSize\".", __FILE__,
-      __LINE__);
+    throw OperationFailed("\"size\" can't be less than \"sourceSize\".", __FILE__, __LINE__);
   }
 
-  _numElements = size;
+  unsigned int i(0U);
 
-  for (unsigned int i = 0U; i < sourceSize; i++)
-    _elements[i] = source[i];
+  try
+  {
+    for (; i < sourceSize; i++)
+      this->construct(i, source[i]);
+
+    this->constructDefault(sourceSize, size - sourceSize);
+  }
+  catch (...)
+  {
+    this->destroy(0U, i);
+    throw;
+  }
 
+  this->_numElements = size;
   return;
 }
 
@@ -222,23 +294,16 @@ If "T" doesn't have a defined default constructor then the remaining elements sh
 considered to be uninitialized.
 */
 
-  LinearStruct(),
-  _elements((size > 0U) ? new T[size] : NULL),
-  _iterCurrent(new unsigned int)
+  SDataStructure<T>(size)
 
 {
-  if ((_elements == NULL) || (_iterCurrent == NULL))
-    throw ExceptionErrno(ENOMEM, NULL, __FILE__, __LINE__);
-
-  if (size < source.numElements())
+  if (size < numElements)
   {
-    throw ExceptionErrno(EINVAL, "\"size\" can't be less than \"numElements\".", __FILE__,
-      __LINE__);
+    throw OperationFailed("\"size\" can't be less than \"numElements\".", __FILE__, __LINE__);
   }
 
-  _numElements = size;
-
-  va_list argList;                                            // for managing the argument list
+  va_list      argList;                                       // for managing the argument list
+  unsigned int i(0U);
 
   /*
   A simple loop is used to copy each element argument to the array (in the order in which
@@ -246,81 +311,32 @@ considered to be uninitialized.
   */
 
   va_start(argList, numElements);
-  for (unsigned int i = 0U; i < numElements; i++)
-    _elements[i] = va_arg(argList, T);
-  va_end(argList);
-
-  return;
-}
-
-/*********************************************************************************************/
 
-template <class T> void SArray<T>::iterStart() const throw ()
-{
-  *_iterCurrent = 0U;
-
-  return;
-}
-
-/*********************************************************************************************/
-
-template <class T> const bool SArray<T>::iterMore() const throw ()
-{
-  assert(*_iterCurrent <= _numElements);
-
-  return (*_iterCurrent < _numElements);
-}
-
-/*********************************************************************************************/
-
-template <class T> void SArray<T>::iterNext() const throw (DataStruct::OperationFailed)
-{
-  assert(*_iterCurrent <= _numElements);
+  try
+  {
+    for (; i < numElements; i++)
+      this->construct(i, va_arg(argList, T));
 
-  if (*_iterCurrent == _numElements)
+    this->constructDefault(numElements, size - numElements);
+  }
+  catch (...)
   {
-    throw OperationFailed("Current element in iteration is undefined.", NULL, __FILE__,
-      __LINE__);
+    va_end(argList);
+    this->destroy(0U, i);
+    throw;
   }
 
-  ++(*_iterCurrent);
+  va_end(argList);
 
+  this->_numElements = size;
   return;
 }
 
 /*********************************************************************************************/
 
-template <class T> const T *const SArray<T>::iterCurrent() const
-  throw (DataStruct::OperationFailed)
-
-/*
-This method returns the element currently being iterated through, but doesn't allow it to be
-changed.
-
-PRECONDITIONS:
-An iteration must be underway and the end of the iteration must not have been reached yet.
-
-POSTCONDITIONS:
-None.
-*/
-
-{
-  assert(*_current <= _numElements);
-
-  if (*_current == _numElements)
-  {
-    throw OperationFailed("Current element in iteration is undefined.", NULL, __FILE__,
-      __LINE__);
-  }
-
-  return &(_elements[*_current]);
-}
-
-/*********************************************************************************************/
-
 template <class T> SArray<T>& SArray<T>::operator=
 (
-  const LinearStruct<T>& source                       // the source data structure to copy from
+  const DataStructure<T>& source                      // the source data structure to copy from
 )
 
 /*
@@ -328,6 +344,10 @@ This method copies the contents of "source" to the instance.  The copy is deep -
 each element in "source" is copied -- so that the array's elements are independent of
 "source's".
 
+If "source's" elements are contiguous (refer to "DataStructure<T>::contiguousElements()") then
+they're assigned as a single block, which "std::copy()" turns into one "memmove()" when "T" is
+trivially copyable.
+
 PRECONDITIONS:
 There must be enough room in the array to hold the copies of "source's" elements.
 
@@ -336,16 +356,28 @@ POSTCONDITIONS:
 */
 
 {
-  if (_numElements < source.numElements())
+  if (this->_numElements < source.numElements())
   {
-    throw OperationFailed("Assignment operation on SArray would cause an overflow.", NULL,
-      __FILE__, __LINE__);
+    throw OperationFailed("Assignment operation on SArray would cause an overflow.", __FILE__,
+      __LINE__);
   }
 
-  unsigned int index(0U);                   // index to the next element in _arrayspace to fill
+  bool           isReversed;
+  const T *const block = source.contiguousElements(isReversed);
+
+  if (block == NULL)
+  {
+    unsigned int index(0U);               // index to the next element in _arrayspace to fill
 
-  for (source.iterStart(); source.iterMore(); source.iterNext())
-    _elements[index++] = *source.iterCurrent();
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+    for (; i->more(); i->next())
+      this->elements()[index++] = *i->current();
+  }
+  else if (!isReversed)
+    std::copy(block, block + source.numElements(), this->elements());
+  else
+    std::reverse_copy(block, block + source.numElements(), this->elements());
 
   return *this;
 }
@@ -354,7 +386,7 @@ POSTCONDITIONS:
 
 template <class T> T& SArray<T>::operator[]
 (
-  const unsigned int index
+  const unsigned int& index
 )
 
 /*
@@ -364,10 +396,10 @@ POSTCONDITIONS:
 */
 
 {
-  if (index >= _numElements)
-    throw ExceptionErrno(EINVAL, "\"index\" is out of range.", NULL, __FILE__, __LINE__);
+  if (index >= this->_numElements)
+    throw OperationFailed("\"index\" is out of range.", __FILE__, __LINE__);
 
-  return _elements[index];
+  return this->elements()[index];
 }
 
 #endif
@@ -0,0 +1,650 @@
+#ifndef DSTRUCTS_SASSOCARRAY_H
+#define DSTRUCTS_SASSOCARRAY_H
+
+// ============================================================================================
+//
+// sassocarray.h -- Static Associative Array Template Class
+//
+// ============================================================================================
+
+/*
+This class is a static associative array -- that is, a lookup table whose keys are fixed when
+it's built.  An "SAssocArray" is an "Array" whose key is any type that "Compare" can order.
+
+It's built in one go from a linear structure of key/element pairs and never changes size
+afterwards, so it's meant for tables that are built once and then searched many times:
+
+  SArray<std::pair<unsigned int, Rate> > rates(...);
+  ...
+  const SAssocArray<Rate, unsigned int> rateTable(rates);
+
+  const Rate& rate = rateTable[zoneNo];
+
+If a key appears more than once in the source then the first of its elements is kept (as with
+"DAssocArray::insert()").  Subscripting an "SAssocArray" with a key that isn't in it throws
+"OperationFailed", since no element can be added; "find()" and "contains()" look a key up
+without throwing, and "lowerBound()" returns an iterator at the first element whose key isn't
+less than a given key.
+
+The elements are iterated in key order.  An "ElementIterator" also has a "key()" method that
+returns the current element's key.  The elements themselves may be changed, but the keys may
+not, and an "SAssocArray" can't be emptied or concatenated.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+The keys are kept in a separate block from the elements, in Eytzinger order -- the order in
+which a breadth-first walk visits a complete binary search tree.  The root is key 1, and the
+children of key "k" are keys "2k" and "2k + 1".  Key 0 isn't used.  Element "k - 1" (in
+"SDataStructure's" raw storage) is the element with key "k".
+
+  sorted keys:     | 10 | 20 | 30 | 40 | 50 | 60 | 70 |
+  Eytzinger keys:  |  - | 40 | 20 | 60 | 10 | 30 | 50 | 70 |
+                     0    1    2    3    4    5    6    7
+
+A search walks down the tree from the root with "k = 2k + (key[k] < key)" until it falls off
+the bottom, which takes no branches apart from the loop's (and the loop always runs the same
+no. of times for a given table, so even that one is predicted).  The lower bound is then the
+last node at which the search went left:  the low-order 1 bits of "k" are the right turns that
+followed it, so shifting them (and the left turn) out gives its index -- or 0 if the search
+never went left, meaning that every key is less than the one being looked for.
+
+The top levels of the tree are shared by every search and stay in the cache.  Further down,
+the 2^d descendants of key "k" at "d" levels below it are contiguous (starting at key
+"k * 2^d"), so the key block is aligned to a cache line and each step prefetches the line
+holding the descendants "PREFETCH_DEPTH" levels down -- as many levels as fit in one line.  By
+the time the search gets there, the line has usually arrived.  A plain binary search over a
+sorted array has no such regular access pattern to prefetch, and its early probes are spread
+over the whole array.
+
+Because the keys are in their own block, a search only brings keys into the cache, and only
+the element that's found is touched.
+
+The elements are iterated in key order, which is an in-order walk of the tree:  the successor
+of key "k" is the leftmost key in its right subtree if it has one, otherwise it's the parent of
+the nearest ancestor (or "k" itself) that's a left child -- found with the same shift as in a
+search.  The table is built by making that same walk and filling each key in turn from the
+sorted source.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sdp.h>
+#include <dstructs/array.h>
+#include <dstructs/sdatastructure.h>
+
+// ============================================================================================
+// SASSOCARRAY<T, KEY, COMPARE> CLASS DECLARATION
+// ============================================================================================
+
+template<class T, class Key, class Compare = std::less<Key> > class SAssocArray:
+  virtual public DataStructureExceptions,
+  virtual public SDataStructure<T>,
+  virtual public Array<T, Key>
+{
+  public:
+    typedef std::pair<Key, T> Pair;
+
+    static const size_t    CACHE_LINE_SIZE = 64U;
+
+                           SAssocArray(const LinearStructure<Pair>&);
+    virtual                ~SAssocArray();
+
+    T *const               find(const Key&) noexcept;
+    const T *const         find(const Key&) const noexcept;
+    const bool             contains(const Key& key) const noexcept
+                             {return find(key) != NULL;}
+
+    // Element iterators
+
+    /*
+    The element iterators visit the elements in key order.  The end iterator has index 0.
+    */
+
+    template<class Element> class KeyOrderIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                          KeyOrderIterator(const Key *const keys = NULL,
+                            Element *const elements = NULL, const unsigned int index = 0U,
+                            const unsigned int numElements = 0U) noexcept:
+                            _keys(keys), _elements(elements), _index(index),
+                            _numElements(numElements) {return;}
+                          KeyOrderIterator(const KeyOrderIterator<T>& source) noexcept:
+                            _keys(source._keys), _elements(source._elements),
+                            _index(source._index), _numElements(source._numElements)
+                            {return;}
+
+        Element&          operator*() const noexcept
+                            {return _elements[_index - 1U];}
+        Element*          operator->() const noexcept
+                            {return &_elements[_index - 1U];}
+        const Key&        key() const noexcept
+                            {return _keys[_index];}
+        KeyOrderIterator& operator++() noexcept
+                            {_index = nextIndex(_index, _numElements); return *this;}
+        KeyOrderIterator  operator++(int) noexcept
+                            {const KeyOrderIterator old(*this); ++*this; return old;}
+
+        const bool        operator==(const KeyOrderIterator& rhs) const noexcept
+                            {return _index == rhs._index;}
+        const bool        operator!=(const KeyOrderIterator& rhs) const noexcept
+                            {return _index != rhs._index;}
+
+      private:
+        const Key*   _keys;                         // the table's keys (in Eytzinger order)
+        Element*     _elements;                     // the table's elements
+        unsigned int _index;                        // the current key's index, or 0
+        unsigned int _numElements;                  // the table's "numElements()"
+
+        friend class KeyOrderIterator<const T>;
+    };
+
+    typedef KeyOrderIterator<T>       ElementIterator;
+    typedef KeyOrderIterator<const T> ConstElementIterator;
+
+    ElementIterator        begin() noexcept
+                             {return ElementIterator(_keys, this->elements(),
+                                firstIndex(this->_numElements), this->_numElements);}
+    ElementIterator        end() noexcept
+                             {return ElementIterator(_keys, this->elements(), 0U,
+                                this->_numElements);}
+    ConstElementIterator   begin() const noexcept
+                             {return ConstElementIterator(_keys, this->elements(),
+                                firstIndex(this->_numElements), this->_numElements);}
+    ConstElementIterator   end() const noexcept
+                             {return ConstElementIterator(_keys, this->elements(), 0U,
+                                this->_numElements);}
+
+    ElementIterator        lowerBound(const Key& key) noexcept
+                             {return ElementIterator(_keys, this->elements(),
+                                lowerBoundIndex(key), this->_numElements);}
+    ConstElementIterator   lowerBound(const Key& key) const noexcept
+                             {return ConstElementIterator(_keys, this->elements(),
+                                lowerBoundIndex(key), this->_numElements);}
+
+    // DataStructure<T> methods
+
+    virtual void           empty()
+                           {
+                             throw OperationFailed("An SAssocArray can't be emptied.",
+                               __FILE__, __LINE__);
+                             return;
+                           }
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    // LinearStructure<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&)
+                           {
+                             throw OperationFailed("Nothing can be added to an SAssocArray.",
+                               __FILE__, __LINE__);
+                             return;
+                           }
+
+    // Array<T, Key> methods
+
+    virtual T&             operator[](const Key&);
+    const T&               operator[](const Key&) const;
+
+  protected:
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+    static const size_t    KEY_ALIGNMENT  = alignof(Key) > CACHE_LINE_SIZE ? alignof(Key) :
+                             CACHE_LINE_SIZE;
+    static const unsigned int PREFETCH_DEPTH =
+                             sizeof(Key) <= CACHE_LINE_SIZE / 16U ? 4U :
+                             sizeof(Key) <= CACHE_LINE_SIZE / 8U  ? 3U :
+                             sizeof(Key) <= CACHE_LINE_SIZE / 4U  ? 2U : 1U;
+
+    Key *const             _keys;            // "size() + 1" keys' room (key 0 isn't used)
+
+    static Key *const      allocateKeys(const unsigned int);
+    static const unsigned int firstIndex(const unsigned int) noexcept;
+    static const unsigned int nextIndex(const unsigned int, const unsigned int) noexcept;
+    static const unsigned int lowestBit(const unsigned int) noexcept;
+
+    const unsigned int     lowerBoundIndex(const Key&) const noexcept;
+    const unsigned int     findIndex(const Key&) const noexcept;
+    void                   destroyKeys(const unsigned int) noexcept;
+
+    SAssocArray(const SAssocArray<T, Key, Compare>&);                  // not implemented
+    SAssocArray<T, Key, Compare>& operator=(const SAssocArray<T, Key, Compare>&);  // ditto
+};
+
+// ============================================================================================
+// SASSOCARRAY<T, KEY, COMPARE> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare> SAssocArray<T, Key, Compare>::SAssocArray
+(
+  const LinearStructure<Pair>& source                 // the key/element pairs to copy
+):
+
+/*
+This constructor instanciates an associative array that holds copies of the keys and elements
+in "source".  If a key appears more than once then only its first element (in "source's"
+iterative order) is kept.
+
+PRECONDITIONS:
+There must be enough memory for the array -- otherwise, "OperationFailed" will be thrown.
+"source" can't have more than "~0U / 2" elements, or "Full" will be thrown.
+
+POSTCONDITIONS:
+The array holds a copy of each distinct key in "source" and its element.
+*/
+
+  SDataStructure<T>(source.numElements()),
+  LinearStructure<T>(),
+  _keys(allocateKeys(source.numElements()))
+
+{
+  unsigned int numElements(0U);                       // no. of distinct keys in "source"
+  unsigned int numBuilt(0U);                          // no. of keys & elements constructed
+  unsigned int index(0U);                             // the key being constructed
+
+  try
+  {
+    /*
+    The pairs are gathered up, in "source's" iterative order, as pointers and sorted by key.  A
+    stable sort keeps the pairs with the same key in that order, so removing all but the first
+    pair in each run of equal keys keeps the first element of each.
+    */
+
+    std::vector<const Pair*> pairs;
+    bool                     isReversed;
+    const Pair *const        block = source.contiguousElements(isReversed);
+
+    pairs.reserve(source.numElements());
+
+    if (block != NULL)
+    {
+      for (unsigned int i = 0U; i < source.numElements(); ++i)
+        pairs.push_back(block + (isReversed ? source.numElements() - 1U - i : i));
+    }
+    else
+    {
+      const SDP<typename DataStructure<Pair>::Iterator_> i(source.iterator());
+
+      for (; i->more(); i->next())
+        pairs.push_back(i->current());
+    }
+
+    std::stable_sort(pairs.begin(), pairs.end(), [](const Pair *const lhs,
+      const Pair *const rhs) {return Compare()(lhs->first, rhs->first);});
+
+    pairs.erase(std::unique(pairs.begin(), pairs.end(), [](const Pair *const lhs,
+      const Pair *const rhs) {return !Compare()(lhs->first, rhs->first);}), pairs.end());
+
+    /*
+    An in-order walk of the tree visits the keys in sorted order, so each one is filled from
+    the next pair.
+    */
+
+    numElements = (unsigned int)pairs.size();
+
+    for (index = firstIndex(numElements); index != 0U;
+      index = nextIndex(index, numElements))
+    {
+      new(_keys + index) Key(pairs[numBuilt]->first);
+
+      try
+      {
+        this->construct(index - 1U, pairs[numBuilt]->second);
+      }
+      catch (...)
+      {
+        _keys[index].~Key();
+        throw;
+      }
+
+      ++numBuilt;
+    }
+
+    this->_numElements = numElements;
+  }
+  catch (...)
+  {
+    for (index = firstIndex(numElements); numBuilt > 0U;
+      index = nextIndex(index, numElements), --numBuilt)
+    {
+      _keys[index].~Key();
+      this->destroy(index - 1U);
+    }
+
+    ::operator delete(_keys, std::align_val_t(KEY_ALIGNMENT));
+
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare> SAssocArray<T, Key, Compare>::~SAssocArray()
+
+{
+  destroyKeys(this->_numElements);
+  this->destroy(0U, this->_numElements);
+
+  ::operator delete(_keys, std::align_val_t(KEY_ALIGNMENT));
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare> T *const SAssocArray<T, Key, Compare>::find
+(
+  const Key& key                                      // the key to look for
+)
+noexcept
+
+/*
+This method returns a pointer to the element with the key "key", or NULL if there isn't one.
+*/
+
+{
+  const unsigned int index = findIndex(key);
+
+  return index != 0U ? this->elements() + index - 1U : NULL;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare> const T *const SAssocArray<T, Key, Compare>::find
+(
+  const Key& key                                      // the key to look for
+)
+const noexcept
+
+{
+  const unsigned int index = findIndex(key);
+
+  return index != 0U ? this->elements() + index - 1U : NULL;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare> T& SAssocArray<T, Key, Compare>::operator[]
+(
+  const Key& key                                      // the key of the element to get
+)
+
+/*
+This method returns the element with the key "key".  "OperationFailed" is thrown if there
+isn't one.
+*/
+
+{
+  T *const element = find(key);
+
+  if (element == NULL)
+    throw OperationFailed("No element has that key.", __FILE__, __LINE__);
+
+  return *element;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare> const T& SAssocArray<T, Key, Compare>::operator[]
+(
+  const Key& key                                      // the key of the element to get
+)
+const
+
+{
+  const T *const element = find(key);
+
+  if (element == NULL)
+    throw OperationFailed("No element has that key.", __FILE__, __LINE__);
+
+  return *element;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T, class Key, class Compare>
+  void SAssocArray<T, Key, Compare>::assertInvariants() const noexcept
+
+  {
+    SDataStructure<T>::assertInvariants();
+
+    assert(this->_numElements <= ~0U / 2U);
+    assert(((uintptr_t)_keys & (KEY_ALIGNMENT - 1U)) == 0U);
+
+    unsigned int previous(0U);
+
+    for (unsigned int index = firstIndex(this->_numElements); index != 0U;
+      index = nextIndex(index, this->_numElements))
+    {
+      assert(previous == 0U || Compare()(_keys[previous], _keys[index]));
+      previous = index;
+    }
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare>
+Key *const SAssocArray<T, Key, Compare>::allocateKeys
+(
+  const unsigned int size                             // the no. of keys that must fit
+)
+
+/*
+This function returns uninitialized, cache-line-aligned storage for keys 0 to "size".
+*/
+
+{
+  if (size > ~0U / 2U)
+    throw Full(__FILE__, __LINE__);
+
+  Key *const keys = static_cast<Key*>(::operator new(sizeof(Key) * ((size_t)size + 1U),
+    std::align_val_t(KEY_ALIGNMENT), std::nothrow));
+
+  if (keys == NULL)
+  {
+    throw OperationFailed("Could not allocate enough memory for this data structure.",
+      __FILE__, __LINE__);
+  }
+
+  return keys;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare>
+inline const unsigned int SAssocArray<T, Key, Compare>::firstIndex
+(
+  const unsigned int numElements                      // the no. of keys in the tree
+)
+noexcept
+
+/*
+This function returns the index of the smallest key in a tree of "numElements" keys -- the
+leftmost one -- or 0 if the tree is empty.
+*/
+
+{
+  unsigned int index(numElements > 0U ? 1U : 0U);
+
+  while (index != 0U && 2U * index <= numElements)
+    index *= 2U;
+
+  return index;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare>
+inline const unsigned int SAssocArray<T, Key, Compare>::nextIndex
+(
+  unsigned int       index,                           // the index of a key in the tree
+  const unsigned int numElements                      // the no. of keys in the tree
+)
+noexcept
+
+/*
+This function returns the index of the key that follows key "index" in sorted order, or 0 if
+it's the largest one.
+*/
+
+{
+  assert(index != 0U && index <= numElements);
+
+  if (2U * index + 1U <= numElements)
+  {
+    index = 2U * index + 1U;
+
+    while (2U * index <= numElements)
+      index *= 2U;
+
+    return index;
+  }
+
+  return index >> (lowestBit(~index) + 1U);
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare>
+inline const unsigned int SAssocArray<T, Key, Compare>::lowestBit
+(
+  const unsigned int mask                             // a non-zero bit mask
+)
+noexcept
+
+/*
+This function returns the position of the lowest set bit in "mask".
+*/
+
+{
+  assert(mask != 0U);
+
+  #if defined(__GNUC__)
+    return (unsigned int)__builtin_ctz(mask);
+  #else
+    unsigned int position(0U);
+
+    while ((mask & (1U << position)) == 0U)
+      ++position;
+
+    return position;
+  #endif
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare>
+inline const unsigned int SAssocArray<T, Key, Compare>::lowerBoundIndex
+(
+  const Key& key                                      // the key to look for
+)
+const noexcept
+
+/*
+This method returns the index of the smallest key that isn't less than "key", or 0 if there
+isn't one.
+
+The prefetch address is worked out as an integer, since it's usually past the end of the key
+block near the bottom of the tree.  Prefetching an address that isn't mapped does nothing.
+*/
+
+{
+  const unsigned int numElements = this->_numElements;
+  unsigned int       index(1U);
+
+  while (index <= numElements)
+  {
+    #if defined(__GNUC__)
+      __builtin_prefetch((const void*)((uintptr_t)_keys +
+        sizeof(Key) * ((size_t)index << PREFETCH_DEPTH)));
+    #endif
+
+    index = 2U * index + (unsigned int)Compare()(_keys[index], key);
+  }
+
+  return index >> (lowestBit(~index) + 1U);
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare>
+inline const unsigned int SAssocArray<T, Key, Compare>::findIndex
+(
+  const Key& key                                      // the key to look for
+)
+const noexcept
+
+/*
+This method returns the index of the key "key", or 0 if it isn't in the table.
+*/
+
+{
+  const unsigned int index = lowerBoundIndex(key);
+
+  return index != 0U && !Compare()(key, _keys[index]) ? index : 0U;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Key, class Compare> void SAssocArray<T, Key, Compare>::destroyKeys
+(
+  const unsigned int numKeys                          // the no. of keys to destroy
+)
+noexcept
+
+/*
+This method destroys keys 1 to "numKeys".  If "Key" has a trivial destructor then nothing is
+done at all.
+*/
+
+{
+  if (!std::is_trivially_destructible<Key>::value)
+  {
+    for (unsigned int index = 1U; index <= numKeys; ++index)
+      _keys[index].~Key();
+  }
+
+  return;
+}
+
+#endif
@@ -0,0 +1,819 @@
+#ifndef DSTRUCTS_SBINARYTREE_H
+#define DSTRUCTS_SBINARYTREE_H
+
+// ============================================================================================
+//
+// sbinarytree.h -- Implementation of a static heap -- that is, a heap-ordered tree that stores
+// its elements in an array of fixed size.
+//
+// ============================================================================================
+
+/*
+This class is a static priority queue.  An "SBinaryTree" is a "BinaryTree".
+
+The top is the greatest element according to "Compare", the same way as with
+"std::priority_queue" -- so the default, "std::less<T>", pops the largest element first and
+"std::greater<T>" pops the smallest first:
+
+  SBinaryTree<Job, LaterDeadline> jobs(1000U);
+
+  jobs.push(job);
+  ...
+  jobs.pop(nextJob);
+
+"ARITY" is the no. of children that each node has:  2, 4 or 8.  A wider tree is shallower, so
+popping an element moves it through fewer levels -- and since a node's children sit next to
+each other in the array, each level's comparisons read one or two cache lines instead of one
+line per child.  A binary heap does the fewest comparisons per level, though.  Which is
+fastest depends on the elements and the workload -- "benchsbinarytree" times all three.
+
+Constructing an "SBinaryTree" from a data structure (or "concatenate()"-ing a data structure
+to an empty one) copies the elements into the array and then puts them in heap order in one
+O(n) pass, which is quicker than pushing them one at a time.
+
+The element iterators (and "iterator()") visit the elements in the order they're stored in,
+which is heap order and not sorted order.  Only constant iterators are provided, since
+changing an element in place could break heap order.
+
+Elements are moved around the array as they're pushed and popped, so "T's" move constructor
+and move assignment operator must not throw.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+The tree is "SDataStructure's" raw storage, laid out level by level:  the root is cell 0 and
+the children of cell "i" are cells "ARITY * i + 1" through "ARITY * i + ARITY", so the parent
+of cell "i" is cell "(i - 1) / ARITY".  Only the first "_numElements" cells hold constructed
+elements, and they're always contiguous, so "SBinaryTree" overrides "contiguousElements()".
+
+"ARITY" is a template parameter, so the multiplications and divisions compile to shifts.
+
+Sifting an element up or down doesn't swap it with each parent or child that it passes.  It's
+moved out of the array into a temporary, leaving a "hole"; each element that it passes is moved
+into the hole (which moves the hole to where that element was), and the element is moved into
+the hole once it's found its place.  That's one move per level instead of three.
+
+"pop()" leaves a hole at the root and moves it all the way down to a leaf, always through
+the greatest child, then moves the last element into it and sifts that element up.  The last
+element nearly always belongs near the bottom, so it hardly ever moves far up -- and that saves
+the comparison with it on every level on the way down, which is also the comparison that the
+processor can't predict.  "pushPop()" can't do that (the new element may belong anywhere), so
+it puts the new element at the root and sifts it down the usual way -- but only if it's less
+than the top; otherwise it pops the new element straight back.
+
+Building a heap from "n" unordered elements uses Floyd's method:  each node with children is
+sifted down, starting with the last one and working back to the root.  Most nodes are near the
+bottom and don't have far to go, so the whole thing is O(n).  "concatenate()" uses it whenever
+it adds at least as many elements as the heap already has and pushes them one at a time
+otherwise.
+
+Every element is copied before anything is moved, so if a copy fails the heap is left as it
+was.  After that, only moves (which can't throw) and comparisons are done.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <sdp.h>
+#include <dstructs/binarytree.h>
+#include <dstructs/sdatastructure.h>
+
+// ============================================================================================
+// SBINARYTREE<T, COMPARE, ARITY> CLASS DECLARATION
+// ============================================================================================
+
+template<class T, class Compare = std::less<T>, unsigned int ARITY = 2U> class SBinaryTree:
+  virtual public DataStructureExceptions,
+  virtual public SDataStructure<T>,
+  virtual public BinaryTree<T>
+{
+  static_assert(ARITY == 2U || ARITY == 4U || ARITY == 8U,
+    "An SBinaryTree's arity must be 2, 4 or 8.");
+  static_assert(std::is_nothrow_move_constructible<T>::value &&
+    std::is_nothrow_move_assignable<T>::value,
+    "An SBinaryTree's elements must be movable without exceptions.");
+
+  public:
+                           SBinaryTree(const unsigned int);
+                           SBinaryTree(const unsigned int, const DataStructure<T>&);
+    virtual                ~SBinaryTree()
+                             {empty(); return;}
+
+    SBinaryTree<T, Compare, ARITY>& operator=(const DataStructure<T>&);
+    SBinaryTree<T, Compare, ARITY>& operator+=(const DataStructure<T>&);
+
+    const T&               top() const;
+
+    // Element iterators
+
+    typedef const T* ElementIterator;
+    typedef const T* ConstElementIterator;
+
+    ConstElementIterator   begin() const noexcept
+                             {return elements();}
+    ConstElementIterator   end() const noexcept
+                             {return elements() + this->_numElements;}
+
+    // DataStructure<T> methods
+
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    virtual const T *const contiguousElements(bool& isReversed) const noexcept
+                             {
+                               isReversed = false;
+                               return this->_numElements > 0U ? elements() : NULL;
+                             }
+
+    // Tree<T> methods
+
+    virtual void           concatenate(const DataStructure<T>&);
+
+    // BinaryTree<T> methods
+
+    virtual void           push(const T&);
+    virtual void           push(T&&);
+    virtual void           pop(T&);
+    virtual void           peek(T&) const;
+    virtual void           pushPop(const T& element, T& poppedElement)
+                             {replaceTop(element, poppedElement); return;}
+    virtual void           pushPop(T&& element, T& poppedElement)
+                             {replaceTop(std::move(element), poppedElement); return;}
+
+    template<class... Args>
+    void                   emplace(Args&&...);
+
+  protected:
+    using SDataStructure<T>::elements;
+    using SDataStructure<T>::construct;
+    using SDataStructure<T>::constructCopies;
+    using SDataStructure<T>::destroy;
+
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
+  private:
+    template<class Arg>
+    void                   replaceTop(Arg&&, T&);
+    void                   heapify() noexcept;
+    void                   siftUp(unsigned int) noexcept;
+    void                   siftDown(unsigned int) noexcept;
+    const unsigned int     sinkHole(unsigned int) noexcept;
+    const unsigned int     greatestChild(const unsigned int) const noexcept;
+};
+
+// ============================================================================================
+// SBINARYTREE<T, COMPARE, ARITY> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+SBinaryTree<T, Compare, ARITY>::SBinaryTree
+(
+  const unsigned int size                  // the no. of elements that the heap can hold
+):
+
+/*
+This constructor instanciates an empty heap that can contain "size" elements.  No "T"
+constructors are called.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+An empty heap with room for "size" elements is created.
+*/
+
+  SDataStructure<T>(size)
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+SBinaryTree<T, Compare, ARITY>::SBinaryTree
+(
+  const unsigned int      size,            // the no. of elements that the heap can hold
+  const DataStructure<T>& source           // the data structure to copy the elements of
+):
+
+/*
+This constructor instanciates a heap with room for "size" elements and fills it with copies of
+"source's" elements in O(n) time (refer to "concatenate()").
+*/
+
+  SDataStructure<T>(size)
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+SBinaryTree<T, Compare, ARITY>& SBinaryTree<T, Compare, ARITY>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+SBinaryTree<T, Compare, ARITY>& SBinaryTree<T, Compare, ARITY>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+const T& SBinaryTree<T, Compare, ARITY>::top() const
+
+/*
+This method returns the top element without copying it.  The reference is good until the
+heap is next changed.
+
+PRECONDITIONS:
+The heap cannot be empty.
+*/
+
+{
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  return elements()[0];
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+void SBinaryTree<T, Compare, ARITY>::empty() noexcept
+
+/*
+This method destroys every element in the heap.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+The heap is empty.
+*/
+
+{
+  destroy(0U, this->_numElements);
+  this->_numElements = 0U;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+void SBinaryTree<T, Compare, ARITY>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method adds copies of "source's" elements to the heap.
+
+The copies are made in the cells after the last element -- in bulk, if "source's" elements
+are contiguous (refer to "DataStructure<T>::contiguousElements()").  If a copy fails then the
+ones already made are destroyed and the heap is left as it was.  Then, if there are at least as
+many new elements as old ones, the whole heap is rebuilt in O(n) time; otherwise each new
+element is sifted up.
+
+PRECONDITIONS:
+There must be room in the heap for copies of all of "source's" elements.
+
+POSTCONDITIONS:
+The heap holds copies of "source's" elements as well as its own.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int count = source.numElements();
+  const unsigned int first = this->_numElements;
+
+  if (count == 0U)
+    return;
+
+  if (count > this->size() - first)
+    throw Full(__FILE__, __LINE__);
+
+  bool           isReversed;
+  const T *const block = source.contiguousElements(isReversed);
+  unsigned int   numCopied(0U);
+
+  try
+  {
+    if (block != NULL)
+    {
+      constructCopies(first, block, count, isReversed);
+      numCopied = count;
+    }
+    else
+    {
+      const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+      for (; i->more(); i->next())
+      {
+        assert(i->current() != NULL);
+        construct(first + numCopied, *i->current());
+        ++numCopied;
+      }
+    }
+  }
+  catch (...)
+  {
+    destroy(first, numCopied);
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  assert(numCopied == count);
+
+  if (count >= first)
+  {
+    this->_numElements = first + count;
+    heapify();
+  }
+  else
+  {
+    while (this->_numElements < first + count)
+    {
+      ++this->_numElements;
+      siftUp(this->_numElements - 1U);
+    }
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY> void SBinaryTree<T, Compare, ARITY>::push
+(
+  const T& elementToPush                              // the element to add to the heap
+)
+
+/*
+This method adds a copy of "elementToPush" to the heap.  If the copy fails then
+"OperationFailed" is thrown and the heap is left as it was.
+
+PRECONDITIONS:
+The heap cannot be full.
+
+POSTCONDITIONS:
+A copy of "elementToPush" is in the heap.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == this->size())
+    throw Full(__FILE__, __LINE__);
+
+  try
+  {
+    construct(this->_numElements, elementToPush);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  siftUp(this->_numElements++);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY> void SBinaryTree<T, Compare, ARITY>::push
+(
+  T&& elementToPush                                   // the element to move into the heap
+)
+
+/*
+This method moves "elementToPush" into the heap.  Otherwise, it's the same as the other
+"push()".
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == this->size())
+    throw Full(__FILE__, __LINE__);
+
+  construct(this->_numElements, std::move(elementToPush));
+  siftUp(this->_numElements++);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY> template<class... Args>
+void SBinaryTree<T, Compare, ARITY>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" in the first free cell and sifts it up.
+If the constructor throws then "OperationFailed" is thrown and the heap is left as it was.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == this->size())
+    throw Full(__FILE__, __LINE__);
+
+  try
+  {
+    construct(this->_numElements, std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Element construction failed.", __FILE__, __LINE__);
+  }
+
+  siftUp(this->_numElements++);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY> void SBinaryTree<T, Compare, ARITY>::pop
+(
+  T& poppedElement                              // the variable to receive the popped element
+)
+
+/*
+This method moves the top element to "poppedElement" and removes it from the heap.  The hole
+that it leaves is moved down to a leaf and filled with the last element, which is then sifted
+up.
+
+PRECONDITIONS:
+The heap cannot be empty.
+
+POSTCONDITIONS:
+The greatest element has been moved to "poppedElement" and removed from the heap.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  T *const           cells = elements();
+  const unsigned int last  = --this->_numElements;
+
+  poppedElement = std::move(cells[0]);
+
+  if (last > 0U)
+  {
+    const unsigned int hole = sinkHole(0U);
+
+    cells[hole] = std::move(cells[last]);
+    siftUp(hole);
+  }
+
+  destroy(last);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY> void SBinaryTree<T, Compare, ARITY>::peek
+(
+  T& peekedElement                                // the variable to receive the top element
+)
+const
+
+/*
+This method copies the top element to "peekedElement" without removing it (refer to "top()"
+to look at it without copying it).
+
+PRECONDITIONS:
+The heap cannot be empty.
+*/
+
+{
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    peekedElement = elements()[0];
+  }
+  catch (...)
+  {
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T, class Compare, unsigned int ARITY>
+  void SBinaryTree<T, Compare, ARITY>::assertInvariants() const noexcept
+
+  {
+    SDataStructure<T>::assertInvariants();
+
+    assert(this->_numElements <= 1U ||
+      !Compare()(elements()[0], elements()[this->_numElements - 1U]));
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY> template<class Arg>
+void SBinaryTree<T, Compare, ARITY>::replaceTop
+(
+  Arg&& element,                                      // the element to push
+  T&    poppedElement                                 // the variable to receive the top
+)
+
+/*
+This method pushes "element" (copied or moved, as "Arg" says) and pops the top into
+"poppedElement".  If "element" isn't less than the top then it would be popped straight back,
+so it's just assigned to "poppedElement".  Otherwise the top goes to "poppedElement" and
+"element" takes its place and is sifted down.
+
+If "element" has to be copied and the copy fails then "OperationFailed" is thrown and the heap
+is left as it was.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  try
+  {
+    if (this->_numElements == 0U || !Compare()(element, elements()[0]))
+    {
+      poppedElement = std::forward<Arg>(element);
+      return;
+    }
+
+    T newTop(std::forward<Arg>(element));
+
+    poppedElement = std::move(elements()[0]);
+    elements()[0] = std::move(newTop);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  siftDown(0U);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+void SBinaryTree<T, Compare, ARITY>::heapify() noexcept
+
+/*
+This method puts the elements in heap order with Floyd's method:  every node that has children
+is sifted down, from the last one back to the root.
+*/
+
+{
+  if (this->_numElements < 2U)
+    return;
+
+  for (unsigned int index = (this->_numElements - 2U) / ARITY + 1U; index > 0U; --index)
+    siftDown(index - 1U);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+void SBinaryTree<T, Compare, ARITY>::siftUp
+(
+  unsigned int index                                  // the cell of the element to sift up
+)
+noexcept
+
+/*
+This method moves the element in cell "index" up past each parent that's less than it.
+*/
+
+{
+  T *const cells = elements();
+
+  if (index == 0U || !Compare()(cells[(index - 1U) / ARITY], cells[index]))
+    return;
+
+  T moving(std::move(cells[index]));
+
+  do
+  {
+    const unsigned int parent = (index - 1U) / ARITY;
+
+    cells[index] = std::move(cells[parent]);
+    index        = parent;
+  }
+  while (index > 0U && Compare()(cells[(index - 1U) / ARITY], moving));
+
+  cells[index] = std::move(moving);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+void SBinaryTree<T, Compare, ARITY>::siftDown
+(
+  unsigned int index                                  // the cell of the element to sift down
+)
+noexcept
+
+/*
+This method moves the element in cell "index" down past its greatest child for as long as that
+child is greater than it.
+*/
+
+{
+  T *const           cells       = elements();
+  const unsigned int numElements = this->_numElements;
+  T                  moving(std::move(cells[index]));
+
+  while (ARITY * index + 1U < numElements)
+  {
+    const unsigned int greatest = greatestChild(index);
+
+    if (!Compare()(moving, cells[greatest]))
+      break;
+
+    cells[index] = std::move(cells[greatest]);
+    index        = greatest;
+  }
+
+  cells[index] = std::move(moving);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+const unsigned int SBinaryTree<T, Compare, ARITY>::sinkHole
+(
+  unsigned int index                                  // the cell of the hole
+)
+noexcept
+
+/*
+This method moves the greatest child of the (moved-from) element in cell "index" into it, then
+the greatest child of that child, and so on down to a leaf.  It returns the leaf's cell, which
+is left holding a moved-from element.
+*/
+
+{
+  T *const           cells       = elements();
+  const unsigned int numElements = this->_numElements;
+
+  while (ARITY * index + 1U < numElements)
+  {
+    const unsigned int greatest = greatestChild(index);
+
+    cells[index] = std::move(cells[greatest]);
+    index        = greatest;
+  }
+
+  return index;
+}
+
+/*********************************************************************************************/
+
+template<class T, class Compare, unsigned int ARITY>
+inline const unsigned int SBinaryTree<T, Compare, ARITY>::greatestChild
+(
+  const unsigned int index                            // a cell that has at least one child
+)
+const noexcept
+
+/*
+This method returns the cell of the greatest child of cell "index".  All but the last parent
+have a full set of "ARITY" children, so the loop has a fixed trip count for them and can be
+unrolled.
+*/
+
+{
+  const T *const     cells    = elements();
+  const unsigned int first    = ARITY * index + 1U;
+  const unsigned int numLeft  = this->_numElements - first;
+  unsigned int       greatest(first);
+
+  if (numLeft >= ARITY)
+  {
+    for (unsigned int child = first + 1U; child < first + ARITY; ++child)
+    {
+      if (Compare()(cells[greatest], cells[child]))
+        greatest = child;
+    }
+  }
+  else
+  {
+    for (unsigned int child = first + 1U; child < first + numLeft; ++child)
+    {
+      if (Compare()(cells[greatest], cells[child]))
+        greatest = child;
+    }
+  }
+
+  return greatest;
+}
+
+#endif
@@ -0,0 +1,1157 @@
+#ifndef DSTRUCTS_SCONCURRENTQUEUE_H
+#define DSTRUCTS_SCONCURRENTQUEUE_H
+
+// ============================================================================================
+//
+// sconcurrentqueue.h -- Implementation of a static queue that any number of threads can
+// enqueue onto and dequeue from at the same time without any locks.
+//
+// ============================================================================================
+
+/*
+This class is a bounded multi-producer/multi-consumer queue.  An "SConcurrentQueue" is a
+"Queue".
+
+Any number of threads can call "enqueue()", "dequeue()", "concatenate()" and their "try" and
+"blocking" versions on the same "SConcurrentQueue" at the same time:
+
+  SConcurrentQueue<Job> jobs(1024U);
+
+  std::thread parser([&jobs]  {... jobs.blockingEnqueue(std::move(job)); ...});
+  std::thread worker1([&jobs] {... jobs.blockingDequeue(job); run(job); ...});
+  std::thread worker2([&jobs] {... jobs.blockingDequeue(job); run(job); ...});
+
+There are three versions of each operation:
+
+  enqueue(), dequeue()                  throw "Full" or "Empty" (as "Queue<T>" requires)
+  tryEnqueue(), tryDequeue()            return false instead of throwing
+  blockingEnqueue(), blockingDequeue()  wait until there's room or an element
+
+The blocking versions retry a few times and then go to sleep (on a futex, on Linux) until
+another thread frees a cell or fills one.  A thread that's asleep costs nothing, and a thread
+that doesn't have to wait never makes a system call.
+
+Like "SRing", the capacity is always a power of two (and at least 2):  the size that's passed
+to the constructor is rounded up and "size()" returns the rounded-up size.
+
+The other methods -- "peek()", "empty()", "iterator()", "begin()", "end()", "recount()" and the
+copy operations that read an "SConcurrentQueue" as a source -- need all of the other threads to
+be stopped.  "numElements()", "isEmpty()" and "isFull()" report the count as of the last call
+to "recount()" (or to "empty()" or a copy operation); "numQueued()" may be called at any time,
+but its answer is a snapshot.
+
+"T's" move constructor and move assignment operator must not throw (which is checked at compile
+time):  an element is moved into or out of a cell after the cell has been claimed, and a claim
+can't be withdrawn once other threads may have claimed the cells after it.  A copy that can
+throw is made before any cell is claimed.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+This is Dmitry Vyukov's bounded MPMC queue.  The elements are in "SDataStructure's" raw
+storage, and alongside it is an array of sequence nos., one per cell.  "_enqueuePosition" and
+"_dequeuePosition" are free-running counters:  the next element to be enqueued goes into cell
+"_enqueuePosition & _mask" and the next element to be dequeued is in cell
+"_dequeuePosition & _mask".
+
+A cell's sequence no. says what state the cell is in relative to a position that maps to it:
+
+  sequence == position                the cell is free for the enqueuer of "position"
+  sequence == position + 1            the cell holds the element enqueued at "position"
+  sequence == position + size()       the cell is free again, for the next lap
+
+A producer reads the cell at "_enqueuePosition".  If the cell is free for that position then
+the producer claims the position with a compare-and-swap of "_enqueuePosition", constructs the
+element and publishes it with a release store of "position + 1".  If the cell still holds an
+element from the previous lap then the queue is full.  Consumers do the same with
+"_dequeuePosition", and release the cell with a release store of "position + size()" after
+destroying the element.  The bulk operations check "count" consecutive cells and claim them
+all with a single compare-and-swap.
+
+So producers only ever contend with producers (on "_enqueuePosition") and consumers with
+consumers (on "_dequeuePosition"), and a producer and a consumer only share a cell (and its
+sequence no.) when they're working on the same element.  Each counter is on its own cache
+line.
+
+A blocking thread that has given up spinning adds itself to "_producersWaiting" (or
+"_consumersWaiting") and then waits for the sequence no. of the cell that it's waiting for to
+change.  The thread that changes a sequence no. only wakes the cell's waiters if the count is
+non-zero.  The waiter's increment and the waker's sequence store are each followed by a
+sequentially-consistent fence, so at least one of them sees the other:  either the waker sees
+the waiter and wakes it, or the waiter sees the new sequence no. and doesn't sleep.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sdp.h>
+#include <dstructs/queue.h>
+#include <dstructs/sdatastructure.h>
+
+// ============================================================================================
+// SCONCURRENTQUEUE<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class SConcurrentQueue:
+  virtual public DataStructureExceptions,
+  virtual public SDataStructure<T>,
+  virtual public Queue<T>
+{
+  static_assert(std::is_nothrow_move_constructible<T>::value &&
+    std::is_nothrow_move_assignable<T>::value,
+    "An SConcurrentQueue's elements must be movable without exceptions.");
+
+  public:
+    static const size_t       CACHE_LINE_SIZE = 64U;
+    static const unsigned int SPIN_LIMIT      = 64U;   // tries before a blocking call sleeps
+
+                         SConcurrentQueue(const unsigned int);
+                         SConcurrentQueue(const unsigned int, const DataStructure<T>&);
+    virtual              ~SConcurrentQueue();
+
+    SConcurrentQueue<T>& operator=(const DataStructure<T>&);
+    SConcurrentQueue<T>& operator+=(const DataStructure<T>&);
+
+    const unsigned int   numQueued() const noexcept;
+    void                 recount() noexcept;
+
+    // Element iterators
+
+    /*
+    The element iterators visit the elements from the head to the tail.  Like "SRing's", they
+    hold a free-running index, so incrementing one is an index increment and dereferencing one
+    is a mask and an index.
+    */
+
+    template<class Element> class CellIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                      CellIterator(Element *const cells = NULL, const unsigned int index = 0U,
+                        const unsigned int mask = 0U) noexcept:
+                        _cells(cells), _index(index), _mask(mask) {return;}
+                      CellIterator(const CellIterator<T>& source) noexcept:
+                        _cells(source._cells), _index(source._index), _mask(source._mask)
+                        {return;}
+
+        Element&      operator*() const noexcept
+                        {return _cells[_index & _mask];}
+        Element*      operator->() const noexcept
+                        {return _cells + (_index & _mask);}
+        CellIterator& operator++() noexcept
+                        {++_index; return *this;}
+        CellIterator  operator++(int) noexcept
+                        {const CellIterator old(*this); ++_index; return old;}
+
+        const bool    operator==(const CellIterator& rhs) const noexcept
+                        {return _index == rhs._index;}
+        const bool    operator!=(const CellIterator& rhs) const noexcept
+                        {return _index != rhs._index;}
+
+      private:
+        Element*     _cells;                  // cell 0 of the array
+        unsigned int _index;                  // free-running index of the current element
+        unsigned int _mask;                   // the queue's "size() - 1"
+
+        friend class CellIterator<const T>;
+    };
+
+    typedef CellIterator<T>       ElementIterator;
+    typedef CellIterator<const T> ConstElementIterator;
+
+    ElementIterator      begin() noexcept
+                           {return ElementIterator(this->elements(), headPosition(), _mask);}
+    ElementIterator      end() noexcept
+                           {return ElementIterator(this->elements(), tailPosition(), _mask);}
+    ConstElementIterator begin() const noexcept
+                           {return ConstElementIterator(this->elements(), headPosition(),
+                              _mask);}
+    ConstElementIterator end() const noexcept
+                           {return ConstElementIterator(this->elements(), tailPosition(),
+                              _mask);}
+
+    // DataStructure<T> methods
+
+    virtual void         empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                           {return DataStructure<T>::newIterator(*this);}
+
+    // LinearStructure<T> methods
+
+    virtual void         concatenate(const DataStructure<T>&);
+
+    // Queue<T> methods
+
+    virtual void         enqueue(const T&);
+    virtual void         enqueue(T&&);
+    virtual void         enqueue(const T *const, const unsigned int);
+    virtual void         dequeue(T&);
+    virtual void         dequeue(T *const, const unsigned int);
+    virtual void         peek(T&) const;
+
+    // Non-throwing versions
+
+    const bool           tryEnqueue(const T&);
+    const bool           tryEnqueue(T&&) noexcept;
+    const bool           tryDequeue(T&) noexcept;
+
+    // Blocking versions
+
+    void                 blockingEnqueue(const T&);
+    void                 blockingEnqueue(T&&) noexcept;
+    void                 blockingDequeue(T&) noexcept;
+
+  protected:
+    #ifndef NDEBUG
+      virtual void       assertInvariants() const noexcept;
+    #endif
+
+  private:
+    alignas(CACHE_LINE_SIZE) std::atomic<unsigned int> _enqueuePosition;   // next to claim
+    alignas(CACHE_LINE_SIZE) std::atomic<unsigned int> _dequeuePosition;   // next to claim
+    alignas(CACHE_LINE_SIZE) std::atomic<unsigned int> _producersWaiting;  // asleep for room
+    std::atomic<unsigned int>                          _consumersWaiting;  // asleep for items
+    alignas(CACHE_LINE_SIZE) std::atomic<unsigned int> *const _sequences;  // one per cell
+    const unsigned int                                 _mask;              // "size() - 1"
+
+    const unsigned int   headPosition() const noexcept
+                           {return _dequeuePosition.load(std::memory_order_relaxed);}
+    const unsigned int   tailPosition() const noexcept
+                           {return _enqueuePosition.load(std::memory_order_relaxed);}
+
+    const bool           claim(std::atomic<unsigned int>&, const unsigned int,
+                           const unsigned int, unsigned int&) noexcept;
+    void                 publish(const unsigned int, const unsigned int, const unsigned int,
+                           std::atomic<unsigned int>&) noexcept;
+    void                 sleep(std::atomic<unsigned int>&, std::atomic<unsigned int>&,
+                           const unsigned int) noexcept;
+    void                 enqueueMoved(T *const, const unsigned int);
+    void                 resetSequences() noexcept;
+
+    static void          relax() noexcept;
+    static const unsigned int capacityFor(const unsigned int);
+};
+
+// ============================================================================================
+// SCONCURRENTQUEUE<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> SConcurrentQueue<T>::SConcurrentQueue
+(
+  const unsigned int size                  // the no. of elements that the queue must hold
+):
+
+/*
+This constructor instanciates an empty queue that can contain at least "size" elements.  No
+"T" constructors are called.
+
+PRECONDITIONS:
+"size" can't be more than the largest power of two that fits in an "unsigned int".
+
+POSTCONDITIONS:
+An empty queue with room for "size" elements (rounded up to a power of two) is created.
+*/
+
+  SDataStructure<T>(capacityFor(size)),
+  _enqueuePosition(0U),
+  _dequeuePosition(0U),
+  _producersWaiting(0U),
+  _consumersWaiting(0U),
+  _sequences(new(std::nothrow) std::atomic<unsigned int>[capacityFor(size)]),
+  _mask(capacityFor(size) - 1U)
+
+{
+  if (_sequences == NULL)
+  {
+    throw OperationFailed("Could not allocate enough memory for this data structure.",
+      __FILE__, __LINE__);
+  }
+
+  resetSequences();
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> SConcurrentQueue<T>::SConcurrentQueue
+(
+  const unsigned int      size,            // the no. of elements that the queue must hold
+  const DataStructure<T>& source           // the data structure to copy the elements of
+):
+
+/*
+This constructor instanciates a queue with room for at least "size" elements and enqueues
+copies of "source's" elements (refer to "concatenate()").
+*/
+
+  SDataStructure<T>(capacityFor(size)),
+  _enqueuePosition(0U),
+  _dequeuePosition(0U),
+  _producersWaiting(0U),
+  _consumersWaiting(0U),
+  _sequences(new(std::nothrow) std::atomic<unsigned int>[capacityFor(size)]),
+  _mask(capacityFor(size) - 1U)
+
+{
+  if (_sequences == NULL)
+  {
+    throw OperationFailed("Could not allocate enough memory for this data structure.",
+      __FILE__, __LINE__);
+  }
+
+  resetSequences();
+  concatenate(source);
+  recount();
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> SConcurrentQueue<T>::~SConcurrentQueue()
+
+{
+  empty();
+  delete[] _sequences;
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> SConcurrentQueue<T>& SConcurrentQueue<T>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  empty();
+  concatenate(source);
+  recount();
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> SConcurrentQueue<T>& SConcurrentQueue<T>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  recount();
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> const unsigned int SConcurrentQueue<T>::numQueued() const noexcept
+
+/*
+This method returns the no. of elements in the queue (including any that are being enqueued or
+dequeued at the moment).  Any thread may call it, in which case the answer is a snapshot.
+*/
+
+{
+  const unsigned int head = _dequeuePosition.load(std::memory_order_acquire);
+  const unsigned int tail = _enqueuePosition.load(std::memory_order_acquire);
+
+  /*
+  "_dequeuePosition" is read first, so it can only be behind -- never ahead of --
+  "_enqueuePosition" (refer to "SRing<T>::numQueued()").
+  */
+
+  return std::min(tail - head, this->size());
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::recount() noexcept
+
+/*
+This method brings "numElements()" up to date.
+
+PRECONDITIONS:
+No other thread may be using the queue.
+*/
+
+{
+  this->_numElements = tailPosition() - headPosition();
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::empty() noexcept
+
+/*
+This method destroys every element in the queue.
+
+PRECONDITIONS:
+No other thread may be using the queue.
+
+POSTCONDITIONS:
+The queue is empty.
+*/
+
+{
+  const unsigned int tail = tailPosition();
+
+  for (unsigned int position = headPosition(); position != tail; ++position)
+  {
+    this->destroy(position & _mask);
+    _sequences[position & _mask].store(position + this->size(), std::memory_order_relaxed);
+  }
+
+  _dequeuePosition.store(tail, std::memory_order_release);
+  this->_numElements = 0U;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method enqueues copies of "source's" elements in "source's" iteration order, all at once
+(refer to "enqueue(const T *const, const unsigned int)").  Other threads may be using this
+queue, but not "source".
+
+If "source's" elements are contiguous and in iterative order (refer to
+"DataStructure<T>::contiguousElements()") then they're copied straight into the queue;
+otherwise they're copied out first.
+
+PRECONDITIONS:
+There must be room in the queue for copies of all of "source's" elements.
+
+POSTCONDITIONS:
+"source's" elements are enqueued consecutively, so no other thread's elements are between them.
+*/
+
+{
+  const unsigned int count = source.numElements();
+  bool               isReversed;
+  const T *const     block   = source.contiguousElements(isReversed);
+
+  if (count == 0U)
+    return;
+
+  if (block != NULL && !isReversed)
+  {
+    enqueue(block, count);
+    return;
+  }
+
+  std::vector<T> copies;
+
+  try
+  {
+    copies.reserve(count);
+
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+    for (; i->more(); i->next())
+    {
+      assert(i->current() != NULL);
+      copies.push_back(*i->current());
+    }
+  }
+  catch (...)
+  {
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  enqueueMoved(copies.data(), (unsigned int)copies.size());
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::enqueue
+(
+  const T& elementToEnqueue                            // the element to be placed on the queue
+)
+
+/*
+This method enqueues a copy of "elementToEnqueue".  Refer to "tryEnqueue()".
+
+PRECONDITIONS:
+The queue cannot be full.
+
+POSTCONDITIONS:
+The copy of "elementToEnqueue" is enqueued.
+*/
+
+{
+  if (!tryEnqueue(elementToEnqueue))
+    throw Full(__FILE__, __LINE__);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::enqueue
+(
+  T&& elementToEnqueue                                // the element to be moved onto the queue
+)
+
+/*
+This method moves "elementToEnqueue" onto the queue.  Otherwise, it's the same as the other
+"enqueue()".
+*/
+
+{
+  if (!tryEnqueue(std::move(elementToEnqueue)))
+    throw Full(__FILE__, __LINE__);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const bool SConcurrentQueue<T>::tryEnqueue
+(
+  const T& elementToEnqueue                            // the element to be placed on the queue
+)
+
+/*
+This method enqueues a copy of "elementToEnqueue" and returns true, or returns false if the
+queue is full.  If "T's" copy constructor can throw then the copy is made before a cell is
+claimed, and "OperationFailed" is thrown if it fails.
+
+POSTCONDITIONS:
+If true is returned then the copy of "elementToEnqueue" is enqueued.
+*/
+
+{
+  unsigned int position;
+
+  if (!std::is_nothrow_copy_constructible<T>::value)
+  {
+    try
+    {
+      return tryEnqueue(T(elementToEnqueue));
+    }
+    catch (...)
+    {
+      throw OperationFailed("Unable to copy an element.", __FILE__, __LINE__);
+    }
+  }
+
+  if (!claim(_enqueuePosition, 0U, 1U, position))
+    return false;
+
+  this->construct(position & _mask, elementToEnqueue);
+  publish(position, 1U, 1U, _consumersWaiting);
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T> const bool SConcurrentQueue<T>::tryEnqueue
+(
+  T&& elementToEnqueue                                // the element to be moved onto the queue
+)
+noexcept
+
+/*
+This method moves "elementToEnqueue" onto the queue and returns true, or returns false (and
+leaves "elementToEnqueue" alone) if the queue is full.
+*/
+
+{
+  unsigned int position;
+
+  if (!claim(_enqueuePosition, 0U, 1U, position))
+    return false;
+
+  this->construct(position & _mask, std::move(elementToEnqueue));
+  publish(position, 1U, 1U, _consumersWaiting);
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::enqueue
+(
+  const T *const     elementsToEnqueue,          // the block of elements to enqueue
+  const unsigned int count                       // the no. of elements in the block
+)
+
+/*
+This method enqueues copies of the "count" elements in "elementsToEnqueue", in order.  The
+"count" cells are claimed at once, so no other thread's elements are enqueued between them.
+If "T" is trivially copyable then the elements are copied with at most two "memcpy()" calls.
+If "T's" copy constructor can throw then the copies are made before the cells are claimed.
+
+PRECONDITIONS:
+There must be "count" free cells in the queue.
+
+POSTCONDITIONS:
+"elementsToEnqueue[0]" will be the first of the new elements to be dequeued and
+"elementsToEnqueue[count - 1]" will be the last.
+*/
+
+{
+  unsigned int position;
+
+  if (count == 0U)
+    return;
+
+  assert(elementsToEnqueue != NULL);
+
+  if (!std::is_nothrow_copy_constructible<T>::value)
+  {
+    std::vector<T> copies;
+
+    try
+    {
+      copies.assign(elementsToEnqueue, elementsToEnqueue + count);
+    }
+    catch (...)
+    {
+      throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+    }
+
+    enqueueMoved(copies.data(), count);
+    return;
+  }
+
+  if (count > this->size() || !claim(_enqueuePosition, 0U, count, position))
+    throw Full(__FILE__, __LINE__);
+
+  const unsigned int firstCell  = position & _mask;
+  const unsigned int firstCount = std::min(count, this->size() - firstCell);
+
+  this->constructCopies(firstCell, elementsToEnqueue, firstCount, false);
+  this->constructCopies(0U, elementsToEnqueue + firstCount, count - firstCount, false);
+  publish(position, count, 1U, _consumersWaiting);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::dequeue
+(
+  T& dequeuedElement                            // the variable to receive the dequeued element
+)
+
+/*
+This method dequeues the element at the head of the queue and moves it to "dequeuedElement".
+Refer to "tryDequeue()".
+
+PRECONDITIONS:
+The queue cannot be empty.
+
+POSTCONDITIONS:
+The element at the head of the queue is moved to "dequeuedElement" and removed from the queue.
+*/
+
+{
+  if (!tryDequeue(dequeuedElement))
+    throw Empty(__FILE__, __LINE__);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const bool SConcurrentQueue<T>::tryDequeue
+(
+  T& dequeuedElement                            // the variable to receive the dequeued element
+)
+noexcept
+
+/*
+This method dequeues the element at the head of the queue, moves it to "dequeuedElement" and
+returns true, or returns false if the queue is empty.
+
+POSTCONDITIONS:
+If true is returned then the element that was at the head of the queue is moved to
+"dequeuedElement" and removed from the queue.
+*/
+
+{
+  unsigned int position;
+
+  if (!claim(_dequeuePosition, 1U, 1U, position))
+    return false;
+
+  this->moveElement(dequeuedElement, this->elements()[position & _mask]);
+  this->destroy(position & _mask);
+  publish(position, 1U, this->size(), _producersWaiting);
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::dequeue
+(
+  T *const           dequeuedElements,        // the block to receive the dequeued elements
+  const unsigned int count                    // the no. of elements to dequeue
+)
+
+/*
+This method dequeues "count" consecutive elements from the head of the queue and moves them,
+in order, to "dequeuedElements".  If "T" is trivially copyable then the elements are copied
+out with at most two "memcpy()" calls.
+
+PRECONDITIONS:
+There must be at least "count" elements at the head of the queue that have been completely
+enqueued.
+
+POSTCONDITIONS:
+The "count" elements at the head of the queue are moved to "dequeuedElements[0]" through
+"dequeuedElements[count - 1]" and removed from the queue.
+*/
+
+{
+  unsigned int position;
+
+  if (count == 0U)
+    return;
+
+  assert(dequeuedElements != NULL);
+
+  if (count > this->size() || !claim(_dequeuePosition, 1U, count, position))
+    throw Empty(__FILE__, __LINE__);
+
+  const unsigned int firstCell  = position & _mask;
+  const unsigned int firstCount = std::min(count, this->size() - firstCell);
+
+  if constexpr (std::is_trivially_copyable<T>::value)
+  {
+    memcpy(dequeuedElements, this->elements() + firstCell, sizeof(T) * firstCount);
+    memcpy(dequeuedElements + firstCount, this->elements(), sizeof(T) * (count - firstCount));
+  }
+  else
+  {
+    for (unsigned int i = 0U; i < count; ++i)
+      this->moveElement(dequeuedElements[i], this->elements()[(position + i) & _mask]);
+  }
+
+  this->destroy(firstCell, firstCount);
+  this->destroy(0U, count - firstCount);
+  publish(position, count, this->size(), _producersWaiting);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::blockingEnqueue
+(
+  const T& elementToEnqueue                            // the element to be placed on the queue
+)
+
+/*
+This method enqueues a copy of "elementToEnqueue", waiting for room if the queue is full.  If
+"T's" copy constructor can throw then the copy is made (once) before waiting, and
+"OperationFailed" is thrown if it fails.
+*/
+
+{
+  if (!std::is_nothrow_copy_constructible<T>::value)
+  {
+    try
+    {
+      blockingEnqueue(T(elementToEnqueue));
+    }
+    catch (...)
+    {
+      throw OperationFailed("Unable to copy an element.", __FILE__, __LINE__);
+    }
+
+    return;
+  }
+
+  for (unsigned int tries = 0U; !tryEnqueue(elementToEnqueue); ++tries)
+  {
+    if (tries < SPIN_LIMIT)
+      relax();
+    else
+      sleep(_enqueuePosition, _producersWaiting, 0U);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::blockingEnqueue
+(
+  T&& elementToEnqueue                                // the element to be moved onto the queue
+)
+noexcept
+
+/*
+This method moves "elementToEnqueue" onto the queue, waiting for room if the queue is full.
+It spins for up to "SPIN_LIMIT" tries and then sleeps until a consumer frees the cell that it's
+waiting for.
+*/
+
+{
+  for (unsigned int tries = 0U; !tryEnqueue(std::move(elementToEnqueue)); ++tries)
+  {
+    if (tries < SPIN_LIMIT)
+      relax();
+    else
+      sleep(_enqueuePosition, _producersWaiting, 0U);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::blockingDequeue
+(
+  T& dequeuedElement                            // the variable to receive the dequeued element
+)
+noexcept
+
+/*
+This method dequeues the element at the head of the queue and moves it to "dequeuedElement",
+waiting for an element if the queue is empty.  It spins for up to "SPIN_LIMIT" tries and then
+sleeps until a producer fills the cell that it's waiting for.
+*/
+
+{
+  for (unsigned int tries = 0U; !tryDequeue(dequeuedElement); ++tries)
+  {
+    if (tries < SPIN_LIMIT)
+      relax();
+    else
+      sleep(_dequeuePosition, _consumersWaiting, 1U);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::peek
+(
+  T& elementToBeDequeued             // the variable to receive the next element to be dequeued
+)
+const
+
+/*
+This method copies the element at the head of the queue to "elementToBeDequeued" without
+dequeuing it.
+
+PRECONDITIONS:
+The queue cannot be empty.  No other thread may be dequeuing from the queue.
+
+POSTCONDITIONS:
+The element at the head of the queue is copied to "elementToBeDequeued".
+*/
+
+{
+  const unsigned int head = headPosition();
+
+  if (_sequences[head & _mask].load(std::memory_order_acquire) != head + 1U)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    elementToBeDequeued = this->elements()[head & _mask];
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to copy an element from an SConcurrentQueue.", __FILE__,
+      __LINE__);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void SConcurrentQueue<T>::assertInvariants() const noexcept
+
+  /*
+  Other threads can move the positions at any moment, so only the things that can't change are
+  checked.
+  */
+
+  {
+    SDataStructure<T>::assertInvariants();
+
+    assert(this->size() >= 2U && (this->size() & _mask) == 0U);
+    assert(_sequences != NULL);
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> const bool SConcurrentQueue<T>::claim
+(
+  std::atomic<unsigned int>& counter,         // "_enqueuePosition" or "_dequeuePosition"
+  const unsigned int         lag,             // 0 to claim free cells, 1 to claim elements
+  const unsigned int         count,           // the no. of consecutive cells to claim
+  unsigned int&              position         // receives the first claimed position
+)
+noexcept
+
+/*
+This method claims the "count" positions starting at "counter" and returns true, or returns
+false if any of their cells isn't ready -- that is, if its sequence no. isn't its position plus
+"lag".  If another thread claims some of the positions first then it tries again from the new
+"counter".
+
+A sequence no. that's behind means that the queue is full (or empty); one that's ahead means
+that "position" is stale.  The sequence nos. are acquired, so the elements' construction (or
+destruction) by the threads that published them has happened before this thread touches the
+cells.
+*/
+
+{
+  assert(count > 0U && count <= this->size());
+
+  position = counter.load(std::memory_order_relaxed);
+
+  for (;;)
+  {
+    unsigned int i(0U);
+    bool         isStale(false);
+
+    for (; i < count; ++i)
+    {
+      const unsigned int sequence =
+        _sequences[(position + i) & _mask].load(std::memory_order_acquire);
+      const int          difference = (int)(sequence - (position + i + lag));
+
+      if (difference < 0)
+        return false;
+
+      if (difference > 0)
+      {
+        isStale = true;
+        break;
+      }
+    }
+
+    if (isStale)
+      position = counter.load(std::memory_order_relaxed);
+    else if (counter.compare_exchange_weak(position, position + count,
+      std::memory_order_relaxed, std::memory_order_relaxed))
+      return true;
+  }
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::publish
+(
+  const unsigned int         position,        // the first claimed position
+  const unsigned int         count,           // the no. of claimed positions
+  const unsigned int         advance,         // 1 to publish elements, "size()" to free cells
+  std::atomic<unsigned int>& waiting          // the no. of threads waiting for these cells
+)
+noexcept
+
+/*
+This method hands the "count" cells starting at "position" on to the other side -- to consumers
+if "advance" is 1 and to producers if it's "size()" -- and wakes any of the other side's
+threads that are asleep waiting for them.
+*/
+
+{
+  for (unsigned int i = 0U; i < count; ++i)
+  {
+    _sequences[(position + i) & _mask].store(position + i + advance,
+      std::memory_order_release);
+  }
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (waiting.load(std::memory_order_relaxed) != 0U)
+  {
+    for (unsigned int i = 0U; i < count; ++i)
+      _sequences[(position + i) & _mask].notify_all();
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::sleep
+(
+  std::atomic<unsigned int>& counter,         // "_enqueuePosition" or "_dequeuePosition"
+  std::atomic<unsigned int>& waiting,         // "_producersWaiting" or "_consumersWaiting"
+  const unsigned int         lag              // 0 to wait for room, 1 to wait for an element
+)
+noexcept
+
+/*
+This method puts the calling thread to sleep until the cell at "counter" changes state, unless
+it's already ready (or "counter" has moved on).  It may return early; the caller just tries
+again.
+*/
+
+{
+  const unsigned int         position = counter.load(std::memory_order_relaxed);
+  std::atomic<unsigned int>& sequence = _sequences[position & _mask];
+  const unsigned int         observed = sequence.load(std::memory_order_acquire);
+
+  if (observed == position + lag)
+    return;
+
+  waiting.fetch_add(1U, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (counter.load(std::memory_order_relaxed) == position)
+    sequence.wait(observed, std::memory_order_acquire);
+
+  waiting.fetch_sub(1U, std::memory_order_relaxed);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::enqueueMoved
+(
+  T *const           block,                          // the elements to move into the queue
+  const unsigned int count                           // the no. of elements in "block"
+)
+
+/*
+This method claims "count" consecutive cells and moves "block's" elements into them.  It's the
+second half of the bulk operations for a "T" whose copies can throw.
+*/
+
+{
+  unsigned int position;
+
+  if (count == 0U)
+    return;
+
+  if (count > this->size() || !claim(_enqueuePosition, 0U, count, position))
+    throw Full(__FILE__, __LINE__);
+
+  for (unsigned int i = 0U; i < count; ++i)
+    this->construct((position + i) & _mask, std::move(block[i]));
+
+  publish(position, count, 1U, _consumersWaiting);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentQueue<T>::resetSequences() noexcept
+
+/*
+This method gives every cell the sequence no. of a free cell in the first lap from the current
+head.  The queue must be empty.
+*/
+
+{
+  const unsigned int head = headPosition();
+
+  assert(head == tailPosition());
+
+  for (unsigned int i = 0U; i < this->size(); ++i)
+    _sequences[(head + i) & _mask].store(head + i, std::memory_order_relaxed);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline void SConcurrentQueue<T>::relax() noexcept
+
+/*
+This routine tells the processor that the calling thread is spinning, which saves power and
+lets a hyper-threaded sibling run, or yields the processor where there's no such hint.
+*/
+
+{
+  #if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+  #else
+    std::this_thread::yield();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const unsigned int SConcurrentQueue<T>::capacityFor
+(
+  const unsigned int size                           // the no. of elements that must fit
+)
+
+/*
+This function returns the smallest power of two that's at least "size" and at least 2 (a
+single cell's sequence no. couldn't tell a full queue from an empty one).
+*/
+
+{
+  const unsigned int largest = ~(~0U >> 1U);      // the largest power of two that fits
+  unsigned int       capacity(2U);
+
+  if (size > largest)
+    throw OperationFailed("An SConcurrentQueue can't be that large.", __FILE__, __LINE__);
+
+  while (capacity < size)
+    capacity <<= 1U;
+
+  return capacity;
+}
+
+#endif
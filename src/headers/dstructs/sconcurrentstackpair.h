@@ -0,0 +1,759 @@
+#ifndef DSTRUCTS_SCONCURRENTSTACKPAIR_H
+#define DSTRUCTS_SCONCURRENTSTACKPAIR_H
+
+// ============================================================================================
+//
+// sconcurrentstackpair.h -- Implementation of a pair of static stacks that share one array and
+// that two threads -- one per stack -- can use at the same time without any locks.
+//
+// ============================================================================================
+
+/*
+This class is a pair of stacks that share a fixed-size array, like "SStackPair", except that
+the two stacks are meant to be used by two different threads at once.  Each stack is an "End"
+(which is a "Stack"), and "stack(0)" and "stack(1)" return them.  There's no "select()" -- each
+thread simply keeps a reference to its own stack:
+
+  SConcurrentStackPair<Record> pair(4096U);
+
+  std::thread producer0([&pair] {Stack<Record>& mine = pair.stack(0); ... mine.push(r); ...});
+  std::thread producer1([&pair] {Stack<Record>& mine = pair.stack(1); ... mine.push(r); ...});
+
+The two stacks draw on the same memory budget:  either one can grow until the array is full,
+no matter how much of it the other one is using.
+
+Each stack must have a single owner thread at a time.  Only its owner may push onto it, pop
+off of it, empty it, peek at it, iterate it or ask it for its "numElements()".  The owners of
+the two stacks never wait for each other.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+The layout is the same as "SStackPair's":  stack #0 grows up from cell 0 and stack #1 grows
+down from cell "size() - 1".
+
+   0:        1:        2:              size-3:   size-2:   size-1:
+  +---------+---------+---------+   +---------+---------+---------+
+  | #0 1st  | #0 2nd  |    ?    | ... |    ?    | #1 2nd  | #1 1st  |
+  +---------+---------+---------+   +---------+---------+---------+
+   <---- stack #0's _top = 2 ---->       <---- stack #1's _top = 2 ---->
+
+Each "End" has an atomic "_top":  the no. of cells that it has claimed from its end of the
+array.  Only the owner thread changes it, and the only thing that the other thread does with it
+is read it to see whether there's room.  Since the two owners never write the same memory,
+there's no lock and no compare-and-swap -- and, since each "End" is aligned to (and padded
+out to) a whole cache line, a push on one stack doesn't invalidate the cache line that the
+other owner is working on.
+
+The only race is for the last free cells.  A push claims its cells first -- it stores its new
+"_top" -- and only then reads the other stack's "_top" to see whether the two claims overlap.
+Both are sequentially-consistent operations, so if the two owners claim the same cell at the
+same time then at least one of them sees the other's claim.  Whoever sees an overlap withdraws
+its claim and throws "Full".  Occasionally both of them do, so a pair with a single free cell
+may refuse two simultaneous pushes -- it's full for practical purposes anyway.
+
+A pop destroys the element before it releases the cell (with a release store of "_top"), and a
+push acquires the other "_top" before it constructs anything, so a cell that passes from one
+stack to the other is never in use by both threads.
+
+"_numElements" (in "DataStructure_") is the owner's count of constructed elements, and it
+equals "_top" except while a push or "concatenate()" is under way.  The elements themselves are
+only ever touched by their stack's owner, so they need no synchronization at all.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include <dstructs/stack.h>
+
+// ============================================================================================
+// SCONCURRENTSTACKPAIR<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class SConcurrentStackPair:
+  virtual public DataStructureExceptions
+{
+  public:
+    static const size_t CACHE_LINE_SIZE = 64U;
+
+    class End;
+
+                       SConcurrentStackPair(const unsigned int);
+                       ~SConcurrentStackPair();
+
+    const unsigned int size() const noexcept
+                         {return _size;}
+    const bool         isFull() const noexcept;
+
+    End&               stack(const unsigned int);
+    const End&         stack(const unsigned int) const;
+
+    /*
+    An "End" is one of the two stacks.  Pairs create them; nothing else can.
+    */
+
+    class alignas(CACHE_LINE_SIZE) End:
+      virtual public DataStructureExceptions,
+      virtual public Stack<T>
+    {
+      public:
+        virtual              ~End()
+                               {return;}
+
+        End&                 operator=(const DataStructure<T>&);
+        End&                 operator+=(const DataStructure<T>&);
+
+        /*
+        The element iterators walk the stack from its top down, like "iterator()" does.  Stack
+        #0 runs toward cell 0 and stack #1 runs toward cell "size() - 1", so an iterator keeps
+        a step of -1 or +1 and incrementing it is a single index addition.
+        */
+
+        template<class Element> class CellIterator
+        {
+          public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T                         value_type;
+            typedef ptrdiff_t                 difference_type;
+            typedef Element*                  pointer;
+            typedef Element&                  reference;
+
+                          CellIterator(Element *const cells = NULL, const ptrdiff_t index = 0,
+                            const ptrdiff_t step = 1) noexcept:
+                            _cells(cells), _index(index), _step(step) {return;}
+                          CellIterator(const CellIterator<T>& source) noexcept:
+                            _cells(source._cells), _index(source._index),
+                            _step(source._step) {return;}
+
+            Element&      operator*() const noexcept
+                            {return _cells[_index];}
+            Element*      operator->() const noexcept
+                            {return _cells + _index;}
+            CellIterator& operator++() noexcept
+                            {_index += _step; return *this;}
+            CellIterator  operator++(int) noexcept
+                            {const CellIterator old(*this); _index += _step; return old;}
+
+            const bool    operator==(const CellIterator& rhs) const noexcept
+                            {return _index == rhs._index;}
+            const bool    operator!=(const CellIterator& rhs) const noexcept
+                            {return _index != rhs._index;}
+
+          private:
+            Element*  _cells;                 // cell 0 of the array
+            ptrdiff_t _index;                 // index of the current element
+            ptrdiff_t _step;                  // -1 for stack #0, +1 for stack #1
+
+            friend class CellIterator<const T>;
+        };
+
+        typedef CellIterator<T>       ElementIterator;
+        typedef CellIterator<const T> ConstElementIterator;
+
+        ElementIterator      begin() noexcept
+                               {return cellIterator<T>(false);}
+        ElementIterator      end() noexcept
+                               {return cellIterator<T>(true);}
+        ConstElementIterator begin() const noexcept
+                               {return cellIterator<const T>(false);}
+        ConstElementIterator end() const noexcept
+                               {return cellIterator<const T>(true);}
+
+        // DataStructure<T> methods
+
+        virtual void         empty() noexcept;
+
+        virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                               {return DataStructure<T>::newIterator(*this);}
+
+        // LinearStructure<T> methods
+
+        virtual void         concatenate(const DataStructure<T>&);
+
+        // Stack<T> methods
+
+        virtual void         push(const T&);
+        virtual void         push(T&&);
+        virtual void         pop(T&);
+        virtual void         peek(T&) const;
+
+        template<class... Args>
+        void                 emplace(Args&&...);
+
+      protected:
+        virtual const T *const contiguousElements(bool&) const noexcept;
+
+        #ifndef NDEBUG
+          virtual void       assertInvariants() const noexcept;
+        #endif
+
+      private:
+        T *const                  _cells;       // cell 0 of the shared array
+        const unsigned int        _size;        // no. of cells in the shared array
+        const unsigned int        _which;       // 0 for stack #0, 1 for stack #1
+        const End*                _other;       // the other stack in the pair
+        std::atomic<unsigned int> _top;         // no. of cells claimed from this end
+
+                             End(T *const, const unsigned int, const unsigned int) noexcept;
+                             End(const End&);                      // not implemented
+
+        T *const             cell(const unsigned int position) const noexcept
+                               {return _cells + (_which == 0U ? position :
+                                 _size - 1U - position);}
+        const unsigned int   claim(const unsigned int);
+
+        template<class Element>
+        CellIterator<Element> cellIterator(const bool) const noexcept;
+
+        friend class SConcurrentStackPair<T>;
+    };
+
+  protected:
+    #ifndef NDEBUG
+      virtual void     assertInvariants() const noexcept;
+    #endif
+
+  private:
+    T *const           _cells;               // the shared array (raw storage), or NULL if none
+    const unsigned int _size;                // no. of cells in the array
+    End                _stack0;              // stack #0, which grows up from cell 0
+    End                _stack1;              // stack #1, which grows down from the last cell
+
+    SConcurrentStackPair(const SConcurrentStackPair<T>&);                 // not implemented
+    SConcurrentStackPair<T>& operator=(const SConcurrentStackPair<T>&);   // not implemented
+};
+
+// ============================================================================================
+// SCONCURRENTSTACKPAIR<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> SConcurrentStackPair<T>::SConcurrentStackPair
+(
+  const unsigned int size            // the no. of elements that the two stacks can hold
+):                                   //   between them
+  _cells(size == 0U ? NULL : static_cast<T*>(::operator new(sizeof(T) * size,
+    std::align_val_t(alignof(T)), std::nothrow))),
+  _size(size),
+  _stack0(_cells, size, 0U),
+  _stack1(_cells, size, 1U)
+
+/*
+This constructor instanciates an empty pair of stacks that share room for "size" elements.  No
+"T" constructors are called.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+Both stacks are empty.
+*/
+
+{
+  if (size > 0U && _cells == NULL)
+  {
+    throw OperationFailed("Could not allocate enough memory for this data structure.",
+      __FILE__, __LINE__);
+  }
+
+  _stack0._other = &_stack1;
+  _stack1._other = &_stack0;
+
+  #ifndef NDEBUG
+    SConcurrentStackPair<T>::assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> SConcurrentStackPair<T>::~SConcurrentStackPair()
+
+/*
+This destructor destroys both stacks' elements and releases the array.  Neither owner thread
+may be using its stack by now.
+*/
+
+{
+  _stack0.empty();
+  _stack1.empty();
+
+  ::operator delete(_cells, std::align_val_t(alignof(T)));
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const bool SConcurrentStackPair<T>::isFull() const noexcept
+
+/*
+This method returns true iff the two stacks have claimed every cell between them.  While either
+owner is pushing or popping, the answer is only a snapshot.
+*/
+
+{
+  return _stack0._top.load(std::memory_order_acquire) +
+    _stack1._top.load(std::memory_order_acquire) >= _size;
+}
+
+/*********************************************************************************************/
+
+template<class T> typename SConcurrentStackPair<T>::End& SConcurrentStackPair<T>::stack
+(
+  const unsigned int which                                   // the stack to get (0 or 1)
+)
+
+/*
+This method returns stack #"which".  The returned stack must only be used by its owner thread.
+*/
+
+{
+  if (which > 1U)
+    throw OperationFailed("There are only two stacks in a pair.", __FILE__, __LINE__);
+
+  return which == 0U ? _stack0 : _stack1;
+}
+
+/*********************************************************************************************/
+
+template<class T> const typename SConcurrentStackPair<T>::End& SConcurrentStackPair<T>::stack
+(
+  const unsigned int which                                   // the stack to get (0 or 1)
+)
+const
+
+{
+  if (which > 1U)
+    throw OperationFailed("There are only two stacks in a pair.", __FILE__, __LINE__);
+
+  return which == 0U ? _stack0 : _stack1;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void SConcurrentStackPair<T>::assertInvariants() const noexcept
+
+  /*
+  Only the wiring between the two stacks is checked here; each stack checks its own "_top".
+  */
+
+  {
+    assert(_size == 0U || _cells != NULL);
+    assert(_stack0._which == 0U && _stack1._which == 1U);
+    assert(_stack0._other == &_stack1 && _stack1._other == &_stack0);
+
+    return;
+  }
+#endif
+
+// ============================================================================================
+// SCONCURRENTSTACKPAIR<T>::END METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> SConcurrentStackPair<T>::End::End
+(
+  T *const           cells,                                  // cell 0 of the shared array
+  const unsigned int size,                                   // no. of cells in the array
+  const unsigned int which                                   // which stack this is (0 or 1)
+)
+noexcept:
+  _cells(cells),
+  _size(size),
+  _which(which),
+  _other(NULL),
+  _top(0U)
+
+{
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T>
+typename SConcurrentStackPair<T>::End& SConcurrentStackPair<T>::End::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  empty();
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> typename SConcurrentStackPair<T>::End&
+  SConcurrentStackPair<T>::End::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentStackPair<T>::End::empty() noexcept
+
+/*
+This method destroys every element on the stack and hands all of its cells back, so the other
+stack can grow into them.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+The stack is empty.
+*/
+
+{
+  for (unsigned int position = 0U; position < this->_numElements; ++position)
+    cell(position)->~T();
+
+  this->_numElements = 0U;
+  _top.store(0U, std::memory_order_release);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentStackPair<T>::End::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method pushes copies of "source's" elements onto the stack.  As with "SStack", the first
+element in "source's" iteration order will be the first element to be popped off of the stack.
+
+All of the cells are claimed at once, so either there's room for every element or "Full" is
+thrown and nothing changes.  If copying an element fails then the copies already made are
+destroyed and the cells are handed back.
+
+PRECONDITIONS:
+There must be enough free cells in the pair for copies of "source's" elements.
+
+POSTCONDITIONS:
+"source's" elements are on top of the stack's original elements.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int numToCopy = source.numElements();
+
+  if (numToCopy > 0U)
+  {
+    const unsigned int bottom = claim(numToCopy);
+    unsigned int       position(bottom + numToCopy);
+
+    try
+    {
+      const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+      for (; i->more(); i->next())
+      {
+        assert(position > bottom);
+        new(cell(position - 1U)) T(*i->current());
+        --position;
+      }
+    }
+    catch (...)
+    {
+      for (; position < bottom + numToCopy; ++position)
+        cell(position)->~T();
+
+      _top.store(bottom, std::memory_order_relaxed);
+      throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+    }
+
+    assert(position == bottom);
+    this->_numElements = bottom + numToCopy;
+  }
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentStackPair<T>::End::push
+(
+  const T& elementToPush                               // the element to be placed on the stack
+)
+
+/*
+This method pushes a copy of "elementToPush" onto the stack.
+
+PRECONDITIONS:
+The pair cannot be full.
+
+POSTCONDITIONS:
+The copy of "elementToPush" will be added at the top of the stack.
+*/
+
+{
+  emplace(elementToPush);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentStackPair<T>::End::push
+(
+  T&& elementToPush                                 // the element to be moved onto the stack
+)
+
+/*
+This method moves "elementToPush" onto the stack.  Otherwise, it's the same as the other
+"push()".
+*/
+
+{
+  emplace(std::move(elementToPush));
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void SConcurrentStackPair<T>::End::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" directly in the cell just above the top
+of the stack.  The cell is claimed before anything is constructed; if the "T" constructor
+throws then the cell is handed back and the exception is passed on.
+
+PRECONDITIONS:
+The pair cannot be full.
+
+POSTCONDITIONS:
+The new element will be at the top of the stack and will be the first element to be popped off.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int position = claim(1U);
+
+  try
+  {
+    new(cell(position)) T(std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    _top.store(position, std::memory_order_relaxed);
+    throw;
+  }
+
+  ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentStackPair<T>::End::pop
+(
+  T& poppedElement                                // the variable to receive the popped element
+)
+
+/*
+This method pops the topmost element off of the stack and moves it to "poppedElement" (refer to
+"LinearStructure<T>::moveElement()").  Its cell is handed back only after the element has
+been destroyed, so the other stack can't claim it too early.
+
+PRECONDITIONS:
+The stack cannot be empty.
+
+POSTCONDITIONS:
+The element that was on top of the stack is moved to "poppedElement" and removed from the
+stack.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  T *const topCell = cell(this->_numElements - 1U);
+
+  this->moveElement(poppedElement, *topCell);
+  topCell->~T();
+  --this->_numElements;
+  _top.store(this->_numElements, std::memory_order_release);
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SConcurrentStackPair<T>::End::peek
+(
+  T& elementToBePopped                 // the variable to receive the next element to be popped
+)
+const
+
+/*
+This method copies the topmost element to "elementToBePopped" without popping it off.
+
+PRECONDITIONS:
+The stack cannot be empty.
+
+POSTCONDITIONS:
+The topmost element is copied to "elementToBePopped".
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  elementToBePopped = *cell(this->_numElements - 1U);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const T *const SConcurrentStackPair<T>::End::contiguousElements
+(
+  bool& isReversed                                          // which way the iteration runs
+)
+const noexcept
+
+/*
+Refer to "DataStructure<T>::contiguousElements()".  Stack #0's block is iterated from its
+highest cell down and stack #1's is iterated from its lowest cell up.
+*/
+
+{
+  if (this->_numElements == 0U)
+    return NULL;
+
+  isReversed = _which == 0U;
+  return _which == 0U ? _cells : _cells + _size - this->_numElements;
+}
+
+/*********************************************************************************************/
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void SConcurrentStackPair<T>::End::assertInvariants() const noexcept
+
+  /*
+  Only the owner thread changes "_top" and "_numElements", so they can be checked against each
+  other here.  The other stack's "_top" can change at any moment and isn't checked.
+  */
+
+  {
+    assert(_which <= 1U);
+    assert(_other != NULL);
+    assert(_top.load(std::memory_order_relaxed) == this->_numElements);
+    assert(this->_numElements <= _size);
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> const unsigned int SConcurrentStackPair<T>::End::claim
+(
+  const unsigned int count                                 // the no. of cells to claim
+)
+
+/*
+This method claims the next "count" cells above the top of the stack and returns the position
+of the first one, or throws "Full" if the other stack has (or is claiming) any of them.  Refer
+to the design notes for why the claim is stored before the other stack's "_top" is read.
+*/
+
+{
+  const unsigned int bottom = this->_numElements;
+
+  if (count > _size - bottom)
+    throw Full(__FILE__, __LINE__);
+
+  const unsigned int newTop = bottom + count;
+
+  _top.store(newTop, std::memory_order_seq_cst);
+
+  if (_other->_top.load(std::memory_order_seq_cst) > _size - newTop)
+  {
+    _top.store(bottom, std::memory_order_relaxed);
+    throw Full(__FILE__, __LINE__);
+  }
+
+  return bottom;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class Element>
+  inline typename SConcurrentStackPair<T>::End::template CellIterator<Element>
+  SConcurrentStackPair<T>::End::cellIterator
+(
+  const bool isEnd                                           // make an end iterator?
+)
+const noexcept
+
+/*
+This method returns an element iterator (or end iterator) for the stack.  The end of stack #0
+is index -1 and the end of stack #1 is index "size()".
+*/
+
+{
+  if (_which == 0U)
+  {
+    return CellIterator<Element>(_cells, isEnd ? -1 : (ptrdiff_t)this->_numElements - 1, -1);
+  }
+  else
+  {
+    return CellIterator<Element>(_cells, isEnd ? (ptrdiff_t)_size :
+      (ptrdiff_t)(_size - this->_numElements), 1);
+  }
+}
+
+#endif
@@ -3,34 +3,60 @@
 
 // ============================================================================================
 //
-// adatastructure.h -- Staticly-Allocated Data Structure Base Class
+// sdatastructure.h -- Staticly-Allocated Data Structure Base Class
 //
 // ============================================================================================
 
 /*
 This class is an abstract data type base class for all staticly-allocated data structures.
+
+An "SDataStructure" owns a fixed-size block of raw, suitably-aligned storage with room for
+"size()" elements.  No "T" is constructed when the storage is allocated -- descendents
+construct an element in a cell (with "construct()") when it's added to the structure and
+destroy it (with "destroy()") when it's removed.  Thus, creating a large structure takes the
+same time as creating a small one, and whatever memory a removed element held onto is released
+right away rather than when its cell is next overwritten.
+
+Descendents whose constructed cells hold their elements contiguously (in iterative order or in
+reverse) should override "contiguousElements()" so that other structures can copy from them in
+bulk.  "constructCopies()" is the other half of that:  it constructs a run of cells from such a
+block with "memcpy()" when "T" is trivially copyable and with a tight loop otherwise.
+
+Descendents are responsible for knowing which cells hold constructed elements.  They must
+destroy every element that they've constructed before the storage is released -- usually by
+calling "empty()" from their destructors.
 */
 
 // ============================================================================================
 // INCLUDE FILES
 // ============================================================================================
 
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 #include <dstructs/datastructure.h>
 
 // ============================================================================================
 // SDATASTRUCTURE_ CLASS DECLARATION
 // ============================================================================================
 
-class SDataStructure_
+class SDataStructure_:
+  virtual public DataStructure_
 {
   public:
                        SDataStructure_(const unsigned int initialSize):
                          _size(initialSize)
                          {return;}
 
-    const unsigned int size() const throw ()
+    const unsigned int size() const noexcept
                          {return _size;}
-    const bool         isFull() const throw ()
+    const bool         isFull() const noexcept
                          {return _numElements == _size;}
 
   private:
@@ -42,45 +68,245 @@ class SDataStructure_
 // ============================================================================================
 
 template<class T> class SDataStructure:
-  virtual public SDataStructure_
+  virtual public DataStructure<T>,
+  public SDataStructure_
 {
   public:
-                   SDataStructure(const unsigned int) throw
-                     (DataStructureExceptions::OperationFailed);
+                   SDataStructure(const unsigned int);
     virtual        ~SDataStructure()
-                     {delete[] _elements; return;}
+                     {::operator delete(_elements, std::align_val_t(alignof(T))); return;}
 
   protected:
-    T const*       elements()
-                     {return elements_;}
+    T *const       elements() const noexcept
+                     {return _elements;}
+
+    template<class... Args>
+    void           construct(const unsigned int, Args&&...);
+    void           constructDefault(const unsigned int, const unsigned int);
+    void           constructCopies(const unsigned int, const T *const, const unsigned int,
+                     const bool);
+    void           destroy(const unsigned int) noexcept;
+    void           destroy(const unsigned int, const unsigned int) noexcept;
 
     #ifndef NDEBUG
-      virtual void assertInvariants() const throw ()
-                     {assert((_size == 0U) == (_elements == null)); return;}
+      virtual void assertInvariants() const noexcept
+                     {
+                       assert((size() == 0U) == (_elements == NULL));
+                       assert(_numElements <= size());
+                       return;
+                     }
     #endif
 
   private:
-    T* elements;
+    T *const _elements;                   // raw storage for "size()" elements, or NULL if none
+
+    SDataStructure(const SDataStructure<T>&);                    // not implemented
+    SDataStructure<T>& operator=(const SDataStructure<T>&);      // not implemented
 };
 
 // ============================================================================================
 // SDATASTRUCTURE<T> METHODS
 // ============================================================================================
 
-template<class T> SDataStructure<T>::SDataStructure(const unsigned int initialSize):
+/*********************************************************************************************/
+
+template<class T> SDataStructure<T>::SDataStructure
+(
+  const unsigned int initialSize          // the no. of elements that the storage must hold
+):
 
 /*
+This constructor allocates uninitialized storage for "initialSize" elements.  No "T"
+constructors are called.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+The storage is allocated but holds no elements.
 */
 
 SDataStructure_(initialSize),
-_elements(initialSize == 0U ? null : new T[initialSize])
+_elements(initialSize == 0U ? NULL : static_cast<T*>(::operator new(sizeof(T) * initialSize,
+  std::align_val_t(alignof(T)), std::nothrow)))
 
 {
-  if (initialSize > 0U && _elements == null)
+  if (initialSize > 0U && _elements == NULL)
   {
     throw DataStructureExceptions::OperationFailed("Could not allocate enough memory for this "
       "data structure.", __FILE__, __LINE__);
   }
 
   return;
-}
\ No newline at end of file
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> inline void SDataStructure<T>::construct
+(
+  const unsigned int index,                         // the cell to construct the element in
+  Args&&...          arguments                      // the arguments to construct it from
+)
+
+/*
+This method constructs an element in cell "index" from "arguments".  Whatever the "T"
+constructor throws is passed on, in which case the cell is left unconstructed.
+
+PRECONDITIONS:
+"index" must be less than "size()" and cell "index" must not hold a constructed element.
+
+POSTCONDITIONS:
+Cell "index" holds a constructed element.
+*/
+
+{
+  assert(index < size());
+
+  new(_elements + index) T(std::forward<Args>(arguments)...);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SDataStructure<T>::constructDefault
+(
+  const unsigned int first,                         // the first cell to construct
+  const unsigned int count                          // the no. of cells to construct
+)
+
+/*
+This method default-initializes "count" cells starting at "first", the way "new T[count]"
+would.  If "T" is a type like "int" then no code is generated at all and the cells are
+uninitialized.
+
+If a "T" constructor throws then the cells that were already constructed are destroyed before
+the exception is passed on.
+
+PRECONDITIONS:
+The cells must not hold constructed elements.
+
+POSTCONDITIONS:
+The cells hold default-initialized elements.
+*/
+
+{
+  assert(first <= size() && count <= size() - first);
+
+  unsigned int index(first);
+
+  try
+  {
+    for (; index < first + count; ++index)
+      new(_elements + index) T;
+  }
+  catch (...)
+  {
+    destroy(first, index - first);
+    throw;
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SDataStructure<T>::constructCopies
+(
+  const unsigned int first,                         // the first cell to construct
+  const T *const     source,                        // the block of elements to copy
+  const unsigned int count,                         // the no. of elements in "source"
+  const bool         isReversed                     // copy "source" back to front?
+)
+
+/*
+This method copy-constructs "count" cells starting at "first" from the contiguous block
+"source".  If "isReversed" is false then cell "first" gets "source[0]", cell "first + 1" gets
+"source[1]" and so on; if it's true then the order is reversed, so cell "first" gets
+"source[count - 1]".
+
+If "T" is trivially copyable then no constructors are called at all -- a straight copy is one
+"memcpy()" and a reversed copy is one pass of "std::reverse_copy()".  Otherwise each cell is
+copy-constructed in turn and, if a "T" constructor throws, the cells that were already
+constructed are destroyed before the exception is passed on.
+
+PRECONDITIONS:
+The cells must not hold constructed elements and must not overlap "source".
+
+POSTCONDITIONS:
+The cells hold copies of "source's" elements.
+*/
+
+{
+  assert(first <= size() && count <= size() - first);
+  assert(count == 0U || source != NULL);
+
+  T *const destination = _elements + first;
+
+  if constexpr (std::is_trivially_copyable<T>::value)
+  {
+    if (count > 0U && !isReversed)
+      memcpy(destination, source, sizeof(T) * count);
+    else
+      std::reverse_copy(source, source + count, destination);
+  }
+  else
+  {
+    unsigned int index(0U);
+
+    try
+    {
+      for (; index < count; ++index)
+        new(destination + index) T(source[isReversed ? count - 1U - index : index]);
+    }
+    catch (...)
+    {
+      destroy(first, index);
+      throw;
+    }
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline void SDataStructure<T>::destroy
+(
+  const unsigned int index                        // the cell whose element is to be destroyed
+)
+noexcept
+
+{
+  assert(index < size());
+
+  _elements[index].~T();
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SDataStructure<T>::destroy
+(
+  const unsigned int first,                         // the first cell to destroy
+  const unsigned int count                          // the no. of cells to destroy
+)
+noexcept
+
+/*
+This method destroys the elements in "count" cells starting at "first".  If "T" has a trivial
+destructor then nothing is done at all.
+*/
+
+{
+  assert(first <= size() && count <= size() - first);
+
+  if constexpr (!std::is_trivially_destructible<T>::value)
+  {
+    for (unsigned int index = first; index < first + count; ++index)
+      _elements[index].~T();
+  }
+
+  return;
+}
+
+#endif
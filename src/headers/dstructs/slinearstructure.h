@@ -35,11 +35,11 @@ template<class T> class LinearStructure:
   virtual public DataStructure<T>
 {
   public:
-    LinearStructure<T>& operator=(const DataStructure<T>&)  throw (Full, OperationFailed);
-    LinearStructure<T>& operator+=(const DataStructure<T>&) throw (Full, OperationFailed);
+    LinearStructure<T>& operator=(const DataStructure<T>&);
+    LinearStructure<T>& operator+=(const DataStructure<T>&);
 
   protected:
-    virtual void        concatenate(const DataStructure<T>&) throw (Full, OperationFailed) = 0;
+    virtual void        concatenate(const DataStructure<T>&) = 0;
 };
 
 #if 0
@@ -55,7 +55,7 @@ template<class T> class SLinearStruct:
     const SDAP<T>           _elements;
     const SDP<unsigned int> _iterCurrent;
 
-    void assertInvariants() const throw ();
+    void assertInvariants() const noexcept;
 };
 
 #endif
@@ -70,7 +70,6 @@ template<class T> LinearStructure<T>& LinearStructure<T>::operator=
 (
   const DataStructure<T>& source
 )
-throw (DataStructureExceptions::Full, DataStructureExceptions::OperationFailed)
 
 {
   empty();
@@ -84,7 +83,6 @@ template<class T> LinearStructure<T>& LinearStructure<T>::operator+=
 (
   const DataStructure<T>& source
 )
-throw (DataStructureExceptions::Full, DataStructureExceptions::OperationFailed)
 
 {
   concatenate(source);
@@ -123,7 +121,7 @@ template<class T> SLinearStruct<T>::SLinearStruct
 
 /*********************************************************************************************/
 
-template<class T> void SLinearStruct<T>::assertInvariants() const throw ()
+template<class T> void SLinearStruct<T>::assertInvariants() const noexcept
 {
   assert(_numElements <= _maxElements);
   LinearStruct<T>::assertInvariants();
@@ -0,0 +1,777 @@
+#ifndef DSTRUCTS_SQUEUE_H
+#define DSTRUCTS_SQUEUE_H
+
+// ============================================================================================
+//
+// squeue.h -- Implementation of a static queue -- that is, a queue that stores its elements in
+// an array of fixed size.
+//
+// ============================================================================================
+
+/*
+This class is a static queue.  An "SQueue" is a "Queue".
+
+Unlike "SRing", an "SQueue" holds exactly as many elements as the size that's passed to its
+constructor and is meant to be used by one thread at a time.
+
+The array is "SDataStructure's" raw storage, used as a circular buffer.  "_head" is the cell
+that holds the next element to be dequeued; the elements follow it in order, wrapping around
+from the last cell to cell 0, and the next element to be enqueued goes into the cell
+"_numElements" cells after "_head":
+
+  0:        1:        2:        3:        4:        5:        6:
+  +---------+---------+---------+---------+---------+---------+---------+
+  |   4th   |   5th   |    ?    |    ?    |   1st   |   2nd   |   3rd   |
+  +---------+---------+---------+---------+---------+---------+---------+
+                           ^                   ^
+  tail ("cellAt(5)") ------+     _head --------+
+
+Only the cells from the head up to (but not including) the tail hold constructed elements.
+Since the size isn't necessarily a power of two, a cell no. is wrapped with a compare and a
+subtraction rather than a mask or a "%".
+
+The bulk "enqueue()" and "dequeue()" copy in at most two pieces -- one up to the end of the
+array and one from cell 0 -- and use "memcpy()" when "T" is trivially copyable.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <sdp.h>
+#include <dstructs/queue.h>
+#include <dstructs/sdatastructure.h>
+
+// ============================================================================================
+// SQUEUE<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class SQueue:
+  virtual public DataStructureExceptions,
+  virtual public SDataStructure<T>,
+  virtual public Queue<T>
+{
+  public:
+                         SQueue(const unsigned int);
+                         SQueue(const unsigned int, const DataStructure<T>&);
+    virtual              ~SQueue()
+                           {empty(); return;}
+
+    SQueue<T>&           operator=(const SQueue<T>&);
+    SQueue<T>&           operator=(const DataStructure<T>&);
+    SQueue<T>&           operator+=(const DataStructure<T>&);
+
+    // Element iterators
+
+    /*
+    The element iterators visit the elements from the head to the tail.  They hold the current
+    element's offset from the head, so two iterators are compared by offset and dereferencing
+    one wraps the offset into a cell no.
+    */
+
+    template<class Element> class CircularIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                          CircularIterator(Element *const cells = NULL,
+                            const unsigned int head = 0U, const unsigned int offset = 0U,
+                            const unsigned int size = 0U) noexcept:
+                            _cells(cells), _head(head), _offset(offset), _size(size)
+                            {return;}
+                          CircularIterator(const CircularIterator<T>& source) noexcept:
+                            _cells(source._cells), _head(source._head),
+                            _offset(source._offset), _size(source._size) {return;}
+
+        Element&          operator*() const noexcept
+                            {return _cells[cell()];}
+        Element*          operator->() const noexcept
+                            {return _cells + cell();}
+        CircularIterator& operator++() noexcept
+                            {++_offset; return *this;}
+        CircularIterator  operator++(int) noexcept
+                            {const CircularIterator old(*this); ++_offset; return old;}
+
+        const bool        operator==(const CircularIterator& rhs) const noexcept
+                            {return _offset == rhs._offset;}
+        const bool        operator!=(const CircularIterator& rhs) const noexcept
+                            {return _offset != rhs._offset;}
+
+      private:
+        Element*     _cells;                  // cell 0 of the array
+        unsigned int _head;                   // the queue's "_head"
+        unsigned int _offset;                 // the current element's offset from the head
+        unsigned int _size;                   // the queue's "size()"
+
+        const unsigned int cell() const noexcept
+                             {return _offset < _size - _head ? _head + _offset :
+                                _offset - (_size - _head);}
+
+        friend class CircularIterator<const T>;
+    };
+
+    typedef CircularIterator<T>       ElementIterator;
+    typedef CircularIterator<const T> ConstElementIterator;
+
+    ElementIterator      begin() noexcept
+                           {return ElementIterator(this->elements(), _head, 0U, this->size());}
+    ElementIterator      end() noexcept
+                           {return ElementIterator(this->elements(), _head, this->_numElements,
+                              this->size());}
+    ConstElementIterator begin() const noexcept
+                           {return ConstElementIterator(this->elements(), _head, 0U,
+                              this->size());}
+    ConstElementIterator end() const noexcept
+                           {return ConstElementIterator(this->elements(), _head,
+                              this->_numElements, this->size());}
+
+    // DataStructure<T> methods
+
+    virtual void         empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                           {return DataStructure<T>::newIterator(*this);}
+
+    virtual const T *const contiguousElements(bool&) const noexcept;
+
+    // LinearStructure<T> methods
+
+    virtual void         concatenate(const DataStructure<T>&);
+
+    // Queue<T> methods
+
+    virtual void         enqueue(const T&);
+    virtual void         enqueue(T&&);
+    virtual void         enqueue(const T *const, const unsigned int);
+    virtual void         dequeue(T&);
+    virtual void         dequeue(T *const, const unsigned int);
+    virtual void         peek(T&) const;
+
+    template<class... Args>
+    void                 emplace(Args&&...);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void       assertInvariants() const noexcept;
+    #endif
+
+  private:
+    unsigned int _head;                     // the cell of the next element to be dequeued
+
+    inline const unsigned int cellAt(const unsigned int) const noexcept;
+    void                      enqueueBlock(const T *const, const unsigned int, const bool);
+};
+
+// ============================================================================================
+// SQUEUE<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> SQueue<T>::SQueue
+(
+  const unsigned int size                  // the no. of elements that the queue can hold
+):
+
+/*
+This constructor instanciates an empty queue that can contain "size" elements.  No "T"
+constructors are called.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+An empty queue with room for "size" elements is created.
+*/
+
+  SDataStructure<T>(size),
+  _head(0U)
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> SQueue<T>::SQueue
+(
+  const unsigned int      size,            // the no. of elements that the queue can hold
+  const DataStructure<T>& source           // the data structure to copy the elements of
+):
+
+/*
+This constructor instanciates a queue with room for "size" elements and enqueues copies of
+"source's" elements (refer to "concatenate()").
+*/
+
+  SDataStructure<T>(size),
+  _head(0U)
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> SQueue<T>& SQueue<T>::operator=
+(
+  const SQueue<T>& source                                      // the source queue to copy from
+)
+
+/*
+This method is the same as the other "operator=()" -- it's only here because otherwise the
+compiler would generate a (memberwise) one for assigning one "SQueue" to another.
+*/
+
+{
+  return operator=(static_cast<const DataStructure<T>&>(source));
+}
+
+/*********************************************************************************************/
+
+template<class T> SQueue<T>& SQueue<T>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> SQueue<T>& SQueue<T>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::empty() noexcept
+
+/*
+This method destroys every element in the queue.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+The queue is empty.
+*/
+
+{
+  const unsigned int firstCount = std::min(this->_numElements, this->size() - _head);
+
+  this->destroy(_head, firstCount);
+  this->destroy(0U, this->_numElements - firstCount);
+
+  _head              = 0U;
+  this->_numElements = 0U;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method enqueues copies of "source's" elements in "source's" iteration order, so the first
+element in "source's" iteration is the first of them to be dequeued.
+
+If "source's" elements are contiguous (refer to "DataStructure<T>::contiguousElements()") then
+they're copied in bulk (refer to "enqueue(const T *const, const unsigned int)").  If a copy
+fails then the ones already made are destroyed and the queue is left as it was.
+
+PRECONDITIONS:
+There must be room in the queue for copies of all of "source's" elements.
+
+POSTCONDITIONS:
+"source's" elements are appended at the tail of the queue.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int count = source.numElements();
+
+  if (count == 0U)
+    return;
+
+  if (count > this->size() - this->_numElements)
+    throw Full(__FILE__, __LINE__);
+
+  bool           isReversed;
+  const T *const block = source.contiguousElements(isReversed);
+
+  if (block != NULL)
+  {
+    enqueueBlock(block, count, isReversed);
+    return;
+  }
+
+  unsigned int numCopied(0U);
+
+  try
+  {
+    const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+    for (; i->more(); i->next())
+    {
+      assert(i->current() != NULL);
+      this->construct(cellAt(this->_numElements + numCopied), *i->current());
+      ++numCopied;
+    }
+  }
+  catch (...)
+  {
+    for (; numCopied > 0U; --numCopied)
+      this->destroy(cellAt(this->_numElements + numCopied - 1U));
+
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  assert(numCopied == count);
+  this->_numElements += count;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::enqueue
+(
+  const T& elementToEnqueue                            // the element to be placed on the queue
+)
+
+/*
+This method enqueues a copy of "elementToEnqueue" at the tail of the queue.
+
+PRECONDITIONS:
+The queue cannot be full.
+
+POSTCONDITIONS:
+The copy of "elementToEnqueue" will be the last element to be dequeued.
+*/
+
+{
+  emplace(elementToEnqueue);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::enqueue
+(
+  T&& elementToEnqueue                                // the element to be moved onto the queue
+)
+
+/*
+This method moves "elementToEnqueue" onto the tail of the queue.  Otherwise, it's the same as
+the other "enqueue()".
+*/
+
+{
+  emplace(std::move(elementToEnqueue));
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void SQueue<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" directly in the cell at the tail of the
+queue.  No temporary "T" is created.  If the "T" constructor throws then "OperationFailed" is
+thrown and the queue is left as it was.
+
+PRECONDITIONS:
+The queue cannot be full.
+
+POSTCONDITIONS:
+The new element will be the last element to be dequeued.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == this->size())
+    throw Full(__FILE__, __LINE__);
+
+  try
+  {
+    this->construct(cellAt(this->_numElements), std::forward<Args>(arguments)...);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to add an element to an SQueue.", __FILE__, __LINE__);
+  }
+
+  ++this->_numElements;
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::enqueue
+(
+  const T *const     elementsToEnqueue,          // the block of elements to enqueue
+  const unsigned int count                       // the no. of elements in the block
+)
+
+/*
+This method enqueues copies of the "count" elements in "elementsToEnqueue", in order, at the
+tail of the queue.  If a copy fails then the ones already made are destroyed,
+"OperationFailed" is thrown and the queue is left as it was.
+
+PRECONDITIONS:
+There must be room in the queue for "count" more elements.  "elementsToEnqueue" must not be
+part of this queue's own storage.
+
+POSTCONDITIONS:
+"elementsToEnqueue[0]" will be the first of the new elements to be dequeued and
+"elementsToEnqueue[count - 1]" will be the last.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (count == 0U)
+    return;
+
+  if (count > this->size() - this->_numElements)
+    throw Full(__FILE__, __LINE__);
+
+  assert(elementsToEnqueue != NULL);
+
+  enqueueBlock(elementsToEnqueue, count, false);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::dequeue
+(
+  T& dequeuedElement                            // the variable to receive the dequeued element
+)
+
+/*
+This method dequeues the element at the head of the queue and moves it to "dequeuedElement"
+(refer to "LinearStructure<T>::moveElement()").  If it can't be moved then "OperationFailed"
+is thrown and the queue is left as it was.
+
+PRECONDITIONS:
+The queue cannot be empty.
+
+POSTCONDITIONS:
+The next element to be dequeued is moved to "dequeuedElement" and removed from the queue.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    this->moveElement(dequeuedElement, this->elements()[_head]);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to remove an element from an SQueue.", __FILE__, __LINE__);
+  }
+
+  this->destroy(_head);
+  _head = --this->_numElements == 0U ? 0U : cellAt(1U);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::dequeue
+(
+  T *const           dequeuedElements,        // the block to receive the dequeued elements
+  const unsigned int count                    // the no. of elements to dequeue
+)
+
+/*
+This method dequeues "count" elements from the head of the queue and moves them, in order, to
+"dequeuedElements" (refer to "LinearStructure<T>::moveElement()").  If "T" is trivially
+copyable then the elements are copied out with at most two "memcpy()" calls.
+
+If moving an element fails then "OperationFailed" is thrown.  The elements that were already
+moved will have been dequeued; the one that couldn't be moved is still at the head.
+
+PRECONDITIONS:
+The queue must have at least "count" elements.  "dequeuedElements" must not be part of this
+queue's own storage.
+
+POSTCONDITIONS:
+The next "count" elements to be dequeued are moved to "dequeuedElements[0]" through
+"dequeuedElements[count - 1]" and removed from the queue.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (count > this->_numElements)
+    throw Empty(__FILE__, __LINE__);
+
+  if (count == 0U)
+    return;
+
+  assert(dequeuedElements != NULL);
+
+  if constexpr (std::is_trivially_copyable<T>::value)
+  {
+    const unsigned int firstCount = std::min(count, this->size() - _head);
+
+    memcpy(dequeuedElements, this->elements() + _head, sizeof(T) * firstCount);
+    memcpy(dequeuedElements + firstCount, this->elements(), sizeof(T) * (count - firstCount));
+
+    this->destroy(_head, firstCount);
+    this->destroy(0U, count - firstCount);
+
+    _head               = cellAt(count);
+    this->_numElements -= count;
+  }
+  else
+  {
+    for (unsigned int i = 0U; i < count; ++i)
+    {
+      try
+      {
+        this->moveElement(dequeuedElements[i], this->elements()[_head]);
+      }
+      catch (...)
+      {
+        throw OperationFailed("Unable to remove an element from an SQueue.", __FILE__,
+          __LINE__);
+      }
+
+      this->destroy(_head);
+      _head = cellAt(1U);
+      --this->_numElements;
+    }
+  }
+
+  if (this->_numElements == 0U)
+    _head = 0U;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::peek
+(
+  T& elementToBeDequeued             // the variable to receive the next element to be dequeued
+)
+const
+
+/*
+This method retrieves the element at the head of the queue (without dequeuing it) and copies
+it to "elementToBeDequeued".
+
+PRECONDITIONS:
+The queue cannot be empty.
+
+POSTCONDITIONS:
+The next element to be dequeued is copied to "elementToBeDequeued".
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  if (this->_numElements == 0U)
+    throw Empty(__FILE__, __LINE__);
+
+  try
+  {
+    elementToBeDequeued = this->elements()[_head];
+  }
+  catch (...)
+  {
+    throw OperationFailed("Unable to copy an element from an SQueue.", __FILE__, __LINE__);
+  }
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const T *const SQueue<T>::contiguousElements
+(
+  bool& isReversed                                          // which way the iteration runs
+)
+const noexcept
+
+/*
+Refer to "DataStructure<T>::contiguousElements()".  The elements are only contiguous if they
+don't wrap around the end of the array.
+*/
+
+{
+  if (this->_numElements == 0U || this->_numElements > this->size() - _head)
+    return NULL;
+
+  isReversed = false;
+  return this->elements() + _head;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void SQueue<T>::assertInvariants() const noexcept
+
+  {
+    SDataStructure<T>::assertInvariants();
+
+    assert(this->size() == 0U ? _head == 0U : _head < this->size());
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> inline const unsigned int SQueue<T>::cellAt
+(
+  const unsigned int offset                           // an offset from the head
+)
+const noexcept
+
+/*
+This method returns the no. of the cell that's "offset" cells after the head, wrapping around
+from the last cell to cell 0.  "offset" can't be more than "size()".
+*/
+
+{
+  assert(offset <= this->size());
+
+  return offset < this->size() - _head ? _head + offset : offset - (this->size() - _head);
+}
+
+/*********************************************************************************************/
+
+template<class T> void SQueue<T>::enqueueBlock
+(
+  const T *const     block,                          // the block of elements to copy
+  const unsigned int count,                          // the no. of elements in "block"
+  const bool         isReversed                      // enqueue "block" back to front?
+)
+
+/*
+This method copy-constructs "count" cells at the tail from "block" in at most two pieces (refer
+to "SDataStructure<T>::constructCopies()") and then adds them to the queue.  If "isReversed" is
+true then "block[count - 1]" is enqueued first.  If a copy fails then the ones already made
+are destroyed, "OperationFailed" is thrown and the queue is left as it was.
+
+PRECONDITIONS:
+There must be room in the queue for "count" more elements.
+*/
+
+{
+  assert(count > 0U && count <= this->size() - this->_numElements);
+
+  const unsigned int firstCell   = cellAt(this->_numElements);
+  const unsigned int firstCount  = std::min(count, this->size() - firstCell);
+  const unsigned int secondCount = count - firstCount;
+
+  try
+  {
+    /*
+    The first piece gets the first "firstCount" elements in enqueuing order -- the start of the
+    block if it's enqueued forward and the end of it if it's enqueued backward.
+    */
+
+    this->constructCopies(firstCell, isReversed ? block + secondCount : block, firstCount,
+      isReversed);
+
+    try
+    {
+      this->constructCopies(0U, isReversed ? block : block + firstCount, secondCount,
+        isReversed);
+    }
+    catch (...)
+    {
+      this->destroy(firstCell, firstCount);
+      throw;
+    }
+  }
+  catch (...)
+  {
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  this->_numElements += count;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+#endif
@@ -0,0 +1,867 @@
+#ifndef DSTRUCTS_SRING_H
+#define DSTRUCTS_SRING_H
+
+// ============================================================================================
+//
+// sring.h -- Implementation of a static ring -- that is, a ring buffer that stores its
+// elements in an array of fixed size.
+//
+// ============================================================================================
+
+/*
+This class is a static ring.  An "SRing" is a "Ring".
+
+Its capacity is always a power of two:  the size that's passed to the constructor is rounded
+up to the next one, and "size()" returns the rounded-up size.
+
+An "SRing" can also be used as a lock-free single-producer/single-consumer channel between two
+threads.  Call "setConcurrent(true)" before handing it over to them; from then on, one thread
+(the producer) may call "push()", "emplace()" and "tryPush()" while the other thread (the
+consumer) calls "pop()", "tryPop()" and "peek()", and neither ever waits for the other.
+"numQueued()" may be called by either thread.  Everything else -- "numElements()",
+"isEmpty()", "isFull()", iterating, copying, "empty()" -- needs both threads to be stopped
+and "setConcurrent(false)" to have been called, which brings "numElements()" up to date.
+
+  SRing<Record> channel(1024U);
+
+  channel.setConcurrent(true);
+
+  std::thread ingest([&channel] {... while (!channel.tryPush(record)) wait(); ...});
+  std::thread parser([&channel] {... if (channel.tryPop(record)) parse(record); ...});
+
+"tryPush()" and "tryPop()" return false instead of throwing "Full" and "Empty", which is what a
+thread that's polling a ring wants.
+*/
+
+// ============================================================================================
+// DESIGN NOTES
+// ============================================================================================
+
+/*
+The array is "SDataStructure's" raw storage.  "_head" and "_tail" are free-running counters:
+the element at the head is in cell "_head & _mask" and the next element pushed goes into cell
+"_tail & _mask", where "_mask" is "size() - 1".  The no. of elements is always "_tail - _head"
+(unsigned arithmetic takes care of wrap-around), so a full ring and an empty ring are never
+confused and no cell has to be left unused.
+
+  0:        1:        2:        3:        4:        5:        6:        7:
+  +---------+---------+---------+---------+---------+---------+---------+---------+
+  |    ?    |    ?    |   1st   |   2nd   |   3rd   |   4th   |    ?    |    ?    |
+  +---------+---------+---------+---------+---------+---------+---------+---------+
+                           ^                                       ^
+  _head & _mask -----------+                   _tail & _mask ------+
+
+Only the cells from the head up to (but not including) the tail hold constructed elements.
+
+Only "pop()" and its relatives change "_head" and only "push()" and its relatives change
+"_tail", so in concurrent mode each counter has exactly one writer and no compare-and-swap is
+ever needed.  The producer constructs an element and then publishes it with a release store of
+"_tail"; the consumer acquires "_tail" before it touches the element.  Likewise, the consumer
+destroys an element before it releases its cell with a release store of "_head".
+
+"_head" and "_tail" are each on their own cache line, and each shares that line only with the
+copy of the other counter that its own thread keeps ("_cachedTail" and "_cachedHead").  A
+thread only reloads the other thread's counter when its copy says that the ring is empty (or
+full), so in the steady state the two threads hardly ever touch each other's cache lines.  The
+read-only members are on a third line.
+
+"_numElements" would need both threads to write it, so it's left alone in concurrent mode.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <utility>
+
+#include <sdp.h>
+#include <dstructs/ring.h>
+#include <dstructs/sdatastructure.h>
+
+// ============================================================================================
+// SRING<T> CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class SRing:
+  virtual public DataStructureExceptions,
+  virtual public SDataStructure<T>,
+  virtual public Ring<T>
+{
+  public:
+    static const size_t  CACHE_LINE_SIZE = 64U;
+
+                         SRing(const unsigned int);
+                         SRing(const unsigned int, const DataStructure<T>&);
+    virtual              ~SRing()
+                           {empty(); return;}
+
+    SRing<T>&            operator=(const DataStructure<T>&);
+    SRing<T>&            operator+=(const DataStructure<T>&);
+
+    const bool           isConcurrent() const noexcept
+                           {return _isConcurrent;}
+    void                 setConcurrent(const bool) noexcept;
+    const unsigned int   numQueued() const noexcept;
+
+    // Element iterators
+
+    /*
+    The element iterators visit the elements from the head to the tail.  They hold a
+    free-running index, like "_head" and "_tail" do, so incrementing one is an index increment
+    and dereferencing one is a mask and an index.
+    */
+
+    template<class Element> class RingIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                      RingIterator(Element *const cells = NULL, const unsigned int index = 0U,
+                        const unsigned int mask = 0U) noexcept:
+                        _cells(cells), _index(index), _mask(mask) {return;}
+                      RingIterator(const RingIterator<T>& source) noexcept:
+                        _cells(source._cells), _index(source._index), _mask(source._mask)
+                        {return;}
+
+        Element&      operator*() const noexcept
+                        {return _cells[_index & _mask];}
+        Element*      operator->() const noexcept
+                        {return _cells + (_index & _mask);}
+        RingIterator& operator++() noexcept
+                        {++_index; return *this;}
+        RingIterator  operator++(int) noexcept
+                        {const RingIterator old(*this); ++_index; return old;}
+
+        const bool    operator==(const RingIterator& rhs) const noexcept
+                        {return _index == rhs._index;}
+        const bool    operator!=(const RingIterator& rhs) const noexcept
+                        {return _index != rhs._index;}
+
+      private:
+        Element*     _cells;                  // cell 0 of the array
+        unsigned int _index;                  // free-running index of the current element
+        unsigned int _mask;                   // the ring's "size() - 1"
+
+        friend class RingIterator<const T>;
+    };
+
+    typedef RingIterator<T>       ElementIterator;
+    typedef RingIterator<const T> ConstElementIterator;
+
+    ElementIterator      begin() noexcept
+                           {return ElementIterator(this->elements(), headIndex(), _mask);}
+    ElementIterator      end() noexcept
+                           {return ElementIterator(this->elements(), tailIndex(), _mask);}
+    ConstElementIterator begin() const noexcept
+                           {return ConstElementIterator(this->elements(), headIndex(), _mask);}
+    ConstElementIterator end() const noexcept
+                           {return ConstElementIterator(this->elements(), tailIndex(), _mask);}
+
+    // DataStructure<T> methods
+
+    virtual void         empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                           {return DataStructure<T>::newIterator(*this);}
+
+    virtual const T *const contiguousElements(bool&) const noexcept;
+
+    // LinearStructure<T> methods
+
+    virtual void         concatenate(const DataStructure<T>&);
+
+    // Ring<T> methods
+
+    virtual void         push(const T&);
+    virtual void         push(T&&);
+    virtual void         pop(T&);
+    virtual void         peek(T&) const;
+
+    template<class... Args>
+    void                 emplace(Args&&...);
+
+    // Non-throwing versions
+
+    const bool           tryPush(const T& elementToPush)
+                           {return tryEmplace(elementToPush);}
+    const bool           tryPush(T&& elementToPush)
+                           {return tryEmplace(std::move(elementToPush));}
+    const bool           tryPop(T&);
+
+    template<class... Args>
+    const bool           tryEmplace(Args&&...);
+
+  protected:
+    #ifndef NDEBUG
+      virtual void       assertInvariants() const noexcept;
+    #endif
+
+  private:
+    alignas(CACHE_LINE_SIZE) std::atomic<unsigned int> _head;     // written by the consumer
+    mutable unsigned int                               _cachedTail;  // consumer's copy of tail
+    alignas(CACHE_LINE_SIZE) std::atomic<unsigned int> _tail;     // written by the producer
+    unsigned int                                       _cachedHead;  // producer's copy of head
+    alignas(CACHE_LINE_SIZE) const unsigned int        _mask;     // "size() - 1"
+    bool                                               _isConcurrent;  // SPSC mode?
+
+    const unsigned int   headIndex() const noexcept
+                           {return _head.load(std::memory_order_relaxed);}
+    const unsigned int   tailIndex() const noexcept
+                           {return _tail.load(std::memory_order_relaxed);}
+
+    const bool           hasRoom(const unsigned int, const unsigned int) noexcept;
+    const bool           hasElement(const unsigned int) const noexcept;
+
+    static const unsigned int capacityFor(const unsigned int);
+};
+
+// ============================================================================================
+// SRING<T> METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> SRing<T>::SRing
+(
+  const unsigned int size                  // the no. of elements that the ring must hold
+):
+
+/*
+This constructor instanciates an empty ring that can contain at least "size" elements.  No
+"T" constructors are called.
+
+PRECONDITIONS:
+"size" can't be more than the largest power of two that fits in an "unsigned int".
+
+POSTCONDITIONS:
+An empty ring with room for "size" elements (rounded up to a power of two) is created.  It
+isn't in concurrent mode.
+*/
+
+  SDataStructure<T>(capacityFor(size)),
+  _head(0U),
+  _cachedTail(0U),
+  _tail(0U),
+  _cachedHead(0U),
+  _mask(capacityFor(size) - 1U),
+  _isConcurrent(false)
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> SRing<T>::SRing
+(
+  const unsigned int      size,            // the no. of elements that the ring must hold
+  const DataStructure<T>& source           // the data structure to copy the elements of
+):
+
+/*
+This constructor instanciates a ring with room for at least "size" elements and pushes copies
+of "source's" elements onto it (refer to "concatenate()").
+*/
+
+  SDataStructure<T>(capacityFor(size)),
+  _head(0U),
+  _cachedTail(0U),
+  _tail(0U),
+  _cachedHead(0U),
+  _mask(capacityFor(size) - 1U),
+  _isConcurrent(false)
+
+{
+  concatenate(source);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> SRing<T>& SRing<T>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  if (&source != this)
+  {
+    empty();
+    concatenate(source);
+  }
+
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> SRing<T>& SRing<T>::operator+=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SRing<T>::setConcurrent
+(
+  const bool isConcurrent                     // for a single-producer/consumer channel
+)
+noexcept
+
+/*
+This method turns concurrent mode on or off.  Turning it off brings "numElements()" up to date.
+
+PRECONDITIONS:
+No other thread may be using the ring.
+
+POSTCONDITIONS:
+The ring is in concurrent mode iff "isConcurrent" is true.
+*/
+
+{
+  _isConcurrent = isConcurrent;
+  _cachedHead   = headIndex();
+  _cachedTail   = tailIndex();
+
+  if (!isConcurrent)
+    this->_numElements = _cachedTail - _cachedHead;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const unsigned int SRing<T>::numQueued() const noexcept
+
+/*
+This method returns the no. of elements on the ring.  Either thread may call it in concurrent
+mode, in which case the answer is a snapshot:  the other thread may have pushed or popped
+elements since.
+*/
+
+{
+  const unsigned int head = _head.load(std::memory_order_acquire);
+  const unsigned int tail = _tail.load(std::memory_order_acquire);
+
+  /*
+  "_head" is read first, so it can only be behind -- never ahead of -- "_tail".  It may have
+  moved on by the time "_tail" is read, though, so the difference is capped at "size()".
+  */
+
+  return std::min(tail - head, this->size());
+}
+
+/*********************************************************************************************/
+
+template<class T> void SRing<T>::empty() noexcept
+
+/*
+This method destroys every element on the ring.
+
+PRECONDITIONS:
+The ring can't be in use by another thread.
+
+POSTCONDITIONS:
+The ring is empty.
+*/
+
+{
+  const unsigned int tail = tailIndex();
+
+  for (unsigned int index = headIndex(); index != tail; ++index)
+    this->destroy(index & _mask);
+
+  _head.store(tail, std::memory_order_release);
+  _cachedHead = tail;
+  _cachedTail = tail;
+
+  if (!_isConcurrent)
+    this->_numElements = 0U;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SRing<T>::concatenate
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
+)
+
+/*
+This method pushes copies of "source's" elements onto the tail of the ring in "source's"
+iteration order, so the first element in "source's" iteration is the first of them to be
+popped.
+
+If "source's" elements are contiguous (refer to "DataStructure<T>::contiguousElements()") then
+they're copied in at most two blocks -- one up to the end of the array and one from cell 0 --
+with "memcpy()" if "T" is trivially copyable.
+
+The copies are all made before the tail is moved, so in concurrent mode the consumer sees
+either none of them or all of them.  If a copy fails then the ones already made are destroyed
+and the ring is left as it was.
+
+PRECONDITIONS:
+There must be room on the ring for copies of all of "source's" elements.  In concurrent mode,
+only the producer may call this method.
+
+POSTCONDITIONS:
+"source's" elements are appended at the tail of the ring.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int count = source.numElements();
+  const unsigned int tail  = tailIndex();
+
+  if (count == 0U)
+    return;
+
+  if (!hasRoom(tail, count))
+    throw Full(__FILE__, __LINE__);
+
+  const unsigned int firstCell = tail & _mask;
+  bool               isReversed;
+  const T *const     block     = source.contiguousElements(isReversed);
+
+  if (block != NULL)
+  {
+    const unsigned int firstCount  = std::min(count, this->size() - firstCell);
+    const unsigned int secondCount = count - firstCount;
+
+    try
+    {
+      /*
+      The first piece gets the first "firstCount" elements in iterative order -- the start of
+      the block if it's iterated forward and the end of it if it's iterated backward.
+      */
+
+      this->constructCopies(firstCell, isReversed ? block + secondCount : block, firstCount,
+        isReversed);
+
+      try
+      {
+        this->constructCopies(0U, isReversed ? block : block + firstCount, secondCount,
+          isReversed);
+      }
+      catch (...)
+      {
+        this->destroy(firstCell, firstCount);
+        throw;
+      }
+    }
+    catch (...)
+    {
+      throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+    }
+  }
+  else
+  {
+    unsigned int index(tail);
+
+    try
+    {
+      const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+      for (; i->more(); i->next())
+      {
+        assert(i->current() != NULL);
+        this->construct(index & _mask, *i->current());
+        ++index;
+      }
+    }
+    catch (...)
+    {
+      for (; index != tail; --index)
+        this->destroy((index - 1U) & _mask);
+
+      throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+    }
+
+    assert(index == tail + count);
+  }
+
+  _tail.store(tail + count, std::memory_order_release);
+
+  if (!_isConcurrent)
+    this->_numElements += count;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SRing<T>::push
+(
+  const T& elementToPush                                // the element to be placed on the ring
+)
+
+/*
+This method pushes a copy of "elementToPush" onto the tail of the ring.
+
+PRECONDITIONS:
+The ring cannot be full.  In concurrent mode, only the producer may call this method.
+
+POSTCONDITIONS:
+The copy of "elementToPush" will be the last element on the ring.
+*/
+
+{
+  emplace(elementToPush);
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SRing<T>::push
+(
+  T&& elementToPush                                  // the element to be moved onto the ring
+)
+
+/*
+This method moves "elementToPush" onto the tail of the ring.  Otherwise, it's the same as the
+other "push()".
+*/
+
+{
+  emplace(std::move(elementToPush));
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> void SRing<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" directly in the cell at the tail of the
+ring.  Refer to "tryEmplace()".
+
+PRECONDITIONS:
+The ring cannot be full.  In concurrent mode, only the producer may call this method.
+
+POSTCONDITIONS:
+The new element will be the last element on the ring.
+*/
+
+{
+  if (!tryEmplace(std::forward<Args>(arguments)...))
+    throw Full(__FILE__, __LINE__);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> const bool SRing<T>::tryEmplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" directly in the cell at the tail of the
+ring and returns true, or returns false if the ring is full.  If the "T" constructor throws
+then the exception is passed on and the ring is left as it was.
+
+In concurrent mode, the element is constructed before it's published, so the consumer never
+sees a half-constructed element.
+
+PRECONDITIONS:
+In concurrent mode, only the producer may call this method.
+
+POSTCONDITIONS:
+If true is returned then the new element will be the last element on the ring.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int tail = tailIndex();
+
+  if (!hasRoom(tail, 1U))
+    return false;
+
+  this->construct(tail & _mask, std::forward<Args>(arguments)...);
+  _tail.store(tail + 1U, std::memory_order_release);
+
+  if (!_isConcurrent)
+    ++this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SRing<T>::pop
+(
+  T& poppedElement                                // the variable to receive the popped element
+)
+
+/*
+This method pops the element at the head of the ring and moves it to "poppedElement".  Refer
+to "tryPop()".
+
+PRECONDITIONS:
+The ring cannot be empty.  In concurrent mode, only the consumer may call this method.
+
+POSTCONDITIONS:
+The element that was at the head of the ring is moved to "poppedElement" and removed from the
+ring.
+*/
+
+{
+  if (!tryPop(poppedElement))
+    throw Empty(__FILE__, __LINE__);
+
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const bool SRing<T>::tryPop
+(
+  T& poppedElement                                // the variable to receive the popped element
+)
+
+/*
+This method pops the element at the head of the ring, moves it to "poppedElement" (refer to
+"LinearStructure<T>::moveElement()") and returns true, or returns false if the ring is empty.
+If moving (or copying) the element throws then the exception is passed on and the ring is left
+as it was.
+
+PRECONDITIONS:
+In concurrent mode, only the consumer may call this method.
+
+POSTCONDITIONS:
+If true is returned then the element that was at the head of the ring is moved to
+"poppedElement" and removed from the ring.
+*/
+
+{
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  const unsigned int head = headIndex();
+
+  if (!hasElement(head))
+    return false;
+
+  this->moveElement(poppedElement, this->elements()[head & _mask]);
+  this->destroy(head & _mask);
+  _head.store(head + 1U, std::memory_order_release);
+
+  if (!_isConcurrent)
+    --this->_numElements;
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T> void SRing<T>::peek
+(
+  T& elementToBePopped                 // the variable to receive the next element to be popped
+)
+const
+
+/*
+This method copies the element at the head of the ring to "elementToBePopped" without popping
+it.
+
+PRECONDITIONS:
+The ring cannot be empty.  In concurrent mode, only the consumer may call this method.
+
+POSTCONDITIONS:
+The element at the head of the ring is copied to "elementToBePopped".
+*/
+
+{
+  const unsigned int head = headIndex();
+
+  if (!hasElement(head))
+    throw Empty(__FILE__, __LINE__);
+
+  elementToBePopped = this->elements()[head & _mask];
+  return;
+}
+
+/*********************************************************************************************/
+
+template<class T> const T *const SRing<T>::contiguousElements
+(
+  bool& isReversed                                          // which way the iteration runs
+)
+const noexcept
+
+/*
+Refer to "DataStructure<T>::contiguousElements()".  The elements are only contiguous if they
+don't wrap around the end of the array.
+*/
+
+{
+  const unsigned int head      = headIndex();
+  const unsigned int count     = tailIndex() - head;
+  const unsigned int firstCell = head & _mask;
+
+  if (count == 0U || count > this->size() - firstCell)
+    return NULL;
+
+  isReversed = false;
+  return this->elements() + firstCell;
+}
+
+/*********************************************************************************************/
+
+#ifndef NDEBUG
+  template<class T> void SRing<T>::assertInvariants() const noexcept
+
+  /*
+  In concurrent mode the other thread can move "_head" or "_tail" at any moment, so only the
+  things that can't change are checked.
+  */
+
+  {
+    SDataStructure<T>::assertInvariants();
+
+    assert((this->size() & _mask) == 0U);
+
+    if (!_isConcurrent)
+    {
+      assert(tailIndex() - headIndex() <= this->size());
+      assert(this->_numElements == tailIndex() - headIndex());
+    }
+
+    return;
+  }
+#endif
+
+/*********************************************************************************************/
+
+template<class T> inline const bool SRing<T>::hasRoom
+(
+  const unsigned int tail,                           // the producer's "_tail"
+  const unsigned int count                           // the no. of cells needed
+)
+noexcept
+
+/*
+This method returns true iff there are "count" free cells at the tail of the ring.  It's only
+called by the producer.  "_head" is only loaded (with acquire ordering, so that the consumer's
+destruction of the elements in the freed cells has happened) when "_cachedHead" says that
+there isn't enough room.
+*/
+
+{
+  if (count > this->size() - (tail - _cachedHead))
+  {
+    _cachedHead = _head.load(std::memory_order_acquire);
+
+    if (count > this->size() - (tail - _cachedHead))
+      return false;
+  }
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T> inline const bool SRing<T>::hasElement
+(
+  const unsigned int head                            // the consumer's "_head"
+)
+const noexcept
+
+/*
+This method returns true iff there's an element at the head of the ring.  It's only called by
+the consumer.  "_tail" is only loaded (with acquire ordering, so that the producer's
+construction of the element has happened) when "_cachedTail" says that the ring is empty.
+"_cachedTail" is only a hint, which is why it's "mutable".
+*/
+
+{
+  if (head == _cachedTail)
+  {
+    _cachedTail = _tail.load(std::memory_order_acquire);
+
+    if (head == _cachedTail)
+      return false;
+  }
+
+  return true;
+}
+
+/*********************************************************************************************/
+
+template<class T> const unsigned int SRing<T>::capacityFor
+(
+  const unsigned int size                           // the no. of elements that must fit
+)
+
+/*
+This function returns the smallest power of two that's at least "size" (or 0 if "size" is 0).
+*/
+
+{
+  const unsigned int largest = ~(~0U >> 1U);      // the largest power of two that fits
+  unsigned int       capacity(1U);
+
+  if (size == 0U)
+    return 0U;
+
+  if (size > largest)
+    throw OperationFailed("An SRing can't be that large.", __FILE__, __LINE__);
+
+  while (capacity < size)
+    capacity <<= 1U;
+
+  return capacity;
+}
+
+#endif
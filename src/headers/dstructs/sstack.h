@@ -23,13 +23,27 @@ be popped off of the stack.
                    head ---+     |
                    _numElements -+
 
-To reduce complexity and increase efficiency, "SLinearStruct::_numElements" is considered to be
-one greater than the head -- specificly, the index of where the next element to be pushed onto
-the stack would go.
+To reduce complexity and increase efficiency, "_numElements" is considered to be one greater
+than the head -- specificly, the index of where the next element to be pushed onto the stack
+would go.
+
+The array is "SDataStructure's" raw storage.  Only the cells below "_numElements" hold
+constructed elements:  an element is constructed in its cell when it's pushed and destroyed
+when it's popped (or when the stack is emptied).  Creating a stack therefore doesn't call any
+"T" constructors, no matter how large it is.
+
+Because the elements are contiguous (and iterated from the head down), "SStack" overrides
+"contiguousElements()".  Likewise, "operator+=()" copies a contiguous source as one block
+instead of element by element -- see its comments.
+
+"begin()" and "end()" return reverse iterators over the same cells, so a range-based "for"
+loop visits the elements from the head down (like an "Iterator_" does) with nothing more than a
+pointer decrement per element.  "iterator()" is just an "IteratorAdaptor" around them, so the
+stack keeps no iteration state of its own.
 
 All methods are written with the possibility that an exception may be thrown as one "T" is
-assigned to another.  That means that, if an exception is thrown while a method is being
-called, the "SStack" will not have changed as far as the caller is concerned.
+copied or moved.  That means that, if an exception is thrown while a method is being called,
+the "SStack" will not have changed as far as the caller is concerned.
 */
 
 // ============================================================================================
@@ -38,9 +52,12 @@ called, the "SStack" will not have changed as far as the caller is concerned.
 
 #include <assert.h>
 #include <stdarg.h>
-#include <iomanip.h>
+
+#include <iterator>
+#include <utility>
 
 #include <sdp.h>
+#include <dstructs/sdatastructure.h>
 #include <dstructs/stack.h>
 
 // ============================================================================================
@@ -48,39 +65,74 @@ called, the "SStack" will not have changed as far as the caller is concerned.
 // ============================================================================================
 
 template <class T> class SStack:
-  virtual public SLinearStruct<T>,
+  virtual public DataStructureExceptions,
+  virtual public SDataStructure<T>,
   virtual public Stack<T>
 {
   public:
-		           SStack(const unsigned int);
-		           SStack(const unsigned int, const LinearStruct<T>&);
+                           SStack(const unsigned int);
+                           SStack(const unsigned int, const DataStructure<T>&);
+                           SStack(const SStack<T>&);
                            SStack(const unsigned int, const T *const, const unsigned int);
                            SStack(const unsigned int, const unsigned int, ...);
+    virtual                ~SStack()
+                             {empty(); return;}
+
+    // DataStructure<T> methods
+
+    virtual const bool     isEmpty() const noexcept
+                             {return (this->_numElements == 0U);}
+    virtual const bool     isFull() const noexcept
+                             {return (this->_numElements == this->size());}
+    virtual void           empty() noexcept;
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const
+                             {return DataStructure<T>::newIterator(*this);}
+
+    virtual const T *const contiguousElements(bool& isReversed) const noexcept
+                             {
+                               isReversed = true;
+                               return this->_numElements > 0U ? this->elements() : NULL;
+                             }
 
-    // LinearStruct virtual methods
+    // LinearStructure<T> methods
 
-    virtual const bool     isEmpty() const throw ()
-                             {assertInvariants(); return (_numElements == 0U);}
-    virtual const bool     isFull() const throw ()
-                             {assertInvariants(); return (_numElements == _maxElements);}
-    virtual void           empty() throw ();
+    virtual void           concatenate(const DataStructure<T>& source)
+                             {operator+=(source); return;}
 
-    virtual void           iterStart() const throw ();
-    virtual const bool     iterMore() const throw ();
-    virtual void           iterNext() const throw (OperationFailed);
-    virtual const T *const iterCurrent() const throw (OperationFailed);
+    // Element iterators
+
+    typedef std::reverse_iterator<T*>       ElementIterator;
+    typedef std::reverse_iterator<const T*> ConstElementIterator;
+
+    ElementIterator        begin() noexcept
+                             {return ElementIterator(this->elements() + this->_numElements);}
+    ElementIterator        end() noexcept
+                             {return ElementIterator(this->elements());}
+    ConstElementIterator   begin() const noexcept
+                             {
+                               return ConstElementIterator(this->elements() +
+                                 this->_numElements);
+                             }
+    ConstElementIterator   end() const noexcept
+                             {return ConstElementIterator(this->elements());}
 
     // Stack virtual methods
 
     virtual void           push(const T&);
+    virtual void           push(T&&);
     virtual void           pop(T&);
     virtual void           peek(T&) const;
 
+    template<class... Args>
+    void                   emplace(Args&&...);
+
     // Meaningful operators
 
-    SStack<T>&             operator=(const LinearStruct<T>& source);
-    SStack<T>&             operator+=(const LinearStruct<T>&);
-    SStack<T>              operator+(const LinearStruct<T>& source);
+    SStack<T>&             operator=(const SStack<T>&);
+    SStack<T>&             operator=(const DataStructure<T>&);
+    SStack<T>&             operator+=(const DataStructure<T>&);
+    SStack<T>              operator+(const DataStructure<T>&);
 };
 
 // ============================================================================================
@@ -104,10 +156,12 @@ POSTCONDITIONS:
 An empty stack with room for "size" elements is created.
 */
 
-  SLinearStruct<T>(size)
+  SDataStructure<T>(size)
 
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    SDataStructure<T>::assertInvariants();
+  #endif
   return;
 }
 
@@ -116,7 +170,7 @@ An empty stack with room for "size" elements is created.
 template <class T> SStack<T>::SStack
 (
   const unsigned int     size,    // the number of elements that the stack must be able to hold
-  const LinearStruct<T>& source   // linear data structure from which elements will be copied
+  const DataStructure<T>& source  // the data structure from which elements will be copied
 ):
 
 /*
@@ -133,7 +187,7 @@ POSTCONDITIONS:
 A new stack is created.  Its contents are a copy of "source's".
 */
 
-  SLinearStruct<T>(size)
+  SDataStructure<T>(size)
 
 {
   operator+=(source);
@@ -142,6 +196,44 @@ A new stack is created.  Its contents are a copy of "source's".
 
 /*********************************************************************************************/
 
+template <class T> SStack<T>::SStack
+(
+  const SStack<T>& source                                                // the stack to copy
+):
+
+/*
+This constructor makes a deep copy of "source" with the same size.  Since the cells are in the
+same order in both stacks, they're copied straight across as one block.
+
+PRECONDITIONS:
+None.
+
+POSTCONDITIONS:
+A new stack is created.  Its size and contents are a copy of "source's".
+*/
+
+  SDataStructure<T>(source.size())
+
+{
+  try
+  {
+    this->constructCopies(0U, source.elements(), source._numElements, false);
+  }
+  catch (...)
+  {
+    throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+  }
+
+  this->_numElements = source._numElements;
+
+  #ifndef NDEBUG
+    SDataStructure<T>::assertInvariants();
+  #endif
+  return;
+}
+
+/*********************************************************************************************/
+
 template <class T> SStack<T>::SStack
 (
   const unsigned int size,           // the no. of elements that the stack must be able to hold
@@ -163,43 +255,38 @@ POSTCONDITIONS:
 A new stack is created.  Its contents are copies of the elements passed as arguments.
 */
 
-  SLinearStruct<T>(size)
+  SDataStructure<T>(size)
 
 {
   if (numElements > size)
   {
-    ExceptionErrno::presetDetails() << "\"numElements\" (" << numElements
-      << ") can't be larger than \"size\" (" << size << ").";
-    throw ExceptionErrno(EINVAL, __FILE__, __LINE__);
+    throw OperationFailed("\"numElements\" can't be larger than \"size\".", __FILE__,
+      __LINE__);
   }
 
-  if ((numElements == 0) != (elements == NULL))
+  if ((numElements == 0U) != (elements == NULL))
   {
-    ExceptionErrno::presetDetails() << "\"numElements\" is " << numElements
-      << ", so \"elements\" (0x" << hex << setw(8) << setfill('0') << (void*)elements
-      << ") can't be " << (numElements == 0 ? "non-NULL." : "NULL.");
-    throw ExceptionErrno(EINVAL, __FILE__, __LINE__);
+    throw OperationFailed("\"elements\" must be NULL if and only if \"numElements\" is 0.",
+      __FILE__, __LINE__);
   }
 
   try
   {
     /*
-    A simple loop is used to push each element in the array onto the stack (in the order in
-    which they're given).
+    The array is already in the stack's order (first element at the tail), so it's copied
+    straight across as one block.
     */
 
-    while (_numElements < numElements)
-    {
-      _elements[_numElements] = elements[_numElements];
-      ++_numElements;
-    }
+    this->constructCopies(0U, elements, numElements, false);
+    this->_numElements = numElements;
 
-    assertInvariants();
+    #ifndef NDEBUG
+      SDataStructure<T>::assertInvariants();
+    #endif
   }
   catch (...)
   {
-    throw OperationFailed("Assignment operation on a \"T\" element failed.", __FILE__,
-      __LINE__);
+    throw OperationFailed("Copy operation on a \"T\" element failed.", __FILE__, __LINE__);
   }
 
   return;
@@ -229,14 +316,13 @@ POSTCONDITIONS:
 A new stack is created.  Its contents are copies of the elements passed as arguments.
 */
 
-  SLinearStruct<T>(size)
+  SDataStructure<T>(size)
 
 {
   if (numElements > size)
   {
-    ExceptionErrno::presetDetails() << "\"numElements\" (" << numElements
-      << ") can't be larger than \"size\" (" << size << ")";
-    throw ExceptionErrno(EINVAL, __FILE__, __LINE__);
+    throw OperationFailed("\"numElements\" can't be larger than \"size\".", __FILE__,
+      __LINE__);
   }
 
   if (numElements > 0U)
@@ -252,16 +338,22 @@ A new stack is created.  Its contents are copies of the elements passed as argum
 
       va_start(argList, numElements);
 
-      while (_numElements < numElements)
-        _elements[_numElements++] = va_arg(argList, T);
+      while (this->_numElements < numElements)
+      {
+        this->construct(this->_numElements, va_arg(argList, T));
+        ++this->_numElements;
+      }
 
       va_end(argList);
 
-      assertInvariants();
+      #ifndef NDEBUG
+        SDataStructure<T>::assertInvariants();
+      #endif
     }
     catch (...)
     {
-      throw OperationFailed("Element assignment operation failed.", __FILE__, __LINE__);
+      empty();
+      throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
     }
   }
 
@@ -270,10 +362,10 @@ A new stack is created.  Its contents are copies of the elements passed as argum
 
 /*********************************************************************************************/
 
-template <class T> void SStack<T>::empty() throw ()
+template <class T> void SStack<T>::empty() noexcept
 
 /*
-This method ensures that there are no elements in the stack.
+This method ensures that there are no elements in the stack.  Every element is destroyed.
 
 PRECONDITIONS:
 
@@ -285,86 +377,116 @@ The stack is empty.
 */
 
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
 
-  _numElements = 0U;
+  this->destroy(0U, this->_numElements);
+  this->_numElements = 0U;
 
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
   return;
 }
 
 /*********************************************************************************************/
 
-template <class T> void SStack<T>::iterStart() const throw ()
-{
-  assertInvariants();
-
-  *_iterCurrent = _numElements;
-  return;
-}
-
-/*********************************************************************************************/
+template <class T> void SStack<T>::push
+(
+  const T& elementToPush                               // the element to be placed on the stack
+)
 
-template <class T> const bool SStack<T>::iterMore() const throw ()
-{
-  assertInvariants();
+/*
+This method pushes a copy of "elementToPush" onto the stack.
 
-  return (*_iterCurrent > 0U);
-}
+PRECONDITIONS:
+The stack cannot be full.
 
-/*********************************************************************************************/
+POSTCONDITIONS:
+The copy of "elementToPush" will be added at the top of the stack and will be the first element
+to be popped off.
+*/
 
-template <class T> void SStack<T>::iterNext() const throw (DataStruct::OperationFailed)
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
 
-  if (*_iterCurrent == 0U)
-    throw OperationFailed("Current iteration element is undefined.", __FILE__, __LINE__);
+  if (this->_numElements == this->size())
+    throw Full(__FILE__, __LINE__);
+
+  this->construct(this->_numElements, elementToPush);
+  ++this->_numElements;
 
-  --(*_iterCurrent);
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
   return;
 }
 
 /*********************************************************************************************/
 
-template <class T> const T *const SStack<T>::iterCurrent() const
-  throw (DataStruct::OperationFailed)
+template <class T> void SStack<T>::push
+(
+  T&& elementToPush                                 // the element to be moved onto the stack
+)
+
+/*
+This method moves "elementToPush" onto the stack.  Otherwise, it's the same as the other
+"push()".
+*/
+
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+
+  if (this->_numElements == this->size())
+    throw Full(__FILE__, __LINE__);
 
-  if (*_iterCurrent == 0U)
-    throw OperationFailed("Current iteration element is undefined.", __FILE__, __LINE__);
+  this->construct(this->_numElements, std::move(elementToPush));
+  ++this->_numElements;
 
-  return &(_elements[*_iterCurrent - 1U]);
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
+  return;
 }
+
 /*********************************************************************************************/
 
-template <class T> void SStack<T>::push
+template <class T> template<class... Args> void SStack<T>::emplace
 (
-  const T& elementToPush                               // the element to be placed on the stack
+  Args&&... arguments                      // the arguments to construct the new element from
 )
 
 /*
-This method pushes a copy of "elementToPush" onto the stack.
+This method constructs a new element from "arguments" directly in the cell just above the top
+of the stack.  No temporary "T" is created.  The stack is checked for room before anything is
+constructed.
 
 PRECONDITIONS:
 The stack cannot be full.
 
 POSTCONDITIONS:
-The copy of "elementToPush" will be added at the top of the stack and will be the first element
-to be popped off.
+The new element will be at the top of the stack and will be the first element to be popped off.
 */
 
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
 
-  if (_numElements == _maxElements)
+  if (this->_numElements == this->size())
     throw Full(__FILE__, __LINE__);
 
-  _elements[_numElements] = elementToPush;
-  ++_numElements;
+  this->construct(this->_numElements, std::forward<Args>(arguments)...);
+  ++this->_numElements;
 
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
   return;
 }
 
@@ -376,26 +498,32 @@ template <class T> void SStack<T>::pop
 )
 
 /*
-This method pops the topmost element off of the stack and copies it to "poppedElement".
+This method pops the topmost element off of the stack and moves it to "poppedElement" (refer to
+"LinearStructure<T>::moveElement()").
 
 PRECONDITIONS:
 The stack cannot be empty.
 
 POSTCONDITIONS:
-The next element to be popped off of the stack is copied to "poppedElement" and removed from
-the stack.
+The next element to be popped off of the stack is moved to "poppedElement" and removed from the
+stack.  The element left behind in the stack is destroyed.
 */
 
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
 
-  if (_numElements == 0U)
+  if (this->_numElements == 0U)
     throw Empty(__FILE__, __LINE__);
 
-  poppedElement = _elements[_numElements - 1U];
-  --_numElements;
+  this->moveElement(poppedElement, this->elements()[this->_numElements - 1U]);
+  this->destroy(this->_numElements - 1U);
+  --this->_numElements;
 
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
   return;
 }
 
@@ -419,12 +547,14 @@ The next element to be popped off of the stack is copied to "elementToBePopped".
 */
 
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
 
-  if (_numElements == 0U)
+  if (this->_numElements == 0U)
     throw Empty(__FILE__, __LINE__);
 
-  elementToBePopped = _elements[_numElements - 1U];
+  elementToBePopped = this->elements()[this->_numElements - 1U];
   return;
 }
 
@@ -432,18 +562,39 @@ The next element to be popped off of the stack is copied to "elementToBePopped".
 
 template <class T> SStack<T>& SStack<T>::operator=
 (
-  const LinearStruct<T>& source                       // the source data structure to copy from
+  const SStack<T>& source                                     // the source stack to copy from
+)
+
+/*
+This method is the same as the other "operator=()" -- it's only here because otherwise the
+compiler would generate a (memberwise) one for assigning one "SStack" to another.
+*/
+
+{
+  return operator=(static_cast<const DataStructure<T>&>(source));
+}
+
+/*********************************************************************************************/
+
+template <class T> SStack<T>& SStack<T>::operator=
+(
+  const DataStructure<T>& source                      // the source data structure to copy from
 )
 
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
 
   /*
   Code re-use at its finest...
   */
 
-  _numElements = 0U;
-  operator+=(source);
+  if (&source != this)
+  {
+    empty();
+    operator+=(source);
+  }
 
   return *this;
 }
@@ -452,7 +603,7 @@ template <class T> SStack<T>& SStack<T>::operator=
 
 template <class T> SStack<T>& SStack<T>::operator+=
 (
-  const LinearStruct<T>& source                       // the source data structure to copy from
+  const DataStructure<T>& source                      // the source data structure to copy from
 )
 
 /*
@@ -463,6 +614,12 @@ each element in "source" is copied -- so that the new stack's structure is indep
 The first element in "source's" iteration order will be the first element to be popped off of
 the stack.
 
+If "source's" elements are contiguous (refer to "DataStructure<T>::contiguousElements()") then
+they're copied as a single block -- with "memcpy()" if "T" is trivially copyable -- and no
+"Iterator_" is used at all.  Since the block has to end up upside-down relative to the
+iteration order, an "SStack" source is copied straight across and any other contiguous source
+(such as an "SArray") is copied in reverse.
+
 PRECONDITIONS:
 There must be enough room in the instance's stack to hold the copies of "source's" elements.
 
@@ -471,43 +628,65 @@ POSTCONDITIONS:
 */
 
 {
-  assertInvariants();
+  #ifndef NDEBUG
+    this->assertInvariants();
+  #endif
 
-  if (source.numElements() > (_maxElements - _numElements))
-  {
-    OperationFailed::presetDetails() << "\"source\" contains " << source.numElements()
-      << " but there's only room for " << (_maxElements - _numElements) << " elements.";
+  if (source.numElements() > (this->size() - this->_numElements))
     throw OperationFailed("Assignment operation would cause an overflow.", __FILE__, __LINE__);
-  }
 
   if (source.numElements() > 0U)
   {
-    try
-    {
-      /*
-      Simply pushing each element in "source" onto the stack in turn would put them in the
-      wrong order.  "_numElements" must be increased by the number of elements that will be
-      added and the elements in "_elements" must be filled in from the top down.
-      */
+    /*
+    Simply pushing each element in "source" onto the stack in turn would put them in the wrong
+    order.  "_numElements" must be increased by the number of elements that will be added and
+    the new elements must be constructed from the top down.
+    */
 
-      unsigned int newHead = _numElements + source.numElements();
+    const unsigned int newNumElements = this->_numElements + source.numElements();
+    bool               isReversed;
+    const T *const     block          = source.contiguousElements(isReversed);
 
-      for (source.iterStart(); source.iterMore(); source.iterNext())
+    if (block != NULL)
+    {
+      try
       {
-        assert(source.iterCurrent() != NULL);
-        _elements[--newHead] = *source.iterCurrent();
+        this->constructCopies(this->_numElements, block, source.numElements(), !isReversed);
+      }
+      catch (...)
+      {
+        throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
       }
-
-      assert(newHead == _numElements);
-
-      _numElements += source.numElements();
-
-      assertInvariants();
     }
-    catch (...)
+    else
     {
-      throw OperationFailed("Element assignment operation failed.", __FILE__, __LINE__);
+      unsigned int newHead = newNumElements;
+
+      try
+      {
+        const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+        for (; i->more(); i->next())
+        {
+          assert(i->current() != NULL);
+          this->construct(newHead - 1U, *i->current());
+          --newHead;
+        }
+      }
+      catch (...)
+      {
+        this->destroy(newHead, newNumElements - newHead);
+        throw OperationFailed("Element copy operation failed.", __FILE__, __LINE__);
+      }
+
+      assert(newHead == this->_numElements);
     }
+
+    this->_numElements = newNumElements;
+
+    #ifndef NDEBUG
+      this->assertInvariants();
+    #endif
   }
 
   return *this;
@@ -517,7 +696,7 @@ POSTCONDITIONS:
 
 template <class T> SStack<T> SStack<T>::operator+
 (
-  const LinearStruct<T>& rhs                          // the source data structure to copy from
+  const DataStructure<T>& rhs                         // the source data structure to copy from
 )
 
 {
@@ -525,7 +704,7 @@ template <class T> SStack<T> SStack<T>::operator+
   Code re-use at its finest...
   */
 
-  return (SStack<T>(_maxElements + rhs.numElements(), *this) += rhs);
+  return (SStack<T>(this->size() + rhs.numElements(), *this) += rhs);
 }
 
 #endif
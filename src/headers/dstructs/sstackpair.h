@@ -12,10 +12,10 @@ The structure of an "SStackPair" object looks like this:
   --------------------------------   --------------------------------
   | Element | Element | Element | ... | Element | Element | Element |
   --------------------------------   --------------------------------
-		       ^               ^
-		       |               |
+                       ^               ^
+                       |               |
 _top -------------------               |
-				       |
+                                       |
 _top1 ----------------------------------
 
 There are two conceptual stacks here:  stack #0 and stack #1.
@@ -38,12 +38,33 @@ that means that stack #1 is empty.
 
 If "_top" and "_top1" should ever become equal then that means that both stacks
 are full.
+
+"_numElements" is the number of elements on the currently selected stack, so
+that "numElements()" means the same thing whether or not the caller knows that
+it has an "SStackPair".  While stack #0 is selected, "_numElements" is also
+stack #0's "_top" -- that's what lets "SStack's" methods work on stack #0
+unchanged.  While stack #1 is selected, stack #0's "_top" is kept in "_top"
+(refer to "top()").
+
+The array is "SDataStructure's" raw storage, so the cells between "_top" and
+"_top1" hold no constructed elements.  An element is constructed in its cell
+when it's pushed and destroyed when it's popped.
+
+Because each stack's elements are contiguous, "contiguousElements()" and the
+element iterators both describe whichever stack is currently selected.
 */
 
 // ============================================================================
 // INCLUDE FILES:
 // ============================================================================
 
+#include <assert.h>
+#include <stdarg.h>
+#include <stddef.h>
+
+#include <iterator>
+#include <utility>
+
 #include "sstack.h"
 
 // ============================================================================
@@ -51,37 +72,127 @@ are full.
 // ============================================================================
 
 template <class T> class SStackPair:
+  virtual public DataStructureExceptions,
   public SStack<T>
  {
   public:
     class BadSelection {};         // exception:  an unknown stack was selected
 
-			   SStackPair(const size_t);
-			   SStackPair(const size_t, const LinearStruct<T>&,
-                             const LinearStruct<T>&);
-			   SStackPair(const size_t, SStackPair<T>&);
-			   SStackPair(const size_t, const size_t, const size_t,
-                             ...);
-    virtual void           push(const T&)
+                           SStackPair(const unsigned int);
+                           SStackPair(const unsigned int,
+                             const DataStructure<T>&, const DataStructure<T>&);
+                           SStackPair(const unsigned int,
+                             const SStackPair<T>&);
+                           SStackPair(const SStackPair<T>& source):
+                             SStackPair(source.size(), source) {return;}
+                           SStackPair(const unsigned int, const unsigned int,
+                             const unsigned int, ...);
+    virtual                ~SStackPair();
+    virtual void           empty() noexcept;
+    virtual void           push(const T&);
+    virtual void           push(T&&);
     virtual void           pop(T&);
-    virtual unsigned int   isEmpty() const;
-    virtual unsigned int   isFull() const;
-    virtual size_t         numElements() const;
-    virtual SStackPair<T>& operator=(const LinearStruct<T>&);
+    virtual void           peek(T&) const;
+    template<class... Args>
+    void                   emplace(Args&&...);
+    virtual const bool     isFull() const noexcept
+                             {return top() == _top1;}
+    SStackPair<T>&         operator=(const SStackPair<T>&);
+    SStackPair<T>&         operator=(const DataStructure<T>&);
+    SStackPair<T>&         operator+=(const DataStructure<T>&);
     virtual void           select(const unsigned int);
-    virtual unsigned int   selected() const
-                             {checkInvariants(); return _selectedStack;}
+    const unsigned int     selected() const noexcept
+                             {return _selectedStack;}
+
+    /*
+    The element iterators walk the currently selected stack from its top
+    down, like "iterator()" does.  Stack #0 runs toward cell 0 and stack
+    #1 runs toward cell "size() - 1", so an iterator keeps a step of -1 or +1
+    and incrementing it is a single index addition.
+    */
+
+    template<class Element> class CellIterator
+     {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef Element*                  pointer;
+        typedef Element&                  reference;
+
+                      CellIterator(Element *const cells = NULL,
+                        const ptrdiff_t index = 0, const ptrdiff_t step = 1):
+                        _cells(cells), _index(index), _step(step) {}
+                      CellIterator(const CellIterator<T>& source):
+                        _cells(source._cells), _index(source._index),
+                        _step(source._step) {}
+
+        CellIterator& operator=(const CellIterator&) = default;
+
+        Element&      operator*() const
+                        {return _cells[_index];}
+        Element*      operator->() const
+                        {return _cells + _index;}
+        CellIterator& operator++()
+                        {_index += _step; return *this;}
+        CellIterator  operator++(int)
+                        {
+                         const CellIterator old(*this);
+                         _index += _step;
+                         return old;
+                        }
+
+        const bool    operator==(const CellIterator& rhs) const
+                        {return _index == rhs._index;}
+        const bool    operator!=(const CellIterator& rhs) const
+                        {return _index != rhs._index;}
+
+      private:
+        Element*  _cells;                 // cell 0 of the array
+        ptrdiff_t _index;                 // index of the current element
+        ptrdiff_t _step;                  // -1 for stack #0, +1 for stack #1
+
+        friend class CellIterator<const T>;
+     };
+
+    typedef CellIterator<T>       ElementIterator;
+    typedef CellIterator<const T> ConstElementIterator;
+
+    ElementIterator        begin()
+                             {return cellIterator<T>(this->elements(), false);}
+    ElementIterator        end()
+                             {return cellIterator<T>(this->elements(), true);}
+    ConstElementIterator   begin() const
+                             {
+                              return cellIterator<const T>(this->elements(),
+                                false);
+                             }
+    ConstElementIterator   end() const
+                             {
+                              return cellIterator<const T>(this->elements(),
+                                true);
+                             }
+
+    virtual typename DataStructure<T>::Iterator_ *const iterator() const;
+    virtual const T *const contiguousElements(bool&) const noexcept;
+    virtual void           concatenate(const DataStructure<T>& source)
+                             {operator+=(source); return;}
+
   protected:
-    virtual void iterStart() const;
-    virtual int  iterMore() const;
-    virtual void iterNext() const;
-    virtual T&   iterElement() const;
+    #ifndef NDEBUG
+      virtual void         assertInvariants() const noexcept;
+    #endif
+
   private:
-    size_t       _top1;          // index of the topmost element of stack 1
-    unsigned int _selectedStack  // the stack to refer to
+    unsigned int _top;           // stack #0's "_top" while stack #1 is selected
+    unsigned int _top1;          // index of the topmost element of stack 1
+    unsigned int _selectedStack; // the stack to refer to
+
+    const unsigned int top() const noexcept
+                         {return _selectedStack ? _top : this->_numElements;}
 
-                SStackPair();
-    inline void checkInvariants() const;
+    template<class Element>
+    CellIterator<Element> cellIterator(Element *const, const bool) const;
  };
 
 // ============================================================================
@@ -90,7 +201,7 @@ template <class T> class SStackPair:
 
 template <class T> SStackPair<T>::SStackPair
  (
-  const size_t size                    // # of elements that the stack can hold
+  const unsigned int size              // # of elements that the stack can hold
  ):
 
 /*
@@ -98,18 +209,22 @@ This constructor instanciates an empty pair of stacks that can contain "size"
 elements.
 
 PRECONDITIONS:
-"size" must be greater than zero.
+None.
 
 POSTCONDITIONS:
 An empty stack with room for "size" elements is created.  Stack #0 will be the
 curently selected stack.
 */
 
-  SStack<T>(size)
+  SDataStructure<T>(size),
+  SStack<T>(size),
+  _top(0U),
+  _top1(size),
+  _selectedStack(0U)
  {
-  _top1 = size;
-  _selectedStack = 0;
-  checkInvariants();
+  #ifndef NDEBUG
+    SStackPair<T>::assertInvariants();
+  #endif
   return;
  }
 
@@ -117,9 +232,9 @@ curently selected stack.
 
 template <class T> SStackPair<T>::SStackPair
  (
-  const size_t           size,         // # of elements that the stack can hold
-  const LinearStruct<T>& source0,      // the Stack to be copied into stack #0
-  const LinearStruct<T>& source1       // the Stack to be copied into stack #1
+  const unsigned int      size,        // # of elements that the stack can hold
+  const DataStructure<T>& source0,     // the Stack to be copied into stack #0
+  const DataStructure<T>& source1      // the Stack to be copied into stack #1
  ):
 
 /*
@@ -129,20 +244,23 @@ in "source0" and "source1" is copied -- so that the new stack's structures are
 independent of "source0" and "source1's" structures.
 
 PRECONDITIONS:
-"size" must be greater than zero.
+There must be room for both sources' elements.
 
 POSTCONDITIONS:
 A new pair of stacks are created.  Their contents are a copy of "source0" and
 "source1's".  Stack #0 will be the currently selected stack
 */
 
-  SStack<T>(size, source0)
+  SDataStructure<T>(size),
+  SStack<T>(size),
+  _top(0U),
+  _top1(size),
+  _selectedStack(0U)
  {
-  _top1 = size;
-  _selectedStack = 1;
-  operator=(source1);
-  _selectedStack = 0;
-  checkInvariants();
+  operator+=(source0);
+  select(1U);
+  operator+=(source1);
+  select(0U);
   return;
  }
 
@@ -150,37 +268,31 @@ A new pair of stacks are created.  Their contents are a copy of "source0" and
 
 template <class T> SStackPair<T>::SStackPair
  (
-  const size_t   size,    // # of elements that the stack can hold
-  SStackPair<T>& source   // that SStackPair from which elements will be copied
+  const unsigned int   size,  // # of elements that the stack can hold
+  const SStackPair<T>& source // the SStackPair to copy elements from
  ):
 
 /*
 This constructor instanciates a SStackPair and copies the contents of "source"
-to the new SStackPair object.  The copy is deep -- that is, each element in
-"source" is copied -- so that the new SStackPair's array is independent of
-"source's" array.
+to the new SStackPair object (refer to "operator=()").  The copy is deep --
+that is, each element in "source" is copied -- so that the new SStackPair's
+array is independent of "source's" array.
 
 PRECONDITIONS:
-"size" must be greater than zero.
+There must be room for all of "source's" elements.
 
 POSTCONDITIONS:
 A new pair of stacks are created.  Their contents are a copy of "source's".
 Stack #0 will be the currently selected stack.
 */
 
-  SStack<T>(size)
+  SDataStructure<T>(size),
+  SStack<T>(size),
+  _top(0U),
+  _top1(size),
+  _selectedStack(0U)
  {
-  unsigned int originalStack = source.selected();
-
-  _top1 = size;
-  _selectedStack = 1;
-  source.select(1)
   operator=(source);
-  _selectedStack = 0;
-  source.select(0);
-  operator=(source);
-  source.select(originalStack);
-  checkInvariants();
   return;
  }
 
@@ -188,12 +300,12 @@ Stack #0 will be the currently selected stack.
 
 template <class T> SStackPair<T>::SStackPair
  (
-  const size_t size,             // # of elements that the stack can hold
-  const size_t numElements0,     // # of elements in the parameter list for the
-                                 //   the first stack
-  const size_t numElements1,     // # of elements in the parameter list for the
-				 //   second stack
-  ...                            // the elements to be pushed onto the stacks
+  const unsigned int size,         // # of elements that the stack can hold
+  const unsigned int numElements0, // # of elements in the parameter list for
+                                   //   the first stack
+  const unsigned int numElements1, // # of elements in the parameter list for
+                                   //   the second stack
+  ...                              // the elements to be pushed onto the stacks
  ):
 
 /*
@@ -207,29 +319,84 @@ element to be poped from the second stack.
 "T" cannot be "char", "unsigned char" or "float".
 
 PRECONDITIONS:
-"size" must be greater than zero.
+There must be room for all of the elements.
 
 POSTCONDITIONS:
 A new pair of stacks are created.  Their contents are copies of the elements
 passed in the parameter list.  Stack #0 will be the currently selected stack.
 */
 
-  SStack<T>(size)
+  SDataStructure<T>(size),
+  SStack<T>(size),
+  _top(0U),
+  _top1(size),
+  _selectedStack(0U)
  {
-  va_list argList;
-  size_t  element;
+  va_list      argList;
+  unsigned int element;
 
-  _top1 = size;
-  _selectedStack = 0;
   va_start(argList, numElements1);
-  for (element = 0; element < numElements0; element++)
-    push(va_arg(argList, T));
-  _selectedStack = 1;
-  for (element = 0; element < numElements1; element++)
-    push(va_arg(argList, T));
-  _selectedStack = 0;
+  try
+   {
+    for (element = 0U; element < numElements0; element++)
+      push(va_arg(argList, T));
+    select(1U);
+    for (element = 0U; element < numElements1; element++)
+      push(va_arg(argList, T));
+    select(0U);
+   }
+  catch (...)
+   {
+    va_end(argList);
+    this->destroy(_top1, this->size() - _top1);
+    this->destroy(0U, top());
+    this->_numElements = 0U;
+    throw;
+   }
   va_end(argList);
-  checkInvariants();
+  return;
+ }
+
+/*****************************************************************************/
+
+template <class T> SStackPair<T>::~SStackPair()
+
+/*
+This destructor destroys the elements on both stacks.  "_numElements" is left
+at 0 so that "SStack's" destructor has nothing left to do.
+*/
+
+ {
+  this->destroy(_top1, this->size() - _top1);
+  this->destroy(0U, top());
+  this->_numElements = 0U;
+  return;
+ }
+
+/*****************************************************************************/
+
+template <class T> void SStackPair<T>::empty() noexcept
+
+/*
+This method destroys every element on the currently selected stack.  The other
+stack isn't touched.
+*/
+
+ {
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  if (_selectedStack)
+   {
+    this->destroy(_top1, this->size() - _top1);
+    _top1 = this->size();
+    this->_numElements = 0U;
+   }
+  else
+    SStack<T>::empty();
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
   return;
  }
 
@@ -252,110 +419,144 @@ stack and will be the first element to be popped off.
 */
 
  {
-  checkInvariants();
-  if (isFull()) throw Full();
-  if (_selectedStack)
-    _stackSpace[--_top1] = newElement;
-  else
-    SStack<T>::push(newElement);
-  checkInvariants();
+  emplace(newElement);
   return;
  }
 
 /*****************************************************************************/
 
-template <class T> void SStackPair<T>::pop
+template <class T> void SStackPair<T>::push
  (
-  T& element                      // the variable to receive the popped element
+  T&& newElement                       // the element to be moved onto the stack
  )
 
 /*
-This method pops the topmost element off of the currently selected stack and
-copies it to "element".
-
-PRECONDITIONS:
-The currently selected stack cannot be empty.
-
-POSTCONDITIONS:
-The next element to be popped off of the currently selected stack is copied to
-"element".
+This method moves "newElement" onto the currently selected stack.  Otherwise,
+it's the same as the other "push()".
 */
 
  {
-  checkInvariants();
-  if (isEmpty()) thow Empty();
-  if (_selectedStack)
-    element = _stackSpace[_top1++];
-  else
-    SStack<T>::pop(element);
-  checkInvariants();
+  emplace(std::move(newElement));
   return;
  }
 
 /*****************************************************************************/
 
-template <class T> int SStackPair<T>::isEmpty() const
+template <class T> template<class... Args> void SStackPair<T>::emplace
+ (
+  Args&&... arguments             // the arguments to construct the element from
+ )
 
 /*
-This method returns a non-zero value if there are no elements on the currently
-selected stack and zero if there is at least one element on the currently
-selected stack.
+This method constructs a new element from "arguments" and pushes it onto the
+currently selected stack.
 
 PRECONDITIONS:
-None.
+The pair of stacks cannot be full.
 
 POSTCONDITIONS:
-None.
+The new element will be placed at the top of the currently selected stack and
+will be the first element to be popped off.
 */
 
  {
-  checkInvariants();
-  return (_selectedStack ? _top1 == size : SStack<T>::isEmpty());
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  if (isFull())
+    throw Full(__FILE__, __LINE__);
+  if (_selectedStack)
+   {
+    this->construct(_top1 - 1U, std::forward<Args>(arguments)...);
+    --_top1;
+    ++this->_numElements;
+   }
+  else
+    SStack<T>::emplace(std::forward<Args>(arguments)...);
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  return;
  }
 
 /*****************************************************************************/
 
-template <class T> int SStackPair<T>::isFull() const
+template <class T> void SStackPair<T>::pop
+ (
+  T& element                      // the variable to receive the popped element
+ )
 
 /*
-This method returns a non-zero value if there is no more room on either stack
-and zero if there is room for at least one more element on either stack.
+This method pops the topmost element off of the currently selected stack and
+moves it to "element" (refer to "LinearStructure<T>::moveElement()").
 
 PRECONDITIONS:
-None.
+The currently selected stack cannot be empty.
 
 POSTCONDITIONS:
-None.
+The next element to be popped off of the currently selected stack is moved to
+"element".
 */
 
  {
-  checkInvariants();
-  return (_top == _top1);
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  if (isEmpty())
+    throw Empty(__FILE__, __LINE__);
+  if (_selectedStack)
+   {
+    this->moveElement(element, this->elements()[_top1]);
+    this->destroy(_top1);
+    ++_top1;
+    --this->_numElements;
+   }
+  else
+    SStack<T>::pop(element);
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  return;
  }
 
 /*****************************************************************************/
 
-template <class T> size_t SStackPair<T>::numElements() const
+template <class T> void SStackPair<T>::peek
+ (
+  T& element           // the variable to receive the next element to be popped
+ )
+const
 
 /*
-This method returns the number of elements in the currently selected stack.
+This method copies the topmost element of the currently selected stack to
+"element" without popping it off.
 
 PRECONDITIONS:
-None.
+The currently selected stack cannot be empty.
 
 POSTCONDITIONS:
-None.
+The next element to be popped off of the currently selected stack is copied to
+"element".
 */
 
  {
-  return (_selectedStack ? _size - _top1 : SStack<T>::numElements());
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  if (isEmpty())
+    throw Empty(__FILE__, __LINE__);
+  if (_selectedStack)
+    element = this->elements()[_top1];
+  else
+    SStack<T>::peek(element);
+  return;
  }
 
 /*****************************************************************************/
 
 template <class T> SStackPair<T>& SStackPair<T>::operator=
  (
-  const LinearStruct<T>& source     // the source linear structure to copy from
+  const DataStructure<T>& source    // the source data structure to copy from
  )
 
 /*
@@ -373,16 +574,92 @@ copies of "source's" contents.
 */
 
  {
-  checkInvariants();
-  if ((_selectedStack ? _size - _top : _top1) < source.numElements())
-    throw Full();
-  if (_selectedStack)
-    _top1 = _size - source.numElements();
-    for(source.iterStart(); source.iterMore(); source.iterNext())
-      _stackSpace[_top1++] = source.iterElement();
-    _top1 = _size - source.numElements();
-  else
-    SStack<T>::operator=(source);
+  if (&source != this)
+   {
+    empty();
+    operator+=(source);
+   }
+  return *this;
+ }
+
+/*****************************************************************************/
+
+template <class T> SStackPair<T>& SStackPair<T>::operator+=
+ (
+  const DataStructure<T>& source    // the source data structure to copy from
+ )
+
+/*
+This operator appends copies of "source's" elements to the currently selected
+stack, in the same way as "SStack<T>::operator+=()":  the first element in
+"source's" iteration order will be the first element to be popped off.  A
+contiguous source is copied as one block.
+
+PRECONDITIONS:
+There must be enough room between the two stacks to hold the copies of
+"source's" elements.
+
+POSTCONDITIONS:
+"source's" elements are on top of the currently selected stack.
+*/
+
+ {
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  const unsigned int count = source.numElements();
+  if (count > _top1 - top())
+    throw Full(__FILE__, __LINE__);
+  if (!_selectedStack)
+    SStack<T>::operator+=(source);
+  else if (count > 0U)
+   {
+    /*
+    Stack #1 grows downward, so the new elements go in the "count" cells
+    below "_top1" with the first one in "source's" iteration order lowest.
+    */
+
+    const unsigned int newTop1 = _top1 - count;
+    bool               isReversed;
+    const T *const     block   = source.contiguousElements(isReversed);
+
+    if (block != NULL)
+     {
+      try
+       {
+        this->constructCopies(newTop1, block, count, isReversed);
+       }
+      catch (...)
+       {
+        throw OperationFailed("Element copy operation failed.", __FILE__,
+          __LINE__);
+       }
+     }
+    else
+     {
+      unsigned int numCopied = 0U;
+
+      try
+       {
+        const SDP<typename DataStructure<T>::Iterator_> i(source.iterator());
+
+        for (; numCopied < count; ++numCopied, i->next())
+          this->construct(newTop1 + numCopied, *i->current());
+       }
+      catch (...)
+       {
+        this->destroy(newTop1, numCopied);
+        throw OperationFailed("Element copy operation failed.", __FILE__,
+          __LINE__);
+       }
+     }
+
+    _top1 = newTop1;
+    this->_numElements += count;
+   }
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
   return *this;
  }
 
@@ -390,13 +667,14 @@ copies of "source's" contents.
 
 template <class T> SStackPair<T>& SStackPair<T>::operator=
  (
-  SStackPair<T>& source                   // the source SStackPair to copy from
+  const SStackPair<T>& source             // the source SStackPair to copy from
  )
 
 /*
 This operator copies the contents of "source" to the two stacks.  The copy is
 deep -- that is, each element in "source" is copied -- so that the currently
-selected stack's structure is independent of "source's" structure.
+selected stack's structure is independent of "source's" structure.  Stack #0
+is selected afterward.
 
 PRECONDITIONS:
 There must be enough room in the stack pair to hold the copies of "source's"
@@ -408,18 +686,38 @@ contents.
 */
 
  {
-  const unsigned int lastSelected = _selected;
-
-  checkInvariants();
-  if (source._top + (source._size - source._top1) > _size) throw Full();
-  _selected = source.selected();
-  operator=((linearStruct)source);
-  _selected = (_selected ? 0 : 1);
-  source.select(_selected);
-  operator=((linearStruct)source);
-  source.select(_selected ? 0 : 1);
-  _select = lastSelected;
-  checkInvariants();
+  if (&source == this)
+    return *this;
+
+  const unsigned int count0 = source.top();
+  const unsigned int count1 = source.size() - source._top1;
+
+  if (count0 + count1 > this->size())
+    throw Full(__FILE__, __LINE__);
+
+  this->destroy(_top1, this->size() - _top1);
+  this->destroy(0U, top());
+  _top1 = this->size();
+  _selectedStack = 0U;
+  this->_numElements = 0U;
+
+  try
+   {
+    this->constructCopies(0U, source.elements(), count0, false);
+    this->_numElements = count0;
+    this->constructCopies(this->size() - count1, source.elements() +
+      source._top1, count1, false);
+    _top1 = this->size() - count1;
+   }
+  catch (...)
+   {
+    throw OperationFailed("Element copy operation failed.", __FILE__,
+      __LINE__);
+   }
+
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
   return *this;
  }
 
@@ -444,139 +742,134 @@ or the object is destroyed.
 */
 
  {
-  checkInvariants();
-  if (_selectedStack != 0 && _selectedStack != 1) throw BadSelection();
-  _selectedStack = newStack;
-  checkInvariants();
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
+  if (newStack != 0U && newStack != 1U)
+    throw BadSelection();
+  if (newStack != _selectedStack)
+   {
+    if (newStack)
+     {
+      _top = this->_numElements;
+      this->_numElements = this->size() - _top1;
+     }
+    else
+      this->_numElements = _top;
+    _selectedStack = newStack;
+   }
+  #ifndef NDEBUG
+    assertInvariants();
+  #endif
   return;
  }
 
 /*****************************************************************************/
 
-template <class T> void SStackPair<T>::iterStart() const
+template <class T>
+typename DataStructure<T>::Iterator_ *const SStackPair<T>::iterator() const
 
 /*
-This method initializes the iteration control.  The order of the iteration is
-topmost element to bottommost element.
+This method returns a new iterator over the currently selected stack.  The
+order of the iteration is topmost element to bottommost element.
 
-DANGER!  Do not attempt to switch stacks in the middle of an iteration.
+DANGER!  Do not attempt to switch stacks while an iterator is in use.
 
 PRECONDITIONS:
 None.
 
 POSTCONDITIONS:
-The iteration control has been initialized.
+The caller owns the new iterator.
 */
 
  {
-  checkInvariants();
-  if (_selectedStack)
-    *_iterator = _top1;
-  else
-    SStack<T>::iterStart();
-  return;
+  return DataStructure<T>::newIterator(*this);
  }
 
 /*****************************************************************************/
 
-template <class T> int SStackPair<T>::iterMore() const
-
-/*
-This method returns a non-zero value if there are more elements to iterate
-through and zero if there aren't.
-
-DANGER!  Do not attempt to switch stacks in the middle of an iteration.
-
-PRECONDITIONS:
-The iteration control must have been initialized.
-
-POSTCONDITIONS:
-None.
-*/
-
- {
-  checkInvariants();
-  return (selectedStack ? *_iterator < _size : SStack<T>::iterMore());
- }
-
-/*****************************************************************************/
-
-template <class T> void SStackPair<T>::iterNext() const
+template <class T> const T *const SStackPair<T>::contiguousElements
+ (
+  bool& isReversed                        // which way the iteration runs
+ )
+const noexcept
 
 /*
-This method sets the iteration control to the next element to be iterated
-through.  The order of the iteration is topmost element to bottommost element.
-
-DANGER!  Do not attempt to switch stacks in the middle of an iteration.
-
-PRECONDITIONS:
-The iteration control must have been initialized.
-
-POSTCONDITIONS:
-The iteration control is set to the next element to be iterated through.
+This method returns the block of cells that the currently selected stack
+occupies (refer to "DataStructure<T>::contiguousElements()").  Stack #0's
+block is iterated from its highest cell down and stack #1's is iterated from
+its lowest cell up.  NULL is returned if the selected stack is empty.
 */
 
  {
-  checkInvariants();
   if (_selectedStack)
-    (*_iterator)++;
+   {
+    isReversed = false;
+    return (_top1 < this->size() ? this->elements() + _top1 : NULL);
+   }
   else
-    SStack<T>::iterNext();
-  return;
+    return SStack<T>::contiguousElements(isReversed);
  }
 
 /*****************************************************************************/
 
-template <class T> T& SStackPair<T>::iterElement() const
+template <class T> template<class Element>
+inline typename SStackPair<T>::template CellIterator<Element>
+  SStackPair<T>::cellIterator
+ (
+  Element *const cells,                   // cell 0 of the array
+  const bool     isEnd                    // make an end iterator?
+ )
+const
 
 /*
-This method returns a pointer to the current element being iterated through
-
-DANGER!  Do not attempt to switch stacks in the middle of an iteration.
-
-PRECONDITIONS:
-The iteration control must have been initialized.
-
-POSTCONDITIONS:
-None.
+This method returns an element iterator (or end iterator) for the currently
+selected stack.  The end of stack #0 is index -1 and the end of stack #1 is
+index "size()".
 */
 
  {
-  checkInvariants();
-  return (_selectedStack ? _stackSpace[*_iterator] : SStack<T>::iterElement());
+  if (_selectedStack)
+   {
+    return CellIterator<Element>(cells,
+      isEnd ? (ptrdiff_t)this->size() : (ptrdiff_t)_top1, 1);
+   }
+  else
+   {
+    return CellIterator<Element>(cells,
+      isEnd ? -1 : (ptrdiff_t)this->_numElements - 1, -1);
+   }
  }
 
 /*****************************************************************************/
 
-template <class T> inline void SStackPair<T>::checkInvariants() const
-
-/*
-This method asserts the "SStackPair" invariants.  If an invariant has been
-broken then the stack has been corrupted somehow and the program should halt
-before any real damage can be done.
-
-PRECONDITIONS:
-None.
-
-POSTCONDITIONS:
-None.
-*/
+#ifndef NDEBUG
+  template <class T> void SStackPair<T>::assertInvariants() const noexcept
 
- {
-  SStack::checkInvariants();
-  /*
-  INVARIANT:  "_top1" must be greater than or equal to 0 and less than or equal
-  to "_size".
-  */
-  assert(_top1 >= 0 && _top1 <= _size);
   /*
-  INVARIANT:  Neither stack can invade the other stack's space.
+  This method asserts the "SStackPair" invariants.  If an invariant has been
+  broken then the stack has been corrupted somehow and the program should halt
+  before any real damage can be done.
   */
-  assert(_top < _top1);
-  /*
-  INVARAINT:  "_selectedStack" must be either 0 or 1.
-  */
-  assert(_selectedStack == 0 || _selectedStack == 1);
-  return;
- }
 
+   {
+    SDataStructure<T>::assertInvariants();
+    /*
+    INVARIANT:  "_top1" must be less than or equal to "size()".
+    */
+    assert(_top1 <= this->size());
+    /*
+    INVARIANT:  Neither stack can invade the other stack's space.
+    */
+    assert(top() <= _top1);
+    /*
+    INVARAINT:  "_selectedStack" must be either 0 or 1, and "_numElements"
+    must count its elements.
+    */
+    assert(_selectedStack == 0U || _selectedStack == 1U);
+    assert(!_selectedStack || this->_numElements == this->size() - _top1);
+    return;
+   }
+#endif
+
+#endif
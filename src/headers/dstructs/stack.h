@@ -11,12 +11,19 @@
 This class is a base class for stack implementations.  A "Stack" is a "LinearStructure".
 
 For iterations, the topmost element is considered to be the first element in the iteration.
+
+Elements can be moved as well as copied onto and off of a stack.  "push(T&&)" moves its
+argument onto the stack, "emplace()" constructs an element on the stack from its arguments, and
+"pop()" moves the popped element into the caller's variable (refer to
+"LinearStructure<T>::moveElement()" for when it copies instead).
 */
 
 // ============================================================================================
 // INCLUDE FILES
 // ============================================================================================
 
+#include <utility>
+
 #ifdef FAT_FILENAMES
   #include <dstructs/linearst.h>
 #else
@@ -38,20 +45,60 @@ template<class T> class Stack:
   public:
 
     /*
-    There are three public virtual methods:  "push()", "pop()" and "peek()".  "push()" and
-    "pop()" must be defined as the operations that add and remove elements to and from the
-    stack, respectively, in last-in-first-out order.  "peek()" must be defined as an operation
-    that gets the next element to be popped off of the stack without actually popping it off.
+    There are four public virtual methods:  two "push()" methods, "pop()" and "peek()".
+    "push()" and "pop()" must be defined as the operations that add and remove elements to and
+    from the stack, respectively, in last-in-first-out order.  "push(const T&)" copies its
+    argument onto the stack and "push(T&&)" moves it.  "pop()" should move the element out with
+    "moveElement()".  "peek()" must be defined as an operation that gets the next element to be
+    popped off of the stack without actually popping it off.
+
+    "emplace()" can't be virtual because it's a template.  The version here constructs a
+    temporary and moves it onto the stack; descendents should hide it with a version that
+    constructs the element in place.
     */
 
-    virtual void     push(const T&)       throw (Full, OperationFailed)  = 0;
-    virtual void     pop(T&)              throw (Empty, OperationFailed) = 0;
-    virtual void     peek(T&) const       throw (Empty, OperationFailed) = 0;
+    virtual void     push(const T&)  = 0;
+    virtual void     push(T&&)  = 0;
+    virtual void     pop(T&) = 0;
+    virtual void     peek(T&) const = 0;
+
+    template<class... Args>
+    inline void      emplace(Args&&...);
 
-    inline Stack<T>& operator<<(const T&) throw (Full, OperationFailed);
-    inline Stack<T>& operator>>(T&)       throw (Empty, OperationFailed);
+    inline Stack<T>& operator<<(const T&);
+    inline Stack<T>& operator<<(T&&);
+    inline Stack<T>& operator>>(T&);
 };
 
+// ============================================================================================
+// METHOD DEFINITIONS
+// ============================================================================================
+
+/*********************************************************************************************/
+
+template<class T> template<class... Args> inline void Stack<T>::emplace
+(
+  Args&&... arguments                      // the arguments to construct the new element from
+)
+
+/*
+This method constructs a new element from "arguments" and pushes it onto the stack.
+
+This version constructs a temporary "T" and moves it onto the stack with "push(T&&)".
+Descendents hide it with versions that construct the element right where it'll be stored.
+
+PRECONDITIONS:
+Same as for "push()" for descendents of "Stack<T>".
+
+POSTCONDITIONS:
+Same as for "push()" for descendents of "Stack<T>".
+*/
+
+{
+  push(T(std::forward<Args>(arguments)...));
+  return;
+}
+
 // ============================================================================================
 // CONVENIENCE OPERATORS
 // ============================================================================================
@@ -62,7 +109,6 @@ template<class T> inline Stack<T>& Stack<T>::operator<<
 (
   const T& elementToPush
 )
-throw (DataStructureExceptions::Full, DataStructureExceptions::OperationFailed)
 
 /*
 This function makes the shift-in operator work like a "Stack<T>'s" "push()" method and thus
@@ -94,11 +140,28 @@ Same as for "push()" for descendents of "Stack<T>".
 
 /*********************************************************************************************/
 
+template<class T> inline Stack<T>& Stack<T>::operator<<
+(
+  T&& elementToPush
+)
+
+/*
+This function is the same as the other shift-in operator (above) except that it moves
+"elementToPush" onto the stack instead of copying it.  It's called automatically for
+temporaries and for arguments wrapped in "std::move()".
+*/
+
+{
+  push(std::move(elementToPush));
+  return *this;
+}
+
+/*********************************************************************************************/
+
 template<class T> inline Stack<T>& Stack<T>::operator>>
 (
   T& poppedElement
 )
-throw (DataStructureExceptions::Empty, DataStructureExceptions::OperationFailed)
 
 /*
 This function makes the shift-out operator work like a "Stack<T>'s" "pop()" method and thus
@@ -120,7 +183,8 @@ PRECONDITIONS:
 Same as for "pop()" for descendents of "Stack<T>".
 
 POSTCONDITIONS:
-Same as for "pop()" for descendents of "Stack<T>".
+Same as for "pop()" for descendents of "Stack<T>".  "poppedElement" receives the popped element
+by moving whenever "pop()" does.
 */
 
 {
@@ -0,0 +1,69 @@
+#ifndef DSTRUCTS_TREE_H
+#define DSTRUCTS_TREE_H
+
+// ============================================================================================
+//
+// tree.h -- Tree Data Structure Base Class
+//
+// ============================================================================================
+
+/*
+This class is an abstract data type base class for all tree data structures.
+
+It has no data members.  A tree decides for itself where each element goes, so elements are
+added with "concatenate()" (or with whatever methods a descendent provides) rather than at a
+position that the caller chooses.
+*/
+
+// ============================================================================================
+// INCLUDE FILES
+// ============================================================================================
+
+#ifdef FAT_FILENAMES
+  #include <dstructs/datastru.h>
+#else
+  #include <dstructs/datastructure.h>
+#endif
+
+// ============================================================================================
+// CLASS DECLARATION
+// ============================================================================================
+
+template<class T> class Tree:
+  virtual public DataStructure<T>
+{
+  public:
+    virtual void concatenate(const DataStructure<T>&) = 0;
+
+    Tree<T>&     operator=(const DataStructure<T>&);
+    Tree<T>&     operator+=(const DataStructure<T>&);
+};
+
+// ============================================================================================
+// METHOD DEFINITIONS
+// ============================================================================================
+
+template<class T> Tree<T>& Tree<T>::operator=
+(
+  const DataStructure<T>& source
+)
+
+{
+  this->empty();
+  concatenate(source);
+  return *this;
+}
+
+/*********************************************************************************************/
+
+template<class T> Tree<T>& Tree<T>::operator+=
+(
+  const DataStructure<T>& source
+)
+
+{
+  concatenate(source);
+  return *this;
+}
+
+#endif